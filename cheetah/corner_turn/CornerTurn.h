@@ -25,6 +25,7 @@
 #ifndef SKA_CHEETAH_CORNER_TURN_CORNERTURN_H
 #define SKA_CHEETAH_CORNER_TURN_CORNERTURN_H
 
+#include "cheetah/utils/WorkerPool.h"
 #include <cstddef>
 
 namespace ska {
@@ -51,6 +52,22 @@ namespace corner_turn {
 template <typename SourceIteratorT, typename DestinIteratorT>
 void corner_turn(SourceIteratorT&& src_it, DestinIteratorT&& dst_it, std::size_t num_input_innerloop_elements, std::size_t num_input_outerloop_elements);
 
+/**
+ * @brief     A multi-threaded cornerturn of contiguous host memory
+ *
+ * @details   As corner_turn but the transpose is tiled and distributed over the threads of
+ *            the pool (the calling thread included). Uses the nasm kernels where enabled.
+ *
+ * @param     data_in      pointer to the data block to be cornerturned (input)
+ * @param     data_out     pointer to destination data block (must not overlap the input)
+ * @param     num_input_innerloop_elements  size of inner_loop_elements of input
+ * @param     num_input_outerloop_elements  size of outer_loop_elements of input
+ * @param     output_stride  number of elements between the start of each output row (>= num_input_outerloop_elements)
+ * @param     pool  the threads to use. These persist between calls so they are not recreated for each block.
+ */
+template <typename SrcT, typename DstT>
+void parallel_corner_turn(SrcT const* data_in, DstT* data_out, std::size_t num_input_innerloop_elements, std::size_t num_input_outerloop_elements, std::size_t output_stride, utils::WorkerPool& pool);
+
 } // namespace corner_turn
 } // namespace cheetah
 } // namespace ska
@@ -27,6 +27,7 @@
 
 #include "cheetah/corner_turn/detail/AlgoCRTP.h"
 #include "cheetah/utils/Architectures.h"
+#include "cheetah/utils/WorkerPool.h"
 #include <cstddef>
 
 namespace ska {
@@ -66,6 +67,19 @@ void corner_turn(SrcIteratorT&& data_in
                , std::size_t num_input_innerloop_elements
                , std::size_t num_input_outerloop_elements);
 
+/**
+ * @brief execute the corner turn using multiple threads
+ * @details the output rows are output_stride elements apart, allowing the result
+ *          to be written directly into a larger (e.g. aggregation) buffer
+ */
+template<typename SrcT, typename DstT>
+void parallel_corner_turn(SrcT const* data_in
+                        , DstT* data_out
+                        , std::size_t num_input_innerloop_elements
+                        , std::size_t num_input_outerloop_elements
+                        , std::size_t output_stride
+                        , utils::WorkerPool& pool);
+
 } // namespace cpu
 } // namespace corner_turn
 } // namespace cheetah
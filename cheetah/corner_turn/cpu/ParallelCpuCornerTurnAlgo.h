@@ -0,0 +1,107 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_CORNER_TURN_CPU_PARALLELCPUCORNERTURNALGO_H
+#define SKA_CHEETAH_CORNER_TURN_CPU_PARALLELCPUCORNERTURNALGO_H
+
+#include "cheetah/utils/WorkerPool.h"
+#include <cstddef>
+
+namespace ska {
+namespace cheetah {
+namespace corner_turn {
+namespace cpu {
+
+/**
+ * @brief A multi-threaded, cache blocked variant of the BatchedCpuCornerTurnAlgo
+ * @details The outer dimension of the input is split into contiguous ranges (aligned to the
+ *          nelements_per_cache_lane tile size) which are processed by the threads of a utils::WorkerPool.
+ *          Each thread recursively subdivides its region along the longest dimension until
+ *          the block is small enough to stay resident in the L1/L2 caches for both the
+ *          reads and the strided writes, and then hands each nelements_per_cache_lane^2 tile
+ *          to the BatchOptimiser (which may be a SIMD kernel, e.g. the nasm::NasmBatcher).
+ *
+ *          The destination rows may be strided (output_stride >= num_input_outerloop_elements),
+ *          allowing the output to be written directly into a larger buffer.
+ *
+ * @tparam TraitsT as for the BatchedCpuCornerTurnAlgo
+ */
+template<class TraitsT>
+class ParallelCpuCornerTurnAlgo
+{
+    public:
+        ParallelCpuCornerTurnAlgo(ParallelCpuCornerTurnAlgo const&) = delete;
+
+        /**
+         * @brief executes the copy and turn algorithm
+         * @param output_stride the distance between consecutive rows in the output (in elements)
+         * @param pool the threads to spread the work over (the calling thread included)
+         * @details dst container must be different from the src container
+         */
+        template <typename SrcT, typename DstT>
+        static
+        void copy_corner_turn(const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t num_input_outerloop_elements
+               , std::size_t output_stride
+               , utils::WorkerPool& pool);
+
+    private:
+        /**
+         * @brief corner turn the rows [outer_begin, outer_end) of the input
+         */
+        template <typename SrcT, typename DstT>
+        static
+        void copy_corner_turn_rows(const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t output_stride
+               , std::size_t outer_begin
+               , std::size_t outer_end);
+
+        /**
+         * @brief recursively tile the aligned block [outer_begin, outer_end) x [inner_begin, inner_end)
+         */
+        template <typename SrcT, typename DstT>
+        static
+        void copy_corner_turn_block(const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t output_stride
+               , std::size_t outer_begin
+               , std::size_t outer_end
+               , std::size_t inner_begin
+               , std::size_t inner_end);
+
+        static constexpr std::size_t cache_block_size();
+};
+
+
+} // namespace cpu
+} // namespace corner_turn
+} // namespace cheetah
+} // namespace ska
+#include "detail/ParallelCpuCornerTurnAlgo.cpp"
+
+#endif // SKA_CHEETAH_CORNER_TURN_CPU_PARALLELCPUCORNERTURNALGO_H
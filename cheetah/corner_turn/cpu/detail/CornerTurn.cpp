@@ -25,6 +25,7 @@
 #define SKA_CHEETAH_CORNER_TURN_CPU_CORNERTURNARCHHELPER_H
 
 #include "cheetah/corner_turn/cpu/BatchedCpuCornerTurnAlgo.h"
+#include "cheetah/corner_turn/cpu/ParallelCpuCornerTurnAlgo.h"
 #include "cheetah/corner_turn/cpu/StandardCpuBatcher.h"
 
 namespace ska {
@@ -68,6 +69,23 @@ void corner_turn(SourceIteratorT&& src_it
                           , num_input_outerloop_elements);
 }
 
+template<typename SrcT, typename DstT>
+void parallel_corner_turn(SrcT const* data_in
+                        , DstT* data_out
+                        , std::size_t num_input_innerloop_elements
+                        , std::size_t num_input_outerloop_elements
+                        , std::size_t output_stride
+                        , utils::WorkerPool& pool)
+{
+    cpu::ParallelCpuCornerTurnAlgo<detail::BatcherTraits>::copy_corner_turn(
+              data_in
+            , data_out
+            , num_input_innerloop_elements
+            , num_input_outerloop_elements
+            , output_stride
+            , pool);
+}
+
 } // namespace cpu
 } // namespace corner_turn
 } // namespace cheetah
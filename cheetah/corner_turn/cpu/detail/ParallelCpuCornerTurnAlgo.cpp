@@ -0,0 +1,160 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+
+namespace ska {
+namespace cheetah {
+namespace corner_turn {
+namespace cpu {
+
+template<class TraitsT>
+constexpr std::size_t ParallelCpuCornerTurnAlgo<TraitsT>::cache_block_size()
+{
+    return 4 * TraitsT::CpuTraits::nelements_per_cache_lane;
+}
+
+template<class TraitsT>
+template <typename SrcT, typename DstT>
+void ParallelCpuCornerTurnAlgo<TraitsT>::copy_corner_turn(
+                 const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t num_input_outerloop_elements
+               , std::size_t output_stride
+               , utils::WorkerPool& pool)
+{
+    typedef typename TraitsT::CpuTraits CpuTraits;
+    static constexpr std::size_t lane = CpuTraits::nelements_per_cache_lane;
+
+    // split the outer dimension into lane aligned ranges, one per thread
+    std::size_t const number_of_lanes = (num_input_outerloop_elements + lane - 1)/lane;
+    std::size_t const number_of_ranges = std::max<std::size_t>(1, std::min<std::size_t>(pool.number_of_threads(), number_of_lanes));
+    std::size_t const lanes_per_range = number_of_lanes / number_of_ranges;
+    std::size_t const extra_lanes = number_of_lanes % number_of_ranges;
+
+    pool.run(number_of_ranges, [&](std::size_t range)
+                               {
+                                   std::size_t const outer_begin = (range * lanes_per_range + std::min(range, extra_lanes)) * lane;
+                                   std::size_t const outer_end = std::min(num_input_outerloop_elements, outer_begin + (lanes_per_range + (range < extra_lanes ? 1 : 0)) * lane);
+                                   copy_corner_turn_rows(data_in, data_out, num_input_innerloop_elements, output_stride, outer_begin, outer_end);
+                               });
+}
+
+template<class TraitsT>
+template <typename SrcT, typename DstT>
+void ParallelCpuCornerTurnAlgo<TraitsT>::copy_corner_turn_rows(
+                 const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t output_stride
+               , std::size_t outer_begin
+               , std::size_t outer_end)
+{
+    typedef typename TraitsT::CpuTraits CpuTraits;
+    static constexpr std::size_t lane = CpuTraits::nelements_per_cache_lane;
+
+    std::size_t const aligned_outer_end = outer_begin + ((outer_end - outer_begin) / lane) * lane;
+    std::size_t const aligned_inner_end = (num_input_innerloop_elements / lane) * lane;
+
+    if(aligned_outer_end > outer_begin && aligned_inner_end > 0)
+    {
+        copy_corner_turn_block(data_in, data_out, num_input_innerloop_elements, output_stride
+                              , outer_begin, aligned_outer_end, 0, aligned_inner_end);
+    }
+
+    // columns that do not fill a complete tile
+    for(std::size_t outerloop_element=outer_begin; outerloop_element < aligned_outer_end; ++outerloop_element)
+    {
+        for(std::size_t innerloop_element=aligned_inner_end; innerloop_element < num_input_innerloop_elements; ++innerloop_element)
+        {
+            data_out[output_stride*innerloop_element+outerloop_element] = (DstT)data_in[num_input_innerloop_elements*outerloop_element+innerloop_element];
+        }
+    }
+
+    // rows that do not fill a complete tile (only ever in the last range)
+    for(std::size_t outerloop_element=aligned_outer_end; outerloop_element < outer_end; ++outerloop_element)
+    {
+        for(std::size_t innerloop_element=0; innerloop_element < num_input_innerloop_elements; ++innerloop_element)
+        {
+            data_out[output_stride*innerloop_element+outerloop_element] = (DstT)data_in[num_input_innerloop_elements*outerloop_element+innerloop_element];
+        }
+    }
+}
+
+template<class TraitsT>
+template <typename SrcT, typename DstT>
+void ParallelCpuCornerTurnAlgo<TraitsT>::copy_corner_turn_block(
+                 const SrcT* data_in
+               , DstT* data_out
+               , std::size_t num_input_innerloop_elements
+               , std::size_t output_stride
+               , std::size_t outer_begin
+               , std::size_t outer_end
+               , std::size_t inner_begin
+               , std::size_t inner_end)
+{
+    typedef typename TraitsT::CpuTraits CpuTraits;
+    static constexpr std::size_t lane = CpuTraits::nelements_per_cache_lane;
+
+    std::size_t const outer_size = outer_end - outer_begin;
+    std::size_t const inner_size = inner_end - inner_begin;
+
+    if(outer_size <= cache_block_size() && inner_size <= cache_block_size())
+    {
+        for(std::size_t outerloop_element=outer_begin; outerloop_element < outer_end; outerloop_element+=lane)
+        {
+            for(std::size_t innerloop_element=inner_begin; innerloop_element < inner_end; innerloop_element+=lane)
+            {
+                // the batcher uses its num_input_outerloop_elements argument only as the output row stride
+                TraitsT::BatchOptimiser::batched_corner_turn(
+                                 data_in
+                               , data_out
+                               , num_input_innerloop_elements
+                               , output_stride
+                               , innerloop_element
+                               , outerloop_element);
+            }
+        }
+        return;
+    }
+
+    // split the longest dimension (on a tile boundary) and recurse
+    if(outer_size >= inner_size)
+    {
+        std::size_t const split = outer_begin + (outer_size / lane / 2) * lane;
+        copy_corner_turn_block(data_in, data_out, num_input_innerloop_elements, output_stride, outer_begin, split, inner_begin, inner_end);
+        copy_corner_turn_block(data_in, data_out, num_input_innerloop_elements, output_stride, split, outer_end, inner_begin, inner_end);
+    }
+    else
+    {
+        std::size_t const split = inner_begin + (inner_size / lane / 2) * lane;
+        copy_corner_turn_block(data_in, data_out, num_input_innerloop_elements, output_stride, outer_begin, outer_end, inner_begin, split);
+        copy_corner_turn_block(data_in, data_out, num_input_innerloop_elements, output_stride, outer_begin, outer_end, split, inner_end);
+    }
+}
+
+} // namespace cpu
+} // namespace corner_turn
+} // namespace cheetah
+} // namespace ska
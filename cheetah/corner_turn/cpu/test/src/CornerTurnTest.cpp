@@ -47,6 +47,22 @@ struct CornerTurnTesterTraits
     }
 };
 
+template<typename SrcT, typename DstT>
+struct ParallelCornerTurnTesterTraits
+{
+    typedef SrcT SrcType;
+    typedef DstT DstType;
+    typedef Cpu Architecture;
+
+    template<typename SrcIteratorT, typename DstIteratorT>
+    static inline
+    void corner_turn(SrcIteratorT&& src_it, DstIteratorT&& dst_it, std::size_t num_input_innerloop_elements, std::size_t num_input_outerloop_elements)
+    {
+        utils::WorkerPool pool(3);
+        cpu::parallel_corner_turn(&(*src_it), &(*dst_it), num_input_innerloop_elements, num_input_outerloop_elements, num_input_outerloop_elements, pool);
+    }
+};
+
 } // namespace test
 } // namespace cpu
 } // namespace corner_turn
@@ -71,6 +87,15 @@ typedef ::testing::Types
     >  CpuTesterTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(CornerTurnTest, CornerTurnTester, CpuTesterTypes);
 
+typedef ::testing::Types
+    < corner_turn::cpu::test::ParallelCornerTurnTesterTraits<uint8_t, uint8_t>
+    , corner_turn::cpu::test::ParallelCornerTurnTesterTraits<uint16_t, uint16_t>
+    , corner_turn::cpu::test::ParallelCornerTurnTesterTraits<uint8_t, uint16_t>
+    , corner_turn::cpu::test::ParallelCornerTurnTesterTraits<uint8_t, float>
+    , corner_turn::cpu::test::ParallelCornerTurnTesterTraits<float, float>
+    >  ParallelCpuTesterTypes;
+INSTANTIATE_TYPED_TEST_SUITE_P(ParallelCornerTurnTest, CornerTurnTester, ParallelCpuTesterTypes);
+
 } // namespace test
 } // namespace corner_turn
 } // namespace cheetah
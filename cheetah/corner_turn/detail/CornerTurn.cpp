@@ -118,6 +118,27 @@ void corner_turn( SourceIteratorT&& src_it
                           , num_input_outerloop_elements);
 }
 
+template <typename SrcT, typename DstT>
+void parallel_corner_turn( SrcT const* data_in
+                         , DstT* data_out
+                         , std::size_t num_input_innerloop_elements
+                         , std::size_t num_input_outerloop_elements
+                         , std::size_t output_stride
+                         , utils::WorkerPool& pool)
+{
+#ifndef SKA_CHEETAH_ENABLE_NASM
+    cpu::parallel_corner_turn(
+#else // SKA_CHEETAH_ENABLE_NASM
+    nasm::parallel_corner_turn(
+#endif // SKA_CHEETAH_ENABLE_NASM
+                              data_in
+                            , data_out
+                            , num_input_innerloop_elements
+                            , num_input_outerloop_elements
+                            , output_stride
+                            , pool);
+}
+
 } // namespace corner_turn
 } // namespace cheetah
 } // namespace ska
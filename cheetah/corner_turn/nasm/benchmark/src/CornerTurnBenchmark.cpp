@@ -0,0 +1,164 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/corner_turn/nasm/CornerTurn.h"
+#include "cheetah/corner_turn/cpu/CornerTurn.h"
+#include "cheetah/utils/benchmark_utils/KernelBenchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+/**
+ * Micro benchmarks comparing the nasm corner turn kernels with their C++ fallbacks.
+ * Each benchmark turns a (samples x channels) TF block into a (channels x samples) FT block.
+ *
+ * Arguments: {number of channels, number of samples[, number of threads]}
+ */
+
+namespace ska {
+namespace cheetah {
+namespace corner_turn {
+namespace benchmark {
+
+namespace {
+
+template<typename SrcT, typename DstT>
+struct CornerTurnFixture
+{
+    CornerTurnFixture(::benchmark::State const& state)
+        : channels(static_cast<std::size_t>(state.range(0)))
+        , samples(static_cast<std::size_t>(state.range(1)))
+        , src(channels * samples)
+        , dst(channels * samples)
+    {
+        std::size_t i=0;
+        std::generate(src.begin(), src.end(), [&i]() { return static_cast<SrcT>(i++ % 251); });
+    }
+
+    void set_counters(::benchmark::State& state) const
+    {
+        utils::benchmark_utils::set_kernel_counters(state
+                                                   , channels * samples * (sizeof(SrcT) + sizeof(DstT))
+                                                   , channels * samples);
+    }
+
+    std::size_t channels;
+    std::size_t samples;
+    std::vector<SrcT> src;
+    std::vector<DstT> dst;
+};
+
+} // namespace
+
+template<typename SrcT, typename DstT>
+static void BM_nasm_corner_turn(::benchmark::State& state)
+{
+    CornerTurnFixture<SrcT, DstT> f(state);
+    for(auto _ : state) {
+        nasm::corner_turn(f.src.begin(), f.dst.begin(), f.channels, f.samples);
+        ::benchmark::DoNotOptimize(f.dst.data());
+        ::benchmark::ClobberMemory();
+    }
+    f.set_counters(state);
+}
+
+template<typename SrcT, typename DstT>
+static void BM_cpu_corner_turn(::benchmark::State& state)
+{
+    CornerTurnFixture<SrcT, DstT> f(state);
+    for(auto _ : state) {
+        cpu::corner_turn(f.src.begin(), f.dst.begin(), f.channels, f.samples);
+        ::benchmark::DoNotOptimize(f.dst.data());
+        ::benchmark::ClobberMemory();
+    }
+    f.set_counters(state);
+}
+
+template<typename SrcT, typename DstT>
+static void BM_nasm_parallel_corner_turn(::benchmark::State& state)
+{
+    CornerTurnFixture<SrcT, DstT> f(state);
+    utils::WorkerPool pool(static_cast<unsigned>(state.range(2)));
+    for(auto _ : state) {
+        nasm::parallel_corner_turn(f.src.data(), f.dst.data(), f.channels, f.samples, f.samples, pool);
+        ::benchmark::DoNotOptimize(f.dst.data());
+        ::benchmark::ClobberMemory();
+    }
+    f.set_counters(state);
+}
+
+template<typename SrcT, typename DstT>
+static void BM_cpu_parallel_corner_turn(::benchmark::State& state)
+{
+    CornerTurnFixture<SrcT, DstT> f(state);
+    utils::WorkerPool pool(static_cast<unsigned>(state.range(2)));
+    for(auto _ : state) {
+        cpu::parallel_corner_turn(f.src.data(), f.dst.data(), f.channels, f.samples, f.samples, pool);
+        ::benchmark::DoNotOptimize(f.dst.data());
+        ::benchmark::ClobberMemory();
+    }
+    f.set_counters(state);
+}
+
+static void serial_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"channels", "samples"});
+    for(int64_t channels : {1024, 4096, 8192}) {
+        for(int64_t samples : {1024, 16384}) {
+            b->Args({channels, samples});
+        }
+    }
+    b->Unit(::benchmark::kMicrosecond)->UseRealTime();
+}
+
+static void parallel_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"channels", "samples", "threads"});
+    int64_t const max_threads = std::max(1U, std::thread::hardware_concurrency());
+    for(int64_t channels : {4096, 8192}) {
+        for(int64_t threads = 1; threads <= max_threads; threads *= 2) {
+            b->Args({channels, 16384, threads});
+        }
+    }
+    b->Unit(::benchmark::kMicrosecond)->UseRealTime();
+}
+
+BENCHMARK_TEMPLATE(BM_nasm_corner_turn, uint8_t, uint8_t)->Apply(serial_sweep);
+BENCHMARK_TEMPLATE(BM_cpu_corner_turn, uint8_t, uint8_t)->Apply(serial_sweep);
+BENCHMARK_TEMPLATE(BM_nasm_corner_turn, uint16_t, uint16_t)->Apply(serial_sweep);
+BENCHMARK_TEMPLATE(BM_cpu_corner_turn, uint16_t, uint16_t)->Apply(serial_sweep);
+BENCHMARK_TEMPLATE(BM_nasm_corner_turn, uint8_t, uint16_t)->Apply(serial_sweep);
+BENCHMARK_TEMPLATE(BM_cpu_corner_turn, uint8_t, uint16_t)->Apply(serial_sweep);
+
+BENCHMARK_TEMPLATE(BM_nasm_parallel_corner_turn, uint8_t, uint8_t)->Apply(parallel_sweep);
+BENCHMARK_TEMPLATE(BM_cpu_parallel_corner_turn, uint8_t, uint8_t)->Apply(parallel_sweep);
+BENCHMARK_TEMPLATE(BM_nasm_parallel_corner_turn, uint8_t, uint16_t)->Apply(parallel_sweep);
+BENCHMARK_TEMPLATE(BM_cpu_parallel_corner_turn, uint8_t, uint16_t)->Apply(parallel_sweep);
+
+} // namespace benchmark
+} // namespace corner_turn
+} // namespace cheetah
+} // namespace ska
+
+CHEETAH_KERNEL_BENCHMARK_MAIN()
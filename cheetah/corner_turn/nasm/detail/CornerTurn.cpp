@@ -1,5 +1,6 @@
 #include "cheetah/corner_turn/nasm/detail/NasmBatcher.h"
 #include "cheetah/corner_turn/cpu/BatchedCpuCornerTurnAlgo.h"
+#include "cheetah/corner_turn/cpu/ParallelCpuCornerTurnAlgo.h"
 
 namespace ska {
 namespace cheetah {
@@ -42,6 +43,23 @@ void corner_turn( SourceIteratorT&& src_it
                           , num_input_outerloop_elements);
 }
 
+template<typename SrcT, typename DstT>
+void parallel_corner_turn(SrcT const* data_in
+                        , DstT* data_out
+                        , std::size_t num_input_innerloop_elements
+                        , std::size_t num_input_outerloop_elements
+                        , std::size_t output_stride
+                        , utils::WorkerPool& pool)
+{
+    cpu::ParallelCpuCornerTurnAlgo<BatcherTraits>::copy_corner_turn(
+              data_in
+            , data_out
+            , num_input_innerloop_elements
+            , num_input_outerloop_elements
+            , output_stride
+            , pool);
+}
+
 } // namespace nasm
 } // namespace corner_turn
 } // namespace cheetah
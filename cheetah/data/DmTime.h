@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <list>
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -57,6 +58,12 @@ namespace detail {
  *             act as an aggregation buffer for passing DmTrials between processing
  *             algorithms.
  *
+ *             In contiguous storage mode (see contiguous()) the DmTrials are not kept. Instead
+ *             their samples are appended to a single DM-major buffer preallocated to hold
+ *             dump_time() seconds of data for each DM. Each DM occupies a row of stride() samples
+ *             used as a ring, so the oldest samples are overwritten once a row is full. Slices
+ *             then refer to the rows directly (a pointer and a stride) without any copying.
+ *
  *             A typical use case for the DmTime class is as follows:
  *
  * @code       //Create a new instance
@@ -101,6 +108,9 @@ class DmTime
         typedef detail::DmTimeIterator<SelfType> Iterator;
         typedef detail::DmTimeIterator<SelfType const> ConstIterator;
         typedef typename DmTrialsType::TimeType Seconds;
+        typedef typename DmTrialsType::ValueType NumericalRep;
+        typedef typename DmTrialsType::DmType DmType;
+        typedef typename DmTrialsType::DmTrialType::TimeType TimeType;
 
     public:
         ~DmTime();
@@ -111,10 +121,65 @@ class DmTime
          *             in order based upon the start_time() method of the
          *             DmTime object.
          *
+         *             In contiguous storage mode the samples are copied into the buffer instead.
+         *             The DmTrials must then be added in time order, with the same DMs in each.
+         *
          * @param[in]  data  The data to be added
          */
         void add(ValueType data);
 
+        /**
+         * @brief      Select contiguous storage (must be set before any data is added)
+         */
+        void contiguous(bool enable);
+
+        /**
+         * @brief      true if the data are stored contiguously
+         */
+        bool contiguous() const;
+
+        /**
+         * @brief      the number of DM trials stored
+         */
+        std::size_t number_of_dms() const;
+
+        /**
+         * @brief      pointer to the row of samples for the given DM (contiguous storage only)
+         * @details    The samples of the row are in ring order, starting at first_sample(dm_idx)
+         */
+        NumericalRep const* dm_data(std::size_t dm_idx) const;
+
+        /**
+         * @brief      the distance (in samples) between the rows of consecutive DMs (contiguous storage only)
+         */
+        std::size_t stride() const;
+
+        /**
+         * @brief      the position in its row of the oldest sample of the given DM (contiguous storage only)
+         * @details    0 unless the row has wrapped around
+         */
+        std::size_t first_sample(std::size_t dm_idx) const;
+
+        /**
+         * @brief      the number of samples stored for the given DM (contiguous storage only)
+         */
+        std::size_t number_of_samples(std::size_t dm_idx) const;
+
+        /**
+         * @brief      the capacity (in samples) of the row for the given DM (contiguous storage only)
+         */
+        std::size_t capacity(std::size_t dm_idx) const;
+
+        /**
+         * @brief      the DM value of the given DM trial (contiguous storage only)
+         */
+        DmType dm(std::size_t dm_idx) const;
+
+        /**
+         * @brief      the sampling interval of the given DM trial (contiguous storage only)
+         */
+        TimeType sampling_interval(std::size_t dm_idx) const;
+
         /**
          * @brief      Clear the DmTime
          */
@@ -173,8 +238,31 @@ class DmTime
         friend panda::DataChunk<SelfType>;
         DmTime();
 
+        /**
+         * @brief      append the samples of data to the rows of the contiguous buffer
+         */
+        void append(DmTrialsType const& data);
+
+    private:
+        /**
+         * @brief      the layout and fill state of each DM row in the contiguous buffer
+         */
+        struct Row
+        {
+            DmType dm;
+            TimeType sampling_interval;
+            std::size_t capacity;       // samples
+            std::size_t write_position; // next sample to write
+            std::size_t size;           // samples stored
+        };
+
     private:
         ContainerType _data;
+        bool _contiguous;
+        std::vector<NumericalRep> _samples;
+        std::vector<Row> _rows;
+        std::size_t _stride;
+        typename DmTrialsType::Mjd _last_start_time;
         std::mutex _m;
         std::condition_variable _cv;
         bool _ready;
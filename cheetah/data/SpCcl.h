@@ -33,6 +33,7 @@
 #include <vector>
 #include <utility>
 #include <deque>
+#include <memory>
 
 namespace ska {
 namespace cheetah {
@@ -45,16 +46,22 @@ namespace data {
  * @details
  *      Class that  encapsulates the snippets of data corresponding to each single pulse candidate.
  *      One can also go through each candidate and the correponding TF slice using VectorLike functionalities.
+ *      A list that is owned by a std::shared_ptr can be recovered from a reference with weak_from_this(),
+ *      so consumers handed a reference can share ownership rather than copy it.
  */
 
 template<typename NumericalRep>
 class SpCcl
     //: public ska::panda::DataChunk<SpCcl<NumericalRep>>
+    : public std::enable_shared_from_this<SpCcl<NumericalRep>>
 {
     public:
         typedef SpCandidate<Cpu, float> SpCandidateType;
         typedef SpCandidateType::Dm Dm;
         typedef data::DmTrials<cheetah::Cpu, float> DmTrialsType;
+        typedef SpCandidateType::MsecTimeType MsecTimeType;
+        typedef typename std::vector<SpCandidateType>::iterator Iterator;
+        typedef typename std::vector<SpCandidateType>::const_iterator ConstIterator;
     //private:
     //    typedef std::vector<SpCandidateType> InnerType;
     //    typedef VectorLike<InnerType> BaseT;
@@ -108,6 +115,7 @@ class SpCcl
 
         /// the start time of the first relevant data (taking into account the offset)
         utils::ModifiedJulianClock::time_point const& start_time() const;
+        void start_time(utils::ModifiedJulianClock::time_point const& start_time);
 
         /**
          * @brief the time duration from the beginning of the first block to start_time()
@@ -126,13 +134,74 @@ class SpCcl
 
         std::size_t size() const;
 
+        /**
+         * @brief true if there are no candidates
+         */
+        bool empty() const;
+
+        /**
+         * @brief access to the candidates
+         */
+        SpCandidateType const& operator[](std::size_t n) const;
+        SpCandidateType& operator[](std::size_t n);
+        Iterator begin();
+        ConstIterator begin() const;
+        ConstIterator cbegin() const;
+        Iterator end();
+        ConstIterator end() const;
+        ConstIterator cend() const;
+
+        /**
+         * @brief reserve space for n candidates
+         */
+        void reserve(std::size_t n);
+
+        /**
+         * @brief truncate the list to the first n candidates
+         */
+        void resize(std::size_t n);
+
+        /**
+         * @brief remove all the candidates
+         */
+        void clear();
+
+        /**
+         * @brief remove all the candidates and take the timing information from new data
+         * @details the candidate storage is kept, so a recycled list can be refilled without allocating
+         */
+        void reset(std::shared_ptr<DmTrialsType> const& data);
+
+        /**
+         * @brief remove all candidates for which the predicate returns true
+         */
+        template<typename PredicateT>
+        void remove_if(PredicateT&& predicate);
+
+        /**
+         * @brief the sampling interval of the data that was searched (zero if unknown)
+         */
+        MsecTimeType sample_interval() const;
+        void sample_interval(MsecTimeType const& interval);
+
+        /**
+         * @brief the time span of the data that was searched, measured from start_time() (zero if unknown)
+         */
+        MsecTimeType duration() const;
+        void duration(MsecTimeType const& duration);
+
     protected:
         void dm_max_min(Dm);
 
+        /// recalculate the dm range after candidates have been removed
+        void reset_dm_range();
+
     private:
         std::pair<Dm, Dm> _dm_range;
         utils::ModifiedJulianClock::time_point _start_time;
         boost::units::quantity<data::MilliSeconds,double> _offset_time;
+        MsecTimeType _sample_interval;
+        MsecTimeType _duration;
         std::vector<SpCandidateType> _data;
 };
 
@@ -22,6 +22,10 @@
  * SOFTWARE.
  */
 #include "cheetah/data/DmTime.h"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
 #include <type_traits>
 
 namespace ska {
@@ -49,7 +53,9 @@ bool DmTimeStartTimeComparitor<DmTrialsType>::operator()(const ElementType &lhs,
 
 template <typename DmTrialsType>
 DmTime<DmTrialsType>::DmTime()
-: _ready(false)
+: _contiguous(false)
+, _stride(0)
+, _ready(false)
 , _dump_time(540.0*data::seconds)
 {
 }
@@ -62,6 +68,12 @@ DmTime<DmTrialsType>::~DmTime()
 template <typename DmTrialsType>
 void DmTime<DmTrialsType>::add(ValueType data)
 {
+    if (_contiguous)
+    {
+        append(*data);
+        return;
+    }
+
     //First determine where in the list this block should be
     auto it = std::upper_bound(_data.begin(),_data.end(),data,detail::DmTimeStartTimeComparitor<DmTrialsType>());
 
@@ -69,10 +81,138 @@ void DmTime<DmTrialsType>::add(ValueType data)
     _data.insert(it,data);
 }
 
+template <typename DmTrialsType>
+void DmTime<DmTrialsType>::append(DmTrialsType const& data)
+{
+    if (_rows.empty())
+    {
+        // take the layout from the first block, with space for dump_time of each DM
+        _stride = 0;
+        for (std::size_t dm_idx=0; dm_idx<data.size(); ++dm_idx)
+        {
+            auto const& trial = data[dm_idx];
+            std::size_t const capacity = std::max<std::size_t>(trial.size(),
+                                             std::ceil(_dump_time.value() / trial.sampling_interval().value()));
+            _rows.push_back(Row{trial.dm(), trial.sampling_interval(), capacity, 0, 0});
+            _stride = std::max(_stride, capacity);
+        }
+        _samples.resize(_stride * _rows.size());
+    }
+    else
+    {
+        if (data.size() != _rows.size())
+        {
+            throw std::runtime_error("DmTrials added to contiguous DmTime object with a different number of DMs.");
+        }
+        if (data.start_time() < _last_start_time)
+        {
+            throw std::runtime_error("DmTrials must be added to a contiguous DmTime object in time order.");
+        }
+    }
+    _last_start_time = data.start_time();
+
+    for (std::size_t dm_idx=0; dm_idx<_rows.size(); ++dm_idx)
+    {
+        Row& row = _rows[dm_idx];
+        auto const& trial = data[dm_idx];
+        NumericalRep* row_data = _samples.data() + dm_idx * _stride;
+
+        // only the last capacity samples will remain in the row
+        std::size_t const count = trial.size();
+        std::size_t const skip = (count > row.capacity) ? count - row.capacity : 0;
+        auto it = trial.begin();
+        std::advance(it, skip);
+        row.write_position = (row.write_position + skip) % row.capacity;
+
+        std::size_t remaining = count - skip;
+        while (remaining)
+        {
+            std::size_t const copy_count = std::min(remaining, row.capacity - row.write_position);
+            std::copy_n(it, copy_count, row_data + row.write_position);
+            std::advance(it, copy_count);
+            remaining -= copy_count;
+            row.write_position = (row.write_position + copy_count) % row.capacity;
+        }
+        row.size = std::min(row.capacity, row.size + count);
+    }
+}
+
 template <typename DmTrialsType>
 void DmTime<DmTrialsType>::clear()
 {
     _data.clear();
+    // keep the contiguous buffer allocated for reuse
+    _rows.clear();
+    _last_start_time = typename DmTrialsType::Mjd();
+}
+
+template <typename DmTrialsType>
+void DmTime<DmTrialsType>::contiguous(bool enable)
+{
+    if (!_data.empty() || !_rows.empty())
+    {
+        throw std::runtime_error("DmTime storage mode must be selected before adding data.");
+    }
+    _contiguous = enable;
+}
+
+template <typename DmTrialsType>
+bool DmTime<DmTrialsType>::contiguous() const
+{
+    return _contiguous;
+}
+
+template <typename DmTrialsType>
+std::size_t DmTime<DmTrialsType>::number_of_dms() const
+{
+    if (_contiguous)
+        return _rows.size();
+    if (_data.empty())
+        return 0;
+    return _data.front()->size();
+}
+
+template <typename DmTrialsType>
+typename DmTime<DmTrialsType>::NumericalRep const* DmTime<DmTrialsType>::dm_data(std::size_t dm_idx) const
+{
+    return _samples.data() + dm_idx * _stride;
+}
+
+template <typename DmTrialsType>
+std::size_t DmTime<DmTrialsType>::stride() const
+{
+    return _stride;
+}
+
+template <typename DmTrialsType>
+std::size_t DmTime<DmTrialsType>::first_sample(std::size_t dm_idx) const
+{
+    Row const& row = _rows[dm_idx];
+    return (row.size < row.capacity) ? 0 : row.write_position;
+}
+
+template <typename DmTrialsType>
+std::size_t DmTime<DmTrialsType>::number_of_samples(std::size_t dm_idx) const
+{
+    return _rows[dm_idx].size;
+}
+
+template <typename DmTrialsType>
+std::size_t DmTime<DmTrialsType>::capacity(std::size_t dm_idx) const
+{
+    return _rows[dm_idx].capacity;
+}
+
+template <typename DmTrialsType>
+typename DmTime<DmTrialsType>::DmType DmTime<DmTrialsType>::dm(std::size_t dm_idx) const
+{
+    return _rows[dm_idx].dm;
+}
+
+template <typename DmTrialsType>
+typename DmTime<DmTrialsType>::TimeType DmTime<DmTrialsType>::sampling_interval(std::size_t dm_idx) const
+{
+    return _rows[dm_idx].sampling_interval;
 }
 
 template <typename DmTrialsType>
@@ -90,17 +230,13 @@ typename DmTime<DmTrialsType>::ConstIterator DmTime<DmTrialsType>::cbegin(std::s
 template <typename DmTrialsType>
 typename DmTime<DmTrialsType>::Iterator DmTime<DmTrialsType>::end()
 {
-    if (_data.empty())
-        return Iterator(0,0,this->shared_from_this());
-    return Iterator(_data.front()->size(),0,this->shared_from_this());
+    return Iterator(number_of_dms(),0,this->shared_from_this());
 }
 
 template <typename DmTrialsType>
 typename DmTime<DmTrialsType>::ConstIterator DmTime<DmTrialsType>::cend() const
 {
-    if (_data.empty())
-        return ConstIterator(0,0,this->shared_from_this());
-    return ConstIterator(_data.front()->size(),0,this->shared_from_this());
+    return ConstIterator(number_of_dms(),0,this->shared_from_this());
 }
 
 template <typename DmTrialsType>
@@ -28,6 +28,11 @@ DmTimeDm<DmTimeType>::~DmTimeDm()
 template <typename DmTimeType>
 std::size_t DmTimeDm<DmTimeType>::number_of_samples() const
 {
+    auto const& dm_time = _parent->dm_time();
+    if (dm_time.contiguous())
+    {
+        return dm_time.number_of_samples(_dm_idx);
+    }
     std::size_t sample_count = 0;
     for (auto const& block: _parent->blocks())
         sample_count += block->operator[](_dm_idx).size();
@@ -37,6 +42,15 @@ std::size_t DmTimeDm<DmTimeType>::number_of_samples() const
 template <typename DmTimeType>
 data::DedispersionMeasureType<float> DmTimeDm<DmTimeType>::dm() const
 {
+    auto const& dm_time = _parent->dm_time();
+    if (dm_time.contiguous())
+    {
+        if (dm_time.number_of_dms() == 0)
+        {
+            throw std::runtime_error("Requested DM from empty DmTime object.");
+        }
+        return dm_time.dm(_dm_idx);
+    }
     if ( _parent->blocks().empty())
     {
         throw std::runtime_error("Requested DM from empty DmTime object.");
@@ -47,6 +61,15 @@ data::DedispersionMeasureType<float> DmTimeDm<DmTimeType>::dm() const
 template <typename DmTimeType>
 typename DmTimeDm<DmTimeType>::TimeType DmTimeDm<DmTimeType>::sampling_interval() const
 {
+    auto const& dm_time = _parent->dm_time();
+    if (dm_time.contiguous())
+    {
+        if (dm_time.number_of_dms() == 0)
+        {
+            throw std::runtime_error("Requested sampling interval from empty DmTime object.");
+        }
+        return dm_time.sampling_interval(_dm_idx);
+    }
     if ( _parent->blocks().empty())
     {
         throw std::runtime_error("Requested sampling interval from empty DmTime object.");
@@ -58,6 +81,23 @@ template <typename DmTimeType>
 template <typename TimeSeriesType>
 typename TimeSeriesType::Iterator DmTimeDm<DmTimeType>::copy_to(TimeSeriesType& timeseries) const
 {
+    auto const& dm_time = _parent->dm_time();
+    if (dm_time.contiguous())
+    {
+        if (dm_time.number_of_dms() == 0)
+        {
+            throw std::runtime_error("Requested copy from empty DmTime object.");
+        }
+        timeseries.sampling_interval(dm_time.sampling_interval(_dm_idx));
+        std::size_t const count = std::min(timeseries.size(), dm_time.number_of_samples(_dm_idx));
+
+        // the row is a ring: copy from first_sample() to the end of the row and then from its start
+        auto const* row = dm_time.dm_data(_dm_idx);
+        std::size_t const first = dm_time.first_sample(_dm_idx);
+        std::size_t const first_count = std::min(count, dm_time.capacity(_dm_idx) - first);
+        typename TimeSeriesType::Iterator it = panda::copy(row + first, row + first + first_count, timeseries.begin());
+        return panda::copy(row, row + (count - first_count), it);
+    }
     if ( _parent->blocks().empty())
     {
         throw std::runtime_error("Requested copy from empty DmTime object.");
@@ -35,16 +35,14 @@ typename DmTimeSlice<DmTimeType>::ConstIterator DmTimeSlice<DmTimeType>::cbegin(
 template <typename DmTimeType>
 typename DmTimeSlice<DmTimeType>::Iterator DmTimeSlice<DmTimeType>::end()
 {
-    // blocks is guaranteed to never be empty so front() will always return
-    std::size_t end_idx = std::min(blocks().front()->size(),_start_dm_idx+_number_dms_per_slice);
+    std::size_t end_idx = std::min(_parent->number_of_dms(),_start_dm_idx+_number_dms_per_slice);
     return Iterator(end_idx, this->shared_from_this());
 }
 
 template <typename DmTimeType>
 typename DmTimeSlice<DmTimeType>::ConstIterator DmTimeSlice<DmTimeType>::cend() const
 {
-    // blocks is guaranteed to never be empty so front() will always return
-    std::size_t end_idx = std::min(blocks().front()->size(),_start_dm_idx+_number_dms_per_slice);
+    std::size_t end_idx = std::min(_parent->number_of_dms(),_start_dm_idx+_number_dms_per_slice);
     return ConstIterator(end_idx, this->shared_from_this());
 }
 
@@ -54,6 +52,30 @@ typename DmTimeSlice<DmTimeType>::ContainerType const& DmTimeSlice<DmTimeType>::
     return _parent->blocks();
 }
 
+template <typename DmTimeType>
+std::size_t DmTimeSlice<DmTimeType>::number_of_dms() const
+{
+    return std::min(_parent->number_of_dms(),_start_dm_idx+_number_dms_per_slice) - _start_dm_idx;
+}
+
+template <typename DmTimeType>
+typename DmTimeSlice<DmTimeType>::NumericalRep const* DmTimeSlice<DmTimeType>::data() const
+{
+    return _parent->dm_data(_start_dm_idx);
+}
+
+template <typename DmTimeType>
+std::size_t DmTimeSlice<DmTimeType>::stride() const
+{
+    return _parent->stride();
+}
+
+template <typename DmTimeType>
+DmTimeType& DmTimeSlice<DmTimeType>::dm_time() const
+{
+    return *_parent;
+}
+
 } // namespace detail
 } // namespace data
 } // namespace cheetah
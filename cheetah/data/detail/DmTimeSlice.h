@@ -48,6 +48,10 @@ class DmTimeSliceIterator;
  *             storage implementation of blocks of DmTime objects. DmTimeSlice
  *             objects are passed to Tdas and Fdas for processing of blocks of DMs at
  *             a time in an async or sync task.
+ *
+ *             When the DmTime object uses contiguous storage the slice is simply a
+ *             pointer to the row of the first DM (data()) and the distance between
+ *             rows (stride()).
  */
 
 template <typename DmTimeType>
@@ -59,6 +63,7 @@ class DmTimeSlice: public panda::DataChunk<DmTimeSlice<DmTimeType>>
     public:
         typedef std::shared_ptr<DmTimeType> ParentType;
         typedef typename DmTimeType::ContainerType ContainerType;
+        typedef typename DmTimeType::NumericalRep NumericalRep;
         typedef DmTimeSliceIterator<SelfType> Iterator;
         typedef DmTimeSliceIterator<SelfType const> ConstIterator;
 
@@ -88,6 +93,27 @@ class DmTimeSlice: public panda::DataChunk<DmTimeSlice<DmTimeType>>
          */
         ContainerType const& blocks() const;
 
+        /**
+         * @brief      The number of DM trials in the slice
+         */
+        std::size_t number_of_dms() const;
+
+        /**
+         * @brief      Pointer to the row of samples of the first DM in the slice (contiguous storage only)
+         * @details    The row of each subsequent DM in the slice follows at intervals of stride() samples
+         */
+        NumericalRep const* data() const;
+
+        /**
+         * @brief      The distance (in samples) between the rows of consecutive DMs (contiguous storage only)
+         */
+        std::size_t stride() const;
+
+        /**
+         * @brief      The DmTime object the slice refers to
+         */
+        DmTimeType& dm_time() const;
+
     private:
         friend panda::DataChunk<SelfType>;
 
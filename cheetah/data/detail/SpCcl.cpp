@@ -37,6 +37,9 @@ template<typename NumericalRep>
 SpCcl<NumericalRep>::SpCcl()
     : _dm_range(Dm(std::numeric_limits<typename Dm::value_type>::max() * parsecs_per_cube_cm),
                 Dm(std::numeric_limits<typename Dm::value_type>::min() * parsecs_per_cube_cm))
+    , _offset_time(0.0*data::milliseconds)
+    , _sample_interval(0.0*data::milliseconds)
+    , _duration(0.0*data::milliseconds)
 {
 }
 
@@ -46,6 +49,8 @@ SpCcl<NumericalRep>::SpCcl(std::shared_ptr<DmTrialsType> const& data)
                 Dm(std::numeric_limits<typename Dm::value_type>::min() * parsecs_per_cube_cm))
     , _start_time(data->start_time())
     , _offset_time(0.0*data::milliseconds)
+    , _sample_interval(data->metadata().fundamental_sampling_interval())
+    , _duration(data->metadata().duration())
     , _data(0)
 {
 }
@@ -68,9 +73,21 @@ void SpCcl<NumericalRep>::dm_max_min(Dm dm)
     if(dm < _dm_range.first) _dm_range.first = dm;
 }
 
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::reset_dm_range()
+{
+    _dm_range = std::make_pair(Dm(std::numeric_limits<typename Dm::value_type>::max() * parsecs_per_cube_cm),
+                               Dm(std::numeric_limits<typename Dm::value_type>::min() * parsecs_per_cube_cm));
+    for(auto const& cand : _data)
+    {
+        dm_max_min(cand.dm());
+    }
+}
+
 template<typename NumericalRep>
 void SpCcl<NumericalRep>::push_back(SpCandidateType const& cand)
 {
+    dm_max_min(cand.dm());
     _data.push_back(cand);
 }
 
@@ -120,6 +137,12 @@ utils::ModifiedJulianClock::time_point const& SpCcl<NumericalRep>::start_time()
     return _start_time;
 }
 
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::start_time(utils::ModifiedJulianClock::time_point const& start_time)
+{
+    _start_time = start_time;
+}
+
 template<typename NumericalRep>
 utils::ModifiedJulianClock::time_point SpCcl<NumericalRep>::start_time(SpCandidateType const& cand) const
 {
@@ -138,6 +161,123 @@ std::size_t SpCcl<NumericalRep>::size() const
     return _data.size();
 }
 
+template<typename NumericalRep>
+bool SpCcl<NumericalRep>::empty() const
+{
+    return _data.empty();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::SpCandidateType const& SpCcl<NumericalRep>::operator[](std::size_t n) const
+{
+    return _data[n];
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::SpCandidateType& SpCcl<NumericalRep>::operator[](std::size_t n)
+{
+    return _data[n];
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::Iterator SpCcl<NumericalRep>::begin()
+{
+    return _data.begin();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::ConstIterator SpCcl<NumericalRep>::begin() const
+{
+    return _data.begin();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::ConstIterator SpCcl<NumericalRep>::cbegin() const
+{
+    return _data.cbegin();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::Iterator SpCcl<NumericalRep>::end()
+{
+    return _data.end();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::ConstIterator SpCcl<NumericalRep>::end() const
+{
+    return _data.end();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::ConstIterator SpCcl<NumericalRep>::cend() const
+{
+    return _data.cend();
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::reserve(std::size_t n)
+{
+    _data.reserve(n);
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::resize(std::size_t n)
+{
+    if(n >= _data.size()) return;
+    _data.erase(_data.begin() + n, _data.end());
+    reset_dm_range();
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::clear()
+{
+    _data.clear();
+    reset_dm_range();
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::reset(std::shared_ptr<DmTrialsType> const& data)
+{
+    clear();
+    _start_time = data->start_time();
+    _offset_time = 0.0*data::milliseconds;
+    _sample_interval = MsecTimeType(data->metadata().fundamental_sampling_interval());
+    _duration = MsecTimeType(data->metadata().duration());
+}
+
+template<typename NumericalRep>
+template<typename PredicateT>
+void SpCcl<NumericalRep>::remove_if(PredicateT&& predicate)
+{
+    _data.erase(std::remove_if(_data.begin(), _data.end(), std::forward<PredicateT>(predicate)), _data.end());
+    reset_dm_range();
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::MsecTimeType SpCcl<NumericalRep>::sample_interval() const
+{
+    return _sample_interval;
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::sample_interval(MsecTimeType const& interval)
+{
+    _sample_interval = interval;
+}
+
+template<typename NumericalRep>
+typename SpCcl<NumericalRep>::MsecTimeType SpCcl<NumericalRep>::duration() const
+{
+    return _duration;
+}
+
+template<typename NumericalRep>
+void SpCcl<NumericalRep>::duration(MsecTimeType const& duration)
+{
+    _duration = duration;
+}
+
 } // namespace data
 } // namespace cheetah
 } // namespace ska
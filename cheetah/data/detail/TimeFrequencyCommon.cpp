@@ -61,7 +61,7 @@ void TimeFrequencyCommon<DerivedType>::start_time(TimePointType const& start_tim
 template <class DerivedType>
 typename TimeFrequencyCommon<DerivedType>::TimePointType TimeFrequencyCommon<DerivedType>::end_time() const
 {
-    auto derived = static_cast<DerivedType const&>(*this);
+    auto const& derived = static_cast<DerivedType const&>(*this);
     return this->start_time() + (derived.number_of_spectra() - 1) * sample_interval();
 }
 
@@ -95,7 +95,7 @@ template <class DerivedType>
 void TimeFrequencyCommon<DerivedType>::set_channel_frequencies_const_width(TimeFrequencyCommon<DerivedType>::FrequencyType const& start,
                                               TimeFrequencyCommon<DerivedType>::FrequencyType const& delta)
 {
-    auto derived = static_cast<DerivedType const&>(*this);
+    auto const& derived = static_cast<DerivedType const&>(*this);
     this->_metadata.channel_frequencies_const_width(start, delta, data::DimensionSize<Frequency>(derived.number_of_channels()));
 }
 
@@ -52,6 +52,12 @@ TYPED_TEST(DmTimeTest, add_tests)
     Test::add_test();
 }
 
+TYPED_TEST(DmTimeTest, contiguous_tests)
+{
+    typedef Tester<typename TypeParam::Architecture, typename TypeParam::ValueType> Test;
+    Test::contiguous_test();
+}
+
 } // namespace test
 } // namespace data
 } // namespace cheetah
@@ -34,6 +34,7 @@ struct Tester
 {
     static void slice_test(std::size_t,std::size_t,std::size_t);
     static void add_test();
+    static void contiguous_test();
 };
 
 } // namespace test
@@ -123,6 +123,68 @@ void Tester<Arch,T>::add_test()
     }
 }
 
+template <typename Arch, typename T>
+void Tester<Arch,T>::contiguous_test()
+{
+    typedef data::DmTrials<Arch,T> DmTrialsType;
+    typedef typename DmTrialsType::TimeType TimeType;
+    std::size_t const ndms = 7;
+    std::size_t const nsamples = 10;
+    auto buffer = DmTime<DmTrialsType>::make_shared();
+    buffer->dump_time(TimeType(3.0*data::seconds)); // room for 3 blocks
+    buffer->contiguous(true);
+    ASSERT_TRUE(buffer->contiguous());
+    DmTrialsGeneratorUtil<DmTrialsType> trials_generator;
+
+    // 4 blocks so that the ring wraps around, dropping the first block
+    for (std::size_t block_idx=0; block_idx<4; ++block_idx)
+    {
+        auto trials = trials_generator.generate(TimeType(0.1*data::seconds),nsamples,ndms);
+        for (std::size_t dm_idx=0; dm_idx<ndms; ++dm_idx)
+        {
+            auto& trial = (*trials)[dm_idx];
+            for (std::size_t sample_idx=0; sample_idx<nsamples; ++sample_idx)
+            {
+                *(trial.begin()+sample_idx) = static_cast<T>(block_idx * nsamples + sample_idx + dm_idx);
+            }
+        }
+        buffer->add(trials);
+    }
+    ASSERT_TRUE(buffer->blocks().empty());
+    ASSERT_EQ(ndms, buffer->number_of_dms());
+    ASSERT_EQ(3 * nsamples, buffer->stride());
+
+    std::size_t dm_count = 0;
+    for (auto it = buffer->begin(3); it < buffer->end();  ++it )
+    {
+        auto slice = *it;
+        ASSERT_EQ(buffer->dm_data(dm_count), slice->data());
+        ASSERT_EQ(buffer->stride(), slice->stride());
+        for (auto slice_it = slice->begin(); slice_it != slice->end();  ++slice_it )
+        {
+            auto const dm = *slice_it;
+            ASSERT_EQ(3 * nsamples, dm.number_of_samples());
+            ASSERT_EQ(nsamples, buffer->first_sample(dm_count));
+            ASSERT_EQ(DmTrialsMetadata::DmType(dm_count * data::parsecs_per_cube_cm), dm.dm());
+
+            // the samples are copied out in time order
+            data::TimeSeries<Arch,T> timeseries(3 * nsamples);
+            auto end = dm.copy_to(timeseries);
+            ASSERT_EQ(std::distance(timeseries.begin(), end), static_cast<std::ptrdiff_t>(3 * nsamples));
+            for (std::size_t sample_idx=0; sample_idx<3 * nsamples; ++sample_idx)
+            {
+                ASSERT_EQ(static_cast<T>(nsamples + sample_idx + dm_count), *(timeseries.begin()+sample_idx));
+            }
+            ++dm_count;
+        }
+    }
+    ASSERT_EQ(ndms, dm_count);
+
+    // blocks out of time order are rejected
+    trials_generator.epoch(typename utils::ModifiedJulianClock::time_point(utils::julian_day(40000.0)));
+    ASSERT_THROW(buffer->add(trials_generator.generate(TimeType(0.1*data::seconds),nsamples,ndms)), std::runtime_error);
+}
+
 } // namespace test
 } // namespace data
 } // namespace cheetah
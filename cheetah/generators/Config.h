@@ -30,6 +30,7 @@
 #include "cheetah/generators/BasebandGaussianNoiseConfig.h"
 #include "cheetah/generators/DispersedPulseConfig.h"
 #include "cheetah/generators/PulsarInjectionConfig.h"
+#include "cheetah/generators/RfiScenarioConfig.h"
 
 namespace ska {
 namespace cheetah {
@@ -60,6 +61,10 @@ class Config : public cheetah::utils::Config
 
         DispersedPulseConfig const& dispersed_pulse() const;
 
+        /// configuration for the RfiScenario generators
+        RfiScenarioConfig const& rfi_scenario() const;
+        RfiScenarioConfig& rfi_scenario();
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
@@ -67,6 +72,7 @@ class Config : public cheetah::utils::Config
         GaussianNoiseConfig _gaussian_noise;
         BasebandGaussianNoiseConfig _baseband_gaussian_noise;
         DispersedPulseConfig _dispersed_pulse;
+        RfiScenarioConfig _rfi_scenario;
 };
 
 
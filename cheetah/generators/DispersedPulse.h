@@ -28,6 +28,7 @@
 #include "DataGenerator.h"
 #include "DispersedPulseConfig.h"
 #include "pss/astrotypes/units/DispersionMeasure.h"
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -35,7 +36,8 @@ namespace generators {
 
 /**
  * @brief Inject a single pulse at a specified dispersion measure
- * @details
+ * @details The per channel delays are cached and only recalculated when the channel frequencies
+ *          or the sample interval of the data change.
  */
 
 template<typename DataType>
@@ -52,12 +54,24 @@ class DispersedPulse : public DataGenerator<DataType>
 
         void next(DataType& data) override;
 
+    private:
+        /**
+         * @brief recalculate the delay table if the data layout differs from the cached one
+         */
+        void update_delays(DataType const& data);
+
     private:
         typedef double DispersionConstant; // TODO make boost::units::quantity in s_mhz_squared_cm_cubed_per_pc
         DispersionConstant _dm_constant;
         pss::astrotypes::units::DispersionMeasure<double> const _dm_measure;
         TimeType _pulse_width;
         NumericalRep _delta;    // amount to increase signal by for pulse
+
+        // cached delay table and the data layout it was calculated for
+        std::vector<data::FrequencyType> _channel_frequencies;
+        TimeType _sample_interval;
+        std::size_t _bin_width;
+        std::vector<std::size_t> _delays; // in samples
 };
 
 
@@ -26,6 +26,10 @@
 
 
 #include "DataGenerator.h"
+#include "cheetah/utils/Philox.h"
+#include "cheetah/utils/WorkerPool.h"
+#include <cstdint>
+#include <memory>
 #include <random>
 
 namespace ska {
@@ -35,9 +39,12 @@ class GaussianNoiseConfig;
 
 /**
  * @brief
+ *    Fill the data with gaussian distributed values
  *
  * @details
- *
+ *    Uses a counter based generator (Philox4x32) with a Box-Muller transform. Each value is
+ *    determined only by the seed, the chunk number and its position in the data, so the data
+ *    can be split into slices generated on different threads without changing the output.
  */
 
 template<typename DataType>
@@ -53,11 +60,22 @@ class GaussianNoise : public DataGenerator<DataType>
 
         virtual void next(DataType& data) override;
 
+    private:
+        /// the number of values generated together (a multiple of the 4 values from each Philox call)
+        static constexpr std::size_t batch_size = 256;
+
+        /**
+         * @brief generate the values for batches [first_batch, end_batch) of the data starting at begin
+         */
+        template<typename IteratorT>
+        void generate(IteratorT begin, std::size_t size, std::size_t first_batch, std::size_t end_batch, std::uint64_t chunk_number) const;
+
     private:
         GaussianNoiseConfig const& _config;
         static std::random_device _dev;
-        std::mt19937 _generator;
-        std::normal_distribution<float> _rand;
+        utils::Philox4x32::KeyType _key;
+        std::uint64_t _chunk_number;
+        std::unique_ptr<utils::WorkerPool> _workers; // persist between chunks, held by pointer to keep the generator movable
 };
 
 
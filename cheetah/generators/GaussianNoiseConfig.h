@@ -26,6 +26,7 @@
 
 
 #include "cheetah/utils/Config.h"
+#include <cstddef>
 
 namespace ska {
 namespace cheetah {
@@ -49,6 +50,18 @@ class GaussianNoiseConfig : public cheetah::utils::Config
         float std_deviation() const;
         void std_deviation(float);
 
+        /**
+         * @brief the random number seed (0 to seed from std::random_device)
+         * @details for a given seed the output is independent of the number of threads
+         */
+        std::size_t seed() const;
+        void seed(std::size_t seed);
+
+        /**
+         * @brief the number of threads to use to generate each chunk
+         */
+        unsigned number_of_threads() const;
+        void number_of_threads(unsigned number_of_threads);
 
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
@@ -56,6 +69,8 @@ class GaussianNoiseConfig : public cheetah::utils::Config
     private:
         float _mean;
         float _deviation;
+        std::size_t _seed;
+        unsigned _number_of_threads;
 };
 
 } // namespace generators
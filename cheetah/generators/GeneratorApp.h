@@ -28,6 +28,7 @@
 #include "cheetah/generators/GeneratorAppConfig.h"
 #include "cheetah/generators/GeneratorFactory.h"
 #include "cheetah/sigproc/SigProcWriter.h"
+#include <future>
 #include <vector>
 #include <memory>
 
@@ -40,6 +41,10 @@ class GeneratorFactory;
 /**
  * @brief
  *     App to generate sigproc files using the various generators available
+ * @details
+ *     Cycles through number_of_buffers() data blocks so that the models can generate the next
+ *     block while the previous ones are being written. Each block starts from a copy of the
+ *     previous block, exactly as if a single block were reused.
  */
 
 template<typename DataType>
@@ -55,8 +60,9 @@ class GeneratorApp
         void exec();
 
     private:
-        typename std::shared_ptr<DataType> _data_ptr;
-        DataType& _data;
+        /// the data blocks and the pending write of each
+        std::vector<std::shared_ptr<DataType>> _buffers;
+        std::vector<std::shared_future<void>> _writes;
         std::size_t _iters;
         std::vector<std::unique_ptr<Generator>> _models;                // The data generation model
         sigproc::SigProcWriter<> _writer;
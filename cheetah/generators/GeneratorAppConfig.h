@@ -28,6 +28,7 @@
 #include "cheetah/generators/Config.h"
 #include "cheetah/sigproc/WriterConfig.h"
 #include "cheetah/data/Units.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
 #include <string>
 #include <vector>
 
@@ -47,6 +48,7 @@ class GeneratorAppConfig : public ska::panda::BasicAppConfig
 {
         typedef boost::units::quantity<data::MegaHertz, double> FrequencyType;
         typedef boost::units::quantity<boost::units::si::time, double> IntervalType;
+        typedef utils::ModifiedJulianClock::time_point TimePointType;
 
     public:
         GeneratorAppConfig(std::string const& app_name, std::string const& description);
@@ -71,26 +73,37 @@ class GeneratorAppConfig : public ska::panda::BasicAppConfig
          * @brief return the configuration object for directing sigproc writer
          */
         sigproc::WriterConfig const& sigproc_config() const;
+        sigproc::WriterConfig& sigproc_config();
 
         /**
          * @brief return the number of data chunks to produce for the data file
          */
         std::size_t number_of_chunks() const;
+        void number_of_chunks(std::size_t);
+
+        /**
+         * @brief return the number of data chunks that can be in flight (being generated or written) at once
+         */
+        std::size_t number_of_buffers() const;
+        void number_of_buffers(std::size_t);
 
         /**
          * @brief return the number of time smaples per data chunk
          */
         std::size_t number_of_time_samples() const;
+        void number_of_time_samples(std::size_t);
 
         /**
          * @brief return the number of channels for each data chunk
          */
         std::size_t number_of_channels() const;
+        void number_of_channels(std::size_t);
 
         /**
          * @brief return the chosen data model
          */
         std::vector<std::string> const& data_generator() const;
+        void data_generator(std::vector<std::string> const& generator_names);
 
         /**
          * @brief return the start frequency
@@ -107,6 +120,13 @@ class GeneratorAppConfig : public ska::panda::BasicAppConfig
          */
         IntervalType sample_interval() const;
 
+        /**
+         * @brief the time of the first sample
+         * @details an unset (zero) start time means the current time is used
+         */
+        TimePointType const& start_time() const;
+        void start_time(TimePointType const& start_time);
+
 
     protected:
         std::string version() const override;
@@ -119,12 +139,14 @@ class GeneratorAppConfig : public ska::panda::BasicAppConfig
         sigproc::WriterConfig _sigproc_config;
         std::vector<std::string> _generator_keys;
         std::size_t _number_of_chunks;
+        std::size_t _number_of_buffers;
         std::size_t _number_of_channels;
         std::size_t _number_of_time_samples;
         std::vector<std::string> _generator_selected;
         FrequencyType _frequency;
         FrequencyType _channel_width;
         IntervalType _sample_interval;
+        TimePointType _start_time;
 };
 
 
@@ -27,6 +27,7 @@
 #include "DataGenerator.h"
 #include "PulsarInjectionConfig.h"
 #include "pulse_profile/PulsarProfile.h"
+#include "cheetah/utils/WorkerPool.h"
 #include <complex>
 #include <cmath>
 #include <cstdlib>
@@ -36,6 +37,7 @@
 #include <iostream>
 #include <numeric>
 #include <functional>
+#include <memory>
 
 namespace ska {
 namespace cheetah {
@@ -60,13 +62,36 @@ class PulsarInjection : public DataGenerator<DataType>
 
         virtual void next(DataType& data) override;
 
+    private:
+        /**
+         * @brief fftw buffers and convolution plans for a given profile size,
+         *        along with the ISM models for the data shape they were generated for
+         */
+        class InjectionPlan;
+
+        /**
+         * @brief the data shape the profile normalisation and ISM models were generated for
+         */
+        struct DataShape
+        {
+            std::size_t number_of_spectra;
+            std::size_t number_of_channels;
+            double sample_interval;
+            double first_channel_frequency;
+            double channel_width;
+
+            bool operator==(DataShape const&) const;
+        };
+
     private:
         PulsarInjectionConfig const& _config;
         ProfileManager const& _profile_manager;
         PulsarProfile _profile;
         std::function<double(utils::ModifiedJulianClock::time_point const&, boost::units::quantity<data::MegaHertz, double>)> _phase_model;
-        std::size_t _last_number_of_channels;
-        std::size_t _last_number_of_spectra;
+        DataShape _last_shape;
+        std::unique_ptr<InjectionPlan> _plan;
+        std::size_t _chunk_number;
+        utils::WorkerPool _workers; // inject the channel ranges in parallel
 };
 
 
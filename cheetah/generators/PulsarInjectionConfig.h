@@ -31,6 +31,7 @@
 #include "Tempo2PhaseModelConfig.h"
 #include "cheetah/utils/Config.h"
 #include "cheetah/data/DedispersionMeasure.h"
+#include <string>
 
 namespace ska {
 namespace cheetah {
@@ -103,6 +104,31 @@ class PulsarInjectionConfig : public utils::Config
          */
         void dm(data::DedispersionMeasureType<double>);
 
+        /**
+         * @brief file to import/export FFTW wisdom (empty for none)
+         * @details stored plans let a restarted injector skip the FFTW planning stage
+         */
+        std::string const& fftw_wisdom_file() const;
+
+        /**
+         * @brief set the file to import/export FFTW wisdom (empty for none)
+         */
+        void fftw_wisdom_file(std::string const& filename);
+
+        /**
+         * @brief the random number seed (0 to seed from the clock)
+         * @details successive chunks use successive seeds. For a given seed the output
+         *          is independent of the number of threads
+         */
+        std::size_t seed() const;
+        void seed(std::size_t seed);
+
+        /**
+         * @brief the number of threads to use to inject the signal into the channels
+         */
+        unsigned number_of_threads() const;
+        void number_of_threads(unsigned number_of_threads);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
         void phase_model(std::string const&);
@@ -116,6 +142,9 @@ class PulsarInjectionConfig : public utils::Config
         PhaseModelType _phase_model;
         SimplePhaseModelConfig _simple_phase_model_config;
         Tempo2PhaseModelConfig _tempo2_phase_model_config;
+        std::string _fftw_wisdom_file;
+        std::size_t _seed;
+        unsigned _number_of_threads;
 };
 
 } // namespace generators
@@ -27,14 +27,17 @@
 
 #include "DataGenerator.h"
 #include "cheetah/data/RfimFlaggedData.h"
+#include <vector>
 
 namespace ska {
 namespace cheetah {
 namespace generators {
 
 /**
- * @brief
- * @details
+ * @brief Base class for the RFI scenarios, providing functions to inject RFI shapes into a block
+ * @details Each shape is scaled relative to the mean and standard deviation of the block. These can be
+ *          supplied by the caller (e.g. to calculate them only once when injecting several shapes)
+ *          or are calculated from the data.
  */
 
 template<typename DataType>
@@ -44,6 +47,15 @@ class RfiGenerator : public DataGenerator<DataType>
         typedef DataGenerator<DataType> BaseT;
         typedef data::RfimFlaggedData<DataType> FlaggedDataType;
 
+    public:
+        /**
+         * @brief the statistics of a data block used to scale the injected RFI
+         */
+        struct Statistics
+        {
+            float mean;
+            float standard_deviation;
+        };
 
     public:
         RfiGenerator();
@@ -52,6 +64,11 @@ class RfiGenerator : public DataGenerator<DataType>
         void next(DataType& data) override;
         virtual void next(FlaggedDataType& data) = 0;
 
+        /**
+         * @brief calculate the mean and standard deviation of the data in a single pass
+         */
+        static Statistics statistics(DataType const& data);
+
         void rfi_gaussian_block(FlaggedDataType& data
                       , std::size_t min_channel
                       , std::size_t max_channel
@@ -59,17 +76,42 @@ class RfiGenerator : public DataGenerator<DataType>
                       , std::size_t max_sample_number
                       , float sigma);
 
+        void rfi_gaussian_block(FlaggedDataType& data
+                      , std::size_t min_channel
+                      , std::size_t max_channel
+                      , std::size_t min_sample_number
+                      , std::size_t max_sample_number
+                      , float sigma
+                      , Statistics const& statistics);
+
         void rfi_ramp_block(FlaggedDataType& data
                       , std::size_t min_channel
                       , std::size_t max_channel
                       , std::size_t min_sample_number
                       , std::size_t max_sample_number);
 
+        void rfi_ramp_block(FlaggedDataType& data
+                      , std::size_t min_channel
+                      , std::size_t max_channel
+                      , std::size_t min_sample_number
+                      , std::size_t max_sample_number
+                      , Statistics const& statistics);
+
         void rfi_broadband_block(FlaggedDataType& data
                       , std::size_t min_sample_number
                       , std::size_t max_sample_number
                       , float sigma);
 
+        void rfi_broadband_block(FlaggedDataType& data
+                      , std::size_t min_sample_number
+                      , std::size_t max_sample_number
+                      , float sigma
+                      , Statistics const& statistics);
+
+    private:
+        // envelope tables reused between calls
+        std::vector<float> _channel_envelope;
+        std::vector<float> _time_envelope;
 };
 
 
@@ -26,6 +26,8 @@
 
 
 #include "RfiGenerator.h"
+#include "RfiScenarioConfig.h"
+#include <random>
 
 namespace ska {
 namespace cheetah {
@@ -100,9 +102,18 @@ class RfiScenario<3, DataType> : public RfiGenerator<DataType> {
         typedef typename BaseT::FlaggedDataType FlaggedDataType;
     public:
         RfiScenario();
+        explicit RfiScenario(RfiScenarioConfig const& config);
         ~RfiScenario();
         void next(FlaggedDataType& data) override;
+
+        /// the seed used to place the RFI
+        std::size_t seed() const;
+
         static constexpr char description[] = "RFI: 4 seperated Gaussian spikes in each block";
+
+    private:
+        std::size_t _seed;
+        std::mt19937_64 _engine;
 };
 
 /**
@@ -114,9 +125,18 @@ class RfiScenario<4, DataType> : public RfiGenerator<DataType> {
         typedef typename BaseT::FlaggedDataType FlaggedDataType;
     public:
         RfiScenario();
+        explicit RfiScenario(RfiScenarioConfig const& config);
         ~RfiScenario();
         void next(FlaggedDataType& data) override;
+
+        /// the seed used to place the RFI
+        std::size_t seed() const;
+
         static constexpr char description[] = "RFI: 8 random Gaussian spikes in each block";
+
+    private:
+        std::size_t _seed;
+        std::mt19937_64 _engine;
 };
 
 /**
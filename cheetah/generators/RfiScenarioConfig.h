@@ -0,0 +1,66 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_GENERATORS_RFISCENARIOCONFIG_H
+#define SKA_CHEETAH_GENERATORS_RFISCENARIOCONFIG_H
+
+
+#include "cheetah/utils/Config.h"
+#include <cstddef>
+
+namespace ska {
+namespace cheetah {
+namespace generators {
+
+/**
+ * @brief Configuration parameters for the RfiScenario generators
+ */
+
+class RfiScenarioConfig : public cheetah::utils::Config
+{
+        typedef cheetah::utils::Config BaseT;
+
+    public:
+        RfiScenarioConfig(std::string const& tag_name="rfi_scenario");
+        ~RfiScenarioConfig();
+
+        /**
+         * @brief the seed for the scenarios that place RFI at random
+         * @details 0 requests a random seed. The seed in use is logged so that the run can be replayed
+         */
+        std::size_t seed() const;
+        void seed(std::size_t seed);
+
+    protected:
+        void add_options(OptionsDescriptionEasyInit&) override;
+
+    private:
+        std::size_t _seed;
+};
+
+
+} // namespace generators
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_GENERATORS_RFISCENARIOCONFIG_H
@@ -38,6 +38,8 @@ DispersedPulse<DataType>::DispersedPulse()
     , _dm_measure(500.0 * pss::astrotypes::units::parsecs_per_cube_cm)
     , _pulse_width(3.0 * boost::units::si::milli * boost::units::si::seconds)
     , _delta(1)
+    , _sample_interval(0.0 * boost::units::si::seconds)
+    , _bin_width(0)
 {
 }
 
@@ -48,6 +50,8 @@ DispersedPulse<DataType>::DispersedPulse(DispersedPulseConfig const& config)
     , _dm_measure(config.dispersion_measure())
     , _pulse_width(config.pulse_width())
     , _delta(std::max(config.delta(), (double)std::numeric_limits<NumericalRep>::max()))
+    , _sample_interval(0.0 * boost::units::si::seconds)
+    , _bin_width(0)
 {
 }
 
@@ -57,29 +61,43 @@ DispersedPulse<DataType>::~DispersedPulse()
 }
 
 template<typename DataType>
-void DispersedPulse<DataType>::next(DataType& data)
+void DispersedPulse<DataType>::update_delays(DataType const& data)
 {
-    std::size_t bin_width = _pulse_width/data.sample_interval();
     std::vector<data::FrequencyType> const& channel_freqs = data.channel_frequencies();
+    if(data.sample_interval() == _sample_interval && channel_freqs == _channel_frequencies) return;
+
+    _channel_frequencies = channel_freqs;
+    _sample_interval = data.sample_interval();
+    _bin_width = _pulse_width/_sample_interval;
+
+    _delays.clear();
+    if(channel_freqs.empty()) return;
     typename data::FrequencyType freq_top = *std::max_element(channel_freqs.begin(), channel_freqs.end());
-    std::vector<float> delays;
+    _delays.reserve(channel_freqs.size());
     for (auto const& freq: channel_freqs)
     {
-        delays.push_back(_dm_constant * _dm_measure.value()
-                        * (1.0/(freq.value()*freq.value()) -  1.0/(freq_top.value()*freq_top.value())) / data.sample_interval().value());
+        _delays.push_back(std::size_t(std::round(_dm_constant * _dm_measure.value()
+                        * (1.0/(freq.value()*freq.value()) -  1.0/(freq_top.value()*freq_top.value())) / _sample_interval.value())));
     }
+}
+
+template<typename DataType>
+void DispersedPulse<DataType>::next(DataType& data)
+{
+    update_delays(data);
 
-    std::size_t const number_of_channels = data.template dimension<data::Frequency>();
+    std::size_t const number_of_channels = std::min<std::size_t>(data.template dimension<data::Frequency>(), _delays.size());
+    std::size_t const number_of_samples = data.template dimension<data::Time>();
     for(std::size_t ii=0; ii < number_of_channels; ++ii)
     {
-        typename DataType::Channel ts = data.channel(ii);
-        std::size_t delay = std::size_t(std::round(delays[ii]));
+        // the span of samples in this channel covered by the pulse
+        std::size_t const delay = _delays[ii];
+        if(delay >= number_of_samples) continue;
+        std::size_t const end = std::min(delay + _bin_width, number_of_samples);
 
-        // add signal to each appropraite bin
-        for(std::size_t offset=0; offset < bin_width; ++offset) {
-            //auto index = delay + offset;
-            pss::astrotypes::DimensionIndex<pss::astrotypes::units::Time> const index(delay + offset);
-            if( index >= ts.template size<data::Time>() ) continue;
+        typename DataType::Channel ts = data.channel(ii);
+        for(std::size_t sample = delay; sample < end; ++sample) {
+            pss::astrotypes::DimensionIndex<pss::astrotypes::units::Time> const index(sample);
             // avoid wrap-around when we add the delta
             if(std::numeric_limits<NumericalRep>::max() - ts[index] <= _delta)
             {
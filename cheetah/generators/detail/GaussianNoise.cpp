@@ -24,6 +24,10 @@
 #include "cheetah/generators/GaussianNoise.h"
 #include "cheetah/generators/GaussianNoiseConfig.h"
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -32,12 +36,16 @@ namespace generators {
 template<typename DataType>
 std::random_device GaussianNoise<DataType>::_dev;
 
+template<typename DataType>
+constexpr std::size_t GaussianNoise<DataType>::batch_size;
+
 template<typename DataType>
 GaussianNoise<DataType>::GaussianNoise(GaussianNoiseConfig const& config)
     : BaseT()
     , _config(config)
-    , _generator(_dev())
-    , _rand(_config.mean(), _config.std_deviation())
+    , _key(utils::Philox4x32::key((config.seed() == 0) ? (static_cast<std::uint64_t>(_dev()) << 32 | _dev()) : config.seed()))
+    , _chunk_number(0)
+    , _workers(new utils::WorkerPool(config.number_of_threads()))
 {
 }
 
@@ -46,10 +54,67 @@ GaussianNoise<DataType>::~GaussianNoise()
 {
 }
 
+template<typename DataType>
+template<typename IteratorT>
+void GaussianNoise<DataType>::generate(IteratorT begin, std::size_t size, std::size_t first_batch, std::size_t end_batch, std::uint64_t chunk_number) const
+{
+    static constexpr float two_pi = 6.28318530717958647692f;
+    float const mean = _config.mean();
+    float const std_deviation = _config.std_deviation();
+
+    std::array<float, batch_size/2> radius_deviates;
+    std::array<float, batch_size/2> angle_deviates;
+    std::array<float, batch_size> values;
+
+    for(std::size_t batch = first_batch; batch < end_batch; ++batch)
+    {
+        // uniform deviates: the counter is the position of the block of four values and the chunk number
+        std::uint64_t const first_block = batch * (batch_size/4);
+        for(std::size_t i = 0; i < batch_size/4; ++i) {
+            std::uint64_t const block = first_block + i;
+            utils::Philox4x32::CounterType const random = utils::Philox4x32::generate(
+                                                              {{ static_cast<std::uint32_t>(block)
+                                                               , static_cast<std::uint32_t>(block >> 32)
+                                                               , static_cast<std::uint32_t>(chunk_number)
+                                                               , static_cast<std::uint32_t>(chunk_number >> 32)
+                                                              }}, _key);
+            radius_deviates[2 * i] = utils::Philox4x32::to_open_unit_interval(random[0]);
+            angle_deviates[2 * i] = utils::Philox4x32::to_open_unit_interval(random[1]);
+            radius_deviates[2 * i + 1] = utils::Philox4x32::to_open_unit_interval(random[2]);
+            angle_deviates[2 * i + 1] = utils::Philox4x32::to_open_unit_interval(random[3]);
+        }
+
+        // Box-Muller transform. The iterations are independent so the loop can be vectorised.
+        for(std::size_t i = 0; i < batch_size/2; ++i) {
+            float const radius = std_deviation * std::sqrt(-2.0f * std::log(radius_deviates[i]));
+            float const angle = two_pi * angle_deviates[i];
+            values[2 * i] = mean + radius * std::cos(angle);
+            values[2 * i + 1] = mean + radius * std::sin(angle);
+        }
+
+        std::size_t const offset = batch * batch_size;
+        std::size_t const count = std::min(batch_size, size - offset);
+        IteratorT it = begin;
+        std::advance(it, offset);
+        std::transform(values.begin(), values.begin() + count, it, [](float value) { return static_cast<NumericalRep>(value); });
+    }
+}
+
 template<typename DataType>
 void GaussianNoise<DataType>::next(DataType& data)
 {
-    std::transform(data.begin(), data.end(), data.begin(), [this](typename DataType::NumericalRep) { return _rand(_generator); } );
+    std::uint64_t const chunk_number = _chunk_number++;
+    std::size_t const size = std::distance(data.begin(), data.end());
+    std::size_t const number_of_batches = (size + batch_size - 1) / batch_size;
+    std::size_t const number_of_slices = std::min<std::size_t>(_workers->number_of_threads(), number_of_batches);
+
+    // split the data into contiguous slices (i.e. time slices of TimeFrequency data), one per thread
+    _workers->run(number_of_slices, [&](std::size_t slice)
+                                    {
+                                        std::size_t const first_batch = slice * number_of_batches / number_of_slices;
+                                        std::size_t const end_batch = (slice + 1) * number_of_batches / number_of_slices;
+                                        generate(data.begin(), size, first_batch, end_batch, chunk_number);
+                                    });
 }
 
 } // namespace generators
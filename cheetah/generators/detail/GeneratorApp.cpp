@@ -23,6 +23,7 @@
  */
 #include "cheetah/generators/GeneratorApp.h"
 #include "pss/astrotypes/units/ModifiedJulianClock.h"
+#include <algorithm>
 
 
 namespace ska {
@@ -32,14 +33,21 @@ namespace generators {
 
 template<typename DataType>
 GeneratorApp<DataType>::GeneratorApp(GeneratorAppConfig const& config, GeneratorFactory<DataType>& generator_factory)
-    : _data_ptr(std::make_shared<DataType>(data::DimensionSize<data::Time>(config.number_of_time_samples()), data::DimensionSize<data::Frequency>(config.number_of_channels())))
-    , _data(*_data_ptr)
+    : _writes(std::max<std::size_t>(1, config.number_of_buffers()))
     , _iters(config.number_of_chunks())
     , _writer(config.sigproc_config())
 {
-    _data.set_channel_frequencies_const_width(config.start_frequency(), config.channel_width());
-    _data.sample_interval(config.sample_interval());
-    _data.start_time(pss::astrotypes::units::ModifiedJulianClock::now());
+    for(std::size_t i = 0; i < _writes.size(); ++i) {
+        _buffers.emplace_back(std::make_shared<DataType>(data::DimensionSize<data::Time>(config.number_of_time_samples()), data::DimensionSize<data::Frequency>(config.number_of_channels())));
+        _buffers.back()->set_channel_frequencies_const_width(config.start_frequency(), config.channel_width());
+        _buffers.back()->sample_interval(config.sample_interval());
+    }
+    if(config.start_time() == typename DataType::TimePointType()) {
+        _buffers.front()->start_time(pss::astrotypes::units::ModifiedJulianClock::now());
+    }
+    else {
+        _buffers.front()->start_time(config.start_time());
+    }
     for(auto const& generator_name : config.data_generator()) {
         _models.emplace_back(std::unique_ptr<DataGenerator<DataType>>(generator_factory.create(generator_name)));
     }
@@ -48,20 +56,47 @@ GeneratorApp<DataType>::GeneratorApp(GeneratorAppConfig const& config, Generator
 template<typename DataType>
 GeneratorApp<DataType>::~GeneratorApp()
 {
+    // the pending writes refer to the writer and buffers
+    for(auto const& write : _writes) {
+        if(write.valid()) write.wait();
+    }
 }
 
 template<typename DataType>
 void GeneratorApp<DataType>::exec()
 {
-    std::size_t iter = _iters;
-    while(iter) {
+    std::size_t const number_of_buffers = _buffers.size();
+    std::shared_future<void> previous_write;
+    for(std::size_t chunk = 0; chunk < _iters; ++chunk) {
+        std::size_t const index = chunk % number_of_buffers;
+        DataType& data = *_buffers[index];
+
+        // wait until the last write from this buffer has completed (rethrowing any error)
+        if(_writes[index].valid()) _writes[index].get();
+
+        if(chunk != 0) {
+            DataType const& previous_data = *_buffers[(index + number_of_buffers - 1) % number_of_buffers];
+            if(&previous_data != &data) {
+                std::copy(previous_data.begin(), previous_data.end(), data.begin());
+            }
+            data.start_time(previous_data.end_time() + previous_data.sample_interval());
+        }
+
         for(auto& model : _models) {
-            model->next(_data);
+            model->next(data);
         }
-        _writer << _data;
-        _data.start_time(_data.end_time() + _data.sample_interval());
-        --iter;
+
+        // write in the background, after the previous block has been written.
+        // The previous write is moved out of the capture so that completed writes do not form an ever growing chain.
+        previous_write = std::async(std::launch::async, [this, &data, previous_write]() mutable
+                                    {
+                                        std::shared_future<void> previous(std::move(previous_write));
+                                        if(previous.valid()) previous.get();
+                                        _writer << data;
+                                    }).share();
+        _writes[index] = previous_write;
     }
+    if(previous_write.valid()) previous_write.get();
 }
 
 } // namespace generators
@@ -63,8 +63,8 @@ GeneratorFactory<DataType>::GeneratorFactory(Config const& config)
     this->add_type("RfiScenario0", []() { return new RfiScenario<0, DataType>(); });
     this->add_type("RfiScenario1", []() { return new RfiScenario<1, DataType>(); });
     this->add_type("RfiScenario2", []() { return new RfiScenario<2, DataType>(); });
-    this->add_type("RfiScenario3", []() { return new RfiScenario<3, DataType>(); });
-    this->add_type("RfiScenario4", []() { return new RfiScenario<4, DataType>(); });
+    this->add_type("RfiScenario3", [this]() { return new RfiScenario<3, DataType>(_config.rfi_scenario()); });
+    this->add_type("RfiScenario4", [this]() { return new RfiScenario<4, DataType>(_config.rfi_scenario()); });
     this->add_type("RfiScenario5", []() { return new RfiScenario<5, DataType>(); });
     this->add_type("null", []() { return new NullGenerator<DataType>(); });
 
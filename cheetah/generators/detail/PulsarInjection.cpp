@@ -3,29 +3,13 @@
 #include "cheetah/utils/ConvolvePlan.h"
 #include "panda/Log.h"
 #include <boost/math/special_functions/sinc.hpp>
-#include <exception>
+#include <algorithm>
+#include <iterator>
 
 #define M_PI_DBL 3.14159265358979323846264338327950288
 
 namespace {
 
-template<typename T>
-class FftwAlloc {
-    public:
-        FftwAlloc(std::size_t size)
-        {
-            _ptr = static_cast<T*>( fftwf_malloc(size * sizeof(T)) );
-        }
-        operator T*() { return _ptr; }
-
-        ~FftwAlloc()
-        {
-            fftwf_free(_ptr);
-        }
-    private:
-        T* _ptr;
-};
-
 // constants for random number generator
 static constexpr std::size_t IM1(2147483563);
 static constexpr std::size_t IM2(2147483399);
@@ -59,7 +43,7 @@ typedef struct MjkRand {
             gauss_next = -1;
             gauss_buffer = NULL;
             srand(init_seed);
-            ir = (int*) calloc(nthreadmax, sizeof(int));
+            ir = (int*) calloc(nthreadmax * ir_stride, sizeof(int));
             seed = (uint64_t*) calloc(MJK_RAND_R1279_SZ * nthreadmax, sizeof(uint64_t));
             uint64_t j, k;
             for(std::size_t i = 0; i < (unsigned) (MJK_RAND_R1279_SZ * nthreadmax); ++i) {
@@ -84,7 +68,7 @@ typedef struct MjkRand {
             uint64_t ibuf, iblk, blksize = buffer_len/nthreadmax;
             for (iblk = 0; iblk < nthreadmax; iblk++) {
                 for (ibuf = 0; ibuf < blksize; ibuf++) {
-                    buffer[ibuf + iblk * blksize] = a2281(seed + iblk * MJK_RAND_R1279_SZ, &(ir)[iblk]);
+                    buffer[ibuf + iblk * blksize] = a2281(seed + iblk * MJK_RAND_R1279_SZ, &(ir)[iblk * ir_stride]);
                 }
             }
             next = buffer_len - 1;
@@ -126,6 +110,23 @@ typedef struct MjkRand {
             return gauss_buffer[gauss_next--];
         }
 
+        /**
+         * @brief the number of independent random number streams
+         */
+        unsigned number_of_streams() const
+        {
+            return nthreadmax;
+        }
+
+        /**
+         * @brief take the next number directly from a single stream (bypassing the buffer)
+         * @details different streams may be used concurrently from different threads
+         */
+        double rand_double(unsigned stream)
+        {
+            return a2281(seed + stream * MJK_RAND_R1279_SZ, &ir[stream * ir_stride]);
+        }
+
     protected:
         float nrran2(long *idum)
         {
@@ -183,6 +184,7 @@ typedef struct MjkRand {
         }
 
     private:
+        static constexpr unsigned ir_stride = 16; // keep each stream position on its own cache line
         uint32_t nthreadmax;
         uint32_t buffer_len;
         double *buffer;
@@ -201,51 +203,68 @@ inline void convolve(ska::cheetah::utils::ConvolvePlan& plan)
     plan.convolve();
 }
 
-struct IsmModels {
-    IsmModels(std::size_t number_of_models, std::size_t model_size)
-        : _size(number_of_models)
-    {
-        _models = (float**) malloc(sizeof(float*) * _size);
-        if(! _models) throw std::bad_alloc();
-        for(std::size_t i = 0; i < _size; ++i) {
-            _models[i] = (float*) malloc(sizeof(float) * model_size);
-            if(! _models[i]) {
-                clean_models(i);
-                throw std::bad_alloc();
-            }
-        }
-    }
+} //namespace
 
-    ~IsmModels()
-    {
-        clean_models(_size);
-        delete _models;
-    }
+namespace ska {
+namespace cheetah {
+namespace generators {
 
-    inline
-    float* operator[](std::size_t i) {
-        return _models[i];
-    }
 
-    private:
-        inline
-        void clean_models(std::size_t model_num) {
-            for(std::size_t i = 0; i < model_num; ++i) {
-                free(_models[i]);
-            }
-        }
+template<typename DataType>
+class PulsarInjection<DataType>::InjectionPlan
+{
+        typedef std::unique_ptr<float, void(*)(void*)> FftwBuffer;
 
-    private:
-        std::size_t _size;
-        float** _models;
-};
+        static FftwBuffer fftw_buffer(std::size_t size)
+        {
+            FftwBuffer buffer(static_cast<float*>(fftwf_malloc(size * sizeof(float))), &fftwf_free);
+            if(!buffer) throw std::bad_alloc();
+            return buffer;
+        }
 
-} //namespace
+    public:
+        InjectionPlan(std::size_t nprof, std::size_t nsubpulse)
+            : profile_size(nprof)
+            , ism_convolution(fftw_buffer(nprof))
+            , subpulse_map(fftw_buffer(nprof))
+            , subpulse_profile(fftw_buffer(nprof))
+            , unsmeared_profile(fftw_buffer(nprof))
+            , smeared_profile(fftw_buffer(nprof))
+            , ism_convolution_plan(nprof, unsmeared_profile.get(), ism_convolution.get(), smeared_profile.get())
+            , subpulse_convolution_plan(nprof, subpulse_profile.get(), subpulse_map.get(), unsmeared_profile.get())
+        {
+            // FFTW_MEASURE planning scribbles over the buffers so they are only filled afterwards.
+            // The subpulse profile is normalised by the number of subpulses so that the final
+            // subpulse profile will have an area of 1. (r2c transforms preserve their input)
+            float const subpulse_value = (nsubpulse == 0) ? 1.0 : 1.0/nsubpulse;
+            std::fill(subpulse_profile.get(), subpulse_profile.get() + nprof, subpulse_value);
+        }
 
-namespace ska {
-namespace cheetah {
-namespace generators {
+    public:
+        std::size_t const profile_size;
+        FftwBuffer ism_convolution;
+        FftwBuffer subpulse_map; // mask for the number of pulses actually present (nsubpulse out of n randomly selected)
+        FftwBuffer subpulse_profile;
+        FftwBuffer unsmeared_profile;
+        FftwBuffer smeared_profile;
+        utils::ConvolvePlan ism_convolution_plan;
+        utils::ConvolvePlan subpulse_convolution_plan;
+
+        std::vector<std::vector<float>> ism_models; // scattering kernels, one per distinct channel smearing
+        std::vector<uint_fast32_t> ism_idx;        // the ism model to apply to each channel
+        std::vector<std::vector<float>> grads;
+        std::vector<std::vector<float>> output_prof;
+};
 
+template<typename DataType>
+bool PulsarInjection<DataType>::DataShape::operator==(DataShape const& other) const
+{
+    return number_of_spectra == other.number_of_spectra
+        && number_of_channels == other.number_of_channels
+        && sample_interval == other.sample_interval
+        && first_channel_frequency == other.first_channel_frequency
+        && channel_width == other.channel_width;
+}
 
 template<typename DataType>
 PulsarInjection<DataType>::PulsarInjection(PulsarInjectionConfig const& config, ProfileManager const& profile_manager)
@@ -253,11 +272,22 @@ PulsarInjection<DataType>::PulsarInjection(PulsarInjectionConfig const& config,
     , _config(config)
     , _profile_manager(profile_manager)
     , _phase_model(config.phase_model())
-    , _last_number_of_channels(0)
-    , _last_number_of_spectra(0)
+    , _last_shape({0, 0, 0.0, 0.0, 0.0})
+    , _chunk_number(0)
+    , _workers(config.number_of_threads())
 {
     // these calls will throw if not found
     _profile = profile_manager.profile(config.profile());
+
+    std::string const& wisdom_file = config.fftw_wisdom_file();
+    if(!wisdom_file.empty()) {
+        if(fftwf_import_wisdom_from_filename(wisdom_file.c_str())) {
+            PANDA_LOG_DEBUG << "imported FFTW wisdom from '" << wisdom_file << "'";
+        }
+        else {
+            PANDA_LOG_DEBUG << "no FFTW wisdom imported from '" << wisdom_file << "'";
+        }
+    }
 }
 
 template<typename DataType>
@@ -271,8 +301,8 @@ void PulsarInjection<DataType>::next(DataType& data)
     float spec_index = _config.spectral_index();
     const float in_snr = _config.signal_to_noise(); // S/N
     float pulse_energy_sigma = 0.2;
-    float frac;
-    uint32_t seed = time(NULL);
+    uint32_t const seed = (_config.seed() == 0) ? time(NULL) : _config.seed() + 2 * _chunk_number;
+    ++_chunk_number;
     uint_fast32_t nsubpulse = 5;
     uint_fast32_t n;
 
@@ -290,8 +320,16 @@ void PulsarInjection<DataType>::next(DataType& data)
     // TODO scale to the RMS of the existing data
     const double noiseAmp = 24; // 8-bit only to match gaussian noise generated by the fake program
 
+    DataShape const shape = { nsamp
+                            , nchan_const
+                            , static_cast<double>(tsamp)
+                            , static_cast<double>(fch1)
+                            , static_cast<boost::units::quantity<data::MegaHertz, double>>(data.channel_frequencies()[1] - data.channel_frequencies()[0]).value()
+                            };
+    bool rebuild_ism_models = !(shape == _last_shape);
+
     // normalise the profile (if it hasn't been done already)
-    if(nsamp != _last_number_of_spectra || nchan_const != _last_number_of_channels)
+    if(rebuild_ism_models)
     {
         // restore profile from original template and rescale
         PANDA_LOG_DEBUG << "rescaling profile '" << static_cast<std::string>(_config.profile()) << "'";
@@ -307,44 +345,36 @@ void PulsarInjection<DataType>::next(DataType& data)
         PANDA_LOG_DEBUG << "mean = " << sum << ", scale = " << scale;
         // normalise to pseudo-S/N in 1s
         std::for_each(_profile.begin(), _profile.end(), [scale](PulsarProfile::ProfileDataPoint& dp) { dp *= scale; });
-        _last_number_of_spectra = nsamp;
-        _last_number_of_channels = nchan_const;
     }
     const uint_fast32_t nprof = _profile.size();
 
-    FftwAlloc<float> ism_convolution(nprof);
-    FftwAlloc<float> subpulse_map(nprof); // mask for the number of pulses actually present (nsubpulse out of n randomly selected)
-    FftwAlloc<float> subpulse_profile(nprof);
-    FftwAlloc<float> unsmeared_profile(nprof);
-    FftwAlloc<float> smeared_profile(nprof);
-
-    utils::ConvolvePlan ism_convolution_plan(nprof, unsmeared_profile, ism_convolution, smeared_profile);
-    utils::ConvolvePlan subpulse_convolution_plan(nprof, subpulse_profile, subpulse_map, unsmeared_profile);
-
-    for(std::size_t i = 0; i < nprof; ++i){
-        subpulse_profile[i] = 1.0;
-    }
-
-    double sum = 0.0;
-    // normalise the subpulse profile
-    for(std::size_t i = 0; i < nprof; ++i) {
-        sum += subpulse_profile[i];
-    }
-    sum /= (double) nprof;
-    // we also normalise by the number of subpulses so that the final subpulse profile will have an area of 1.
-    double scale = 1.0/sum/(float) nsubpulse;
-    for(std::size_t i = 0; i < nprof; ++i) {
-        subpulse_profile[i] = subpulse_profile[i] * scale;
+    // FFTW planning is expensive so the plans are only regenerated if the profile size changes
+    if(!_plan || _plan->profile_size != nprof)
+    {
+        PANDA_LOG_DEBUG << "generating FFTW plans for a profile of " << nprof << " bins";
+        _plan.reset();
+        _plan.reset(new InjectionPlan(nprof, nsubpulse));
+        std::string const& wisdom_file = _config.fftw_wisdom_file();
+        if(!wisdom_file.empty() && !fftwf_export_wisdom_to_filename(wisdom_file.c_str())) {
+            PANDA_LOG_WARN << "unable to save FFTW wisdom to '" << wisdom_file << "'";
+        }
+        rebuild_ism_models = true;
     }
+    InjectionPlan& plan = *_plan;
+    float* const ism_convolution = plan.ism_convolution.get();
+    float* const subpulse_map = plan.subpulse_map.get();
+    float* const unsmeared_profile = plan.unsmeared_profile.get();
+    float* const smeared_profile = plan.smeared_profile.get();
+    std::vector<std::vector<float>> const& ism_models = plan.ism_models;
+    std::vector<uint_fast32_t> const& ism_idx = plan.ism_idx;
+    std::vector<std::vector<float>>& grads = plan.grads;
+    std::vector<std::vector<float>>& output_prof = plan.output_prof;
 
     long double phase;
     int_fast32_t pbin;
     uint_fast32_t ch = 0;
     std::vector<boost::units::quantity<data::MegaHertz, double>> freq(nchan_const + 1);
     std::vector<float> sidx(nchan_const);
-    std::vector<uint_fast32_t> ism_idx(nchan_const);
-    IsmModels ism_models(nchan_const, nprof);
-    uint_fast32_t nism = 0;
     const uint_fast32_t NCOPY = nprof * sizeof(float);
     std::vector<double> poff(nchan_const);
 
@@ -352,7 +382,6 @@ void PulsarInjection<DataType>::next(DataType& data)
     double p0 = _phase_model(mjd, data.channel_frequencies()[0]);
 
     std::vector<int_fast32_t> prevbin(nchan_const);
-    int_fast32_t dbin;
 
     MjkRand rnd(seed);
     for (ch = 0; ch < nchan_const; ++ch) {
@@ -363,8 +392,11 @@ void PulsarInjection<DataType>::next(DataType& data)
     }
     freq[nchan_const] = freq[nchan_const -1] + (freq[nchan_const - 1] - freq[nchan_const -2]); // assume a const bin width
 
-    // set up the ISM model
+    // set up the ISM model (if it hasn't been done already for this data shape)
+    if(rebuild_ism_models)
     {
+        plan.ism_models.clear();
+        plan.ism_idx.resize(nchan_const);
         int_fast32_t dm_bin=-1;
         int_fast32_t scatter_bin=-1;
         float* dm_conv = ism_convolution; // re-use an existing convolution function
@@ -386,7 +418,7 @@ void PulsarInjection<DataType>::next(DataType& data)
 
             if ((pbin != dm_bin) != scatter_bin) {
                 // make new ISM model
-                sum = 0;
+                double sum = 0;
                 for(std::size_t i = 0; i < nprof; ++i) {
                     // create a dispersed sinc function profile modelling the telescope response function
                     // to use in convolution.
@@ -409,102 +441,119 @@ void PulsarInjection<DataType>::next(DataType& data)
                     scatt_conv[i] = 0;
                 }
 
-                convolve(ism_convolution_plan); // dm_conv * scatt_conv => out_conv
+                convolve(plan.ism_convolution_plan); // dm_conv * scatt_conv => out_conv
 
-                memcpy(ism_models[nism], out_conv, NCOPY);
-                ++nism;
+                plan.ism_models.emplace_back(out_conv, out_conv + nprof);
                 dm_bin = pbin;
                 scatter_bin = 0;
             }
-            ism_idx[ch] = nism - 1;
+            plan.ism_idx[ch] = plan.ism_models.size() - 1;
         }
+        grads.assign(plan.ism_models.size(), std::vector<float>(nprof));
+        output_prof.assign(plan.ism_models.size(), std::vector<float>(nprof));
+        _last_shape = shape;
+        PANDA_LOG_DEBUG << "Generated " << plan.ism_models.size() << " ISM models";
     }
-    PANDA_LOG_DEBUG << "Generated " << nism << " ISM models";
-
-    std::vector<std::vector<float>> grads(nism, std::vector<float>(nprof));
-    std::vector<std::vector<float>> output_prof(nism, std::vector<float>(nprof));
+    const uint_fast32_t nism = ism_models.size();
 
     PANDA_LOG_DEBUG << "Starting simulation";
-    uint64_t count = 0;
-    int64_t ip0;
+
+    // The phase model is evaluated serially (the tempo2 predictor is not guaranteed to be re-entrant).
+    // Each time the pulse number changes a new set of smeared profiles is generated, and the samples
+    // between these points are independent segments that can be processed a channel range at a time.
+    std::vector<double> sample_phase(nsamp);
+    std::vector<std::size_t> segments;
     int64_t prev_ip0 = INT64_MAX;
-    std::vector<float>rands(nchan_const);
     for(std::size_t sample_index = 0; sample_index < nsamp; ++sample_index)
     {
-        auto spectra = data.spectrum(sample_index);
-        auto channel_it = spectra.begin();
+        sample_phase[sample_index] = _phase_model(mjd, freq[0]);
+        int64_t const ip0 = (int64_t) floor(sample_phase[sample_index]);
+        if(ip0 != prev_ip0) {
+            segments.push_back(sample_index);
+            prev_ip0 = ip0;
+        }
+        mjd += tsamp_mjd;
+    }
+    segments.push_back(nsamp);
 
-        for (ch = 0; ch < nchan_const; ++ch) {
-            rands[ch] = rnd.rand_double();
+    auto generate_profiles = [&]()
+    {
+        for(std::size_t i = 0; i < nprof; i++) {
+            subpulse_map[i] = 0;
         }
-        p0 = _phase_model(mjd, freq[0]);
-        ip0 = (int64_t) floor(p0);
-        //pragma omp paralell private(i,n,ch,phase,frac,pbin,A,dbin) shared(ip0,prev_ip0)
-        {
-            if (ip0 != prev_ip0) {
-                for(std::size_t i = 0; i < nprof; i++) {
-                    subpulse_map[i] = 0;
-                }
-                if(nsubpulse==0) {
-                    // take the profile as given
-                    std::copy(_profile.begin(), _profile.end(), &unsmeared_profile[0]);
-                }
-                else {
-                    // generate subpulses
-                    for (n = 0; n < nsubpulse; ++n) {
-                        // subpulse_map - emulate that only parts of the pulse are actually seen(<=nsubpulse)
-                        std::size_t i = floor(rnd.rand_double() * nprof);
-                        subpulse_map[i] += exp(rnd.rand_gauss() * pulse_energy_sigma)/pulse_energy_norm;
-                    }
-                    // this convolution gives us a masked profile (i.e. a profile with random bits missing)
-                    // with the result in unsmeared_profile
-                    convolve(subpulse_convolution_plan);
+        if(nsubpulse==0) {
+            // take the profile as given
+            std::copy(_profile.begin(), _profile.end(), &unsmeared_profile[0]);
+        }
+        else {
+            // generate subpulses
+            for (n = 0; n < nsubpulse; ++n) {
+                // subpulse_map - emulate that only parts of the pulse are actually seen(<=nsubpulse)
+                std::size_t i = floor(rnd.rand_double() * nprof);
+                subpulse_map[i] += exp(rnd.rand_gauss() * pulse_energy_sigma)/pulse_energy_norm;
+            }
+            // this convolution gives us a masked profile (i.e. a profile with random bits missing)
+            // with the result in unsmeared_profile
+            convolve(plan.subpulse_convolution_plan);
 
-                    // use this mask to modulate the profile and define our unsmeared_profile
-                    std::transform(_profile.begin(), _profile.end(), &unsmeared_profile[0], &unsmeared_profile[0], std::multiplies<float>());
-                }
+            // use this mask to modulate the profile and define our unsmeared_profile
+            std::transform(_profile.begin(), _profile.end(), &unsmeared_profile[0], &unsmeared_profile[0], std::multiplies<float>());
+        }
 
-                //pragma omp single
-                {
-                    for(std::size_t i = 0; i < nism; ++i) {
-                        memcpy(static_cast<float*>(ism_convolution), ism_models[i], NCOPY);
-                        convolve(ism_convolution_plan);
-                        memcpy(static_cast<void*>(&output_prof[i][0]), static_cast<void*>(smeared_profile), NCOPY);
-                        for (n = 0; n < nprof - 1; ++n) {
-                            grads[i][n] = smeared_profile[n + 1] - smeared_profile[n];
-                        }
-                        grads[i][nprof - 1] = smeared_profile[0] - smeared_profile[nprof - 1];
-                    }
-                    prev_ip0 = ip0;
-                }
+        for(std::size_t i = 0; i < nism; ++i) {
+            memcpy(ism_convolution, ism_models[i].data(), NCOPY);
+            convolve(plan.ism_convolution_plan);
+            memcpy(static_cast<void*>(&output_prof[i][0]), static_cast<void*>(smeared_profile), NCOPY);
+            for (std::size_t j = 0; j < nprof - 1; ++j) {
+                grads[i][j] = smeared_profile[j + 1] - smeared_profile[j];
             }
-            //pragma omp  for  schedule(dynamic,128)
-            for (ch = 0; ch < nchan_const; ++ch) {
-                phase = p0 + poff[ch];
-                phase = phase - floor(phase);
-                pbin = floor(phase * nprof);
-                frac = phase * nprof - pbin;
-                float final_signal = output_prof[ism_idx[ch]][pbin] + frac * grads[ism_idx[ch]][pbin];
-                if (prevbin[ch] < 0) prevbin[ch] = pbin;
-                dbin = pbin - prevbin[ch];
-                while (dbin < 0) dbin += nprof;
-                while (dbin > 1) {
-                    final_signal += output_prof[ism_idx[ch]][prevbin[ch]];
-                    prevbin[ch] += 1;
-                    dbin = pbin - prevbin[ch];
+            grads[i][nprof - 1] = smeared_profile[0] - smeared_profile[nprof - 1];
+        }
+    };
+
+    // The channels are split into a fixed number of ranges, each with its own random number stream,
+    // so the output for a given seed does not depend on the number of threads.
+    MjkRand channel_rnd(seed + 1);
+    unsigned const number_of_streams = channel_rnd.number_of_streams();
+
+    for(std::size_t segment = 0; segment + 1 < segments.size(); ++segment)
+    {
+        generate_profiles();
+        _workers.run(number_of_streams, [&](std::size_t stream)
+        {
+            std::size_t const channel_begin = stream * nchan_const / number_of_streams;
+            std::size_t const channel_end = (stream + 1) * nchan_const / number_of_streams;
+            for(std::size_t sample_index = segments[segment]; sample_index < segments[segment + 1]; ++sample_index)
+            {
+                double const p0 = sample_phase[sample_index];
+                auto channel_it = data.spectrum(sample_index).begin();
+                std::advance(channel_it, channel_begin);
+                for(std::size_t ch = channel_begin; ch < channel_end; ++ch) {
+                    double const rand = channel_rnd.rand_double(stream);
+                    long double phase = p0 + poff[ch];
+                    phase = phase - floor(phase);
+                    int_fast32_t pbin = floor(phase * nprof);
+                    float const frac = phase * nprof - pbin;
+                    std::vector<float> const& prof = output_prof[ism_idx[ch]];
+                    float final_signal = prof[pbin] + frac * grads[ism_idx[ch]][pbin];
+                    if (prevbin[ch] < 0) prevbin[ch] = pbin;
+                    int_fast32_t dbin = pbin - prevbin[ch];
                     while (dbin < 0) dbin += nprof;
-                }
+                    while (dbin > 1) {
+                        final_signal += prof[prevbin[ch]];
+                        prevbin[ch] += 1;
+                        dbin = pbin - prevbin[ch];
+                        while (dbin < 0) dbin += nprof;
+                    }
 
-                if (final_signal > 0) {
-                    *channel_it += floor(sidx[ch] * final_signal + rands[ch]);
+                    if (final_signal > 0) {
+                        *channel_it += floor(sidx[ch] * final_signal + rand);
+                    }
+                    ++channel_it;
+                    prevbin[ch] = pbin;
                 }
-                ++channel_it;
-                prevbin[ch] = pbin;
             }
-        }
-
-        mjd += tsamp_mjd;
-        count++;
+        });
     }
     PANDA_LOG_DEBUG << "Simulation ended.";
 }
@@ -22,14 +22,9 @@
  * SOFTWARE.
  */
 #include "../RfiGenerator.h"
+#include <algorithm>
+#include <array>
 #include <cmath>
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-#include <boost/accumulators/accumulators.hpp>
-#include <boost/accumulators/statistics/stats.hpp>
-#include <boost/accumulators/statistics/mean.hpp>
-#include <boost/accumulators/statistics/variance.hpp>
-#pragma GCC diagnostic pop
 
 namespace ska {
 namespace cheetah {
@@ -54,6 +49,45 @@ void RfiGenerator<DataType>::next(DataType& data)
     this->next(flagged_data);
 }
 
+template<typename DataType>
+typename RfiGenerator<DataType>::Statistics RfiGenerator<DataType>::statistics(DataType const& data)
+{
+    // independent partial sums in each lane so the loop can be vectorised
+    static constexpr std::size_t lanes = 8;
+    std::array<double, lanes> sum;
+    std::array<double, lanes> sum_of_squares;
+    sum.fill(0.0);
+    sum_of_squares.fill(0.0);
+
+    std::size_t const size = std::distance(data.begin(), data.end());
+    if(size == 0) return Statistics{0.0f, 0.0f};
+    auto const* values = &*data.begin();
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes) {
+        for(std::size_t lane = 0; lane < lanes; ++lane) {
+            double const value = values[i + lane];
+            sum[lane] += value;
+            sum_of_squares[lane] += value * value;
+        }
+    }
+    for(; i < size; ++i) {
+        double const value = values[i];
+        sum[0] += value;
+        sum_of_squares[0] += value * value;
+    }
+
+    double total = 0.0;
+    double total_of_squares = 0.0;
+    for(std::size_t lane = 0; lane < lanes; ++lane) {
+        total += sum[lane];
+        total_of_squares += sum_of_squares[lane];
+    }
+    double const mean = total / size;
+    double const variance = std::max(0.0, total_of_squares / size - mean * mean);
+    return Statistics{static_cast<float>(mean), static_cast<float>(std::sqrt(variance))};
+}
+
 template<typename DataType>
 void RfiGenerator<DataType>::rfi_gaussian_block(FlaggedDataType& flagged_data
                             , std::size_t min_channel
@@ -63,53 +97,77 @@ void RfiGenerator<DataType>::rfi_gaussian_block(FlaggedDataType& flagged_data
                             , float sigma
                             )
 {
-    DataType& data = static_cast<DataType&>(flagged_data);
-    boost::accumulators::accumulator_set<double, boost::accumulators::stats<boost::accumulators::tag::variance,boost::accumulators::tag::mean> > acc;
-    for_each(data.begin(), data.end(), std::bind<void>(std::ref(acc), std::placeholders::_1));
+    rfi_gaussian_block(flagged_data, min_channel, max_channel, min_sample_number, max_sample_number, sigma
+                      , statistics(static_cast<DataType const&>(flagged_data)));
+}
 
-    float mean      = boost::accumulators::mean(acc);
-    float variance  = boost::accumulators::variance(acc);
-    float stddev    = sqrtf(variance);
+template<typename DataType>
+void RfiGenerator<DataType>::rfi_gaussian_block(FlaggedDataType& flagged_data
+                            , std::size_t min_channel
+                            , std::size_t max_channel
+                            , std::size_t min_sample_number
+                            , std::size_t max_sample_number
+                            , float sigma
+                            , Statistics const& statistics
+                            )
+{
+    DataType& data = static_cast<DataType&>(flagged_data);
 
     // Choose a peak value. This should depend on the size of the data, because the highest expected stochastic outlier
     // obviously increases when you draw more samples from a normal distribution.
     // General rule is sigma>=10 for strong RFI and less for weak. That should surely be detected and will very seldom be a noise
     // peak, i.e. falsely flagged.
-    float    max           = mean + sigma * stddev;
+    float    max           = statistics.mean + sigma * statistics.standard_deviation;
 
     // Determine centre of data chunk.
-    int centre_sample    = int((max_sample_number + min_sample_number)/2);
-    int centre_channel   = int((max_channel + min_channel)/2);
+    long centre_sample    = long((max_sample_number + min_sample_number)/2);
+    long centre_channel   = long((max_channel + min_channel)/2);
     float channel_gaussian_width = (max_channel - min_channel)/2.0;
     float time_gaussian_width = ((max_sample_number - min_sample_number)/2.0);
-    float channel_gaussian_variance = powf(channel_gaussian_width/2.355, 2.0f);
-    float time_gaussian_variance = powf(time_gaussian_width/2.355, 2.0f);
+    float channel_gaussian_variance = (channel_gaussian_width/2.355f) * (channel_gaussian_width/2.355f);
+    float time_gaussian_variance = (time_gaussian_width/2.355f) * (time_gaussian_width/2.355f);
+
+    // The gaussian is separable (exp(-(a + b)) = exp(-a) * exp(-b)) so tabulate each dimension once
+    // leaving only a multiply-add for each element.
+    std::size_t const number_of_channels = max_channel - min_channel + 1;
+    _channel_envelope.resize(number_of_channels);
+    for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+        float const offset = float(min_channel + channel) - float(centre_channel);
+        _channel_envelope[channel] = max * std::exp(-(offset * offset)/(2.0f*channel_gaussian_variance));
+    }
+    _time_envelope.resize(max_sample_number - min_sample_number);
+    for(std::size_t sample = 0; sample < _time_envelope.size(); ++sample) {
+        float const offset = float(min_sample_number + sample) - float(centre_sample);
+        _time_envelope[sample] = std::exp(-(offset * offset)/(2.0f*time_gaussian_variance));
+    }
+
+    // flag the channels and samples within the width of the centre
+    long const channel_half_width = long(std::floor(channel_gaussian_width));
+    long const sample_half_width = long(std::floor(time_gaussian_width));
+    long const min_flag_channel = std::max(long(min_channel), centre_channel - channel_half_width);
+    long const max_flag_channel = std::min(long(max_channel), centre_channel + channel_half_width);
+
     auto & flags = flagged_data.rfi_flags();
 
-    for (unsigned time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
+    for (std::size_t time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
     {
+        float const time_envelope = _time_envelope[time_sample - min_sample_number];
         auto spectrum = data.spectrum(time_sample);
         auto channel_it = spectrum.begin();
         channel_it += min_channel;
-        unsigned channel_number = min_channel;
-        auto flag_slice = flags.spectrum(time_sample);
-        auto flag_it = flag_slice.begin();
-        flag_it += min_channel;
-        while(channel_number <= max_channel)
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel)
         {
-            *channel_it += max * std::exp(-( (powf(float(channel_number) - float(centre_channel), 2.0f)/(2.0f*channel_gaussian_variance))
-                                          + (powf(float(time_sample) - float(centre_sample), 2.0f)/(2.0f*time_gaussian_variance))));
-            if(time_sample<centre_sample+std::floor(time_gaussian_width)+1 &&
-               time_sample>centre_sample-std::floor(time_gaussian_width)-1 &&
-               channel_number<centre_channel+std::floor(channel_gaussian_width)+1 &&
-               channel_number>centre_channel-std::floor(channel_gaussian_width)-1)
-            {
-                *flag_it = true;
-            }
-
-            ++flag_it;
+            *channel_it += time_envelope * _channel_envelope[channel];
             ++channel_it;
-            ++channel_number;
+        }
+
+        long const sample_offset = long(time_sample) - centre_sample;
+        if(sample_offset >= -sample_half_width && sample_offset <= sample_half_width && min_flag_channel <= max_flag_channel)
+        {
+            auto flag_slice = flags.spectrum(time_sample);
+            auto flag_it = flag_slice.begin();
+            flag_it += min_flag_channel;
+            std::fill_n(flag_it, max_flag_channel - min_flag_channel + 1, true);
         }
     }
 }
@@ -120,40 +178,51 @@ void RfiGenerator<DataType>::rfi_ramp_block(FlaggedDataType& flagged_data
               , std::size_t max_channel
               , std::size_t min_sample_number
               , std::size_t max_sample_number)
+{
+    rfi_ramp_block(flagged_data, min_channel, max_channel, min_sample_number, max_sample_number
+                  , statistics(static_cast<DataType const&>(flagged_data)));
+}
+
+template<typename DataType>
+void RfiGenerator<DataType>::rfi_ramp_block(FlaggedDataType& flagged_data
+              , std::size_t min_channel
+              , std::size_t max_channel
+              , std::size_t min_sample_number
+              , std::size_t max_sample_number
+              , Statistics const& statistics)
 {
     DataType& data = static_cast<DataType&>(flagged_data);
-    boost::accumulators::accumulator_set<double, boost::accumulators::stats<boost::accumulators::tag::variance,boost::accumulators::tag::mean> > acc;
-    for_each(data.begin(), data.end(), std::bind<void>(std::ref(acc), std::placeholders::_1));
 
-    float mean      = boost::accumulators::mean(acc);
-    float variance  = boost::accumulators::variance(acc);
-    float stddev    = sqrtf(variance);
     // Choose a peak value. This should depend on the size of the data, because the highest expected stochastic outlier
     // obviously increases when you draw more samples from a normal distribution.
     // For now, I have chosen 10 standard deviations. That should surely be detected and will very seldom be a noise
     // peak, i.e. falsely flagged.
-    float    max    = mean + 10.0f * stddev;
+    float    max    = statistics.mean + 10.0f * statistics.standard_deviation;
     float    slope  = 1.0f/float(max_channel - min_channel);
 
+    // the ramp is the same for each spectrum
+    std::size_t const number_of_channels = max_channel - min_channel + 1;
+    _channel_envelope.resize(number_of_channels);
+    for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+        _channel_envelope[channel] = max * slope * channel;
+    }
+
     auto & flags = flagged_data.rfi_flags();
 
-    for (unsigned time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
+    for (std::size_t time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
     {
         auto spectrum = data.spectrum(time_sample);
         auto channel_it = spectrum.begin();
         channel_it += min_channel;
-        unsigned channel_number = min_channel;
-        auto flag_slice = flags.spectrum(time_sample);
-        auto flag_it = flag_slice.begin();
-        flag_it += min_channel;
-        while(channel_number <= max_channel)
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel)
         {
-            *channel_it += max * slope * (channel_number - min_channel);
-            *flag_it=true;
-            ++flag_it;
+            *channel_it += _channel_envelope[channel];
             ++channel_it;
-            ++channel_number;
         }
+        auto flag_slice = flags.spectrum(time_sample);
+        auto flag_it = flag_slice.begin();
+        flag_it += min_channel;
+        std::fill_n(flag_it, number_of_channels, true);
     }
 }
 
@@ -164,52 +233,61 @@ void RfiGenerator<DataType>::rfi_broadband_block(FlaggedDataType& flagged_data
                             , float sigma
                             )
 {
-    DataType& data = static_cast<DataType&>(flagged_data);
-    boost::accumulators::accumulator_set<double, boost::accumulators::stats<boost::accumulators::tag::variance,boost::accumulators::tag::mean> > acc;
-    for_each(data.begin(), data.end(), std::bind<void>(std::ref(acc), std::placeholders::_1));
+    rfi_broadband_block(flagged_data, min_sample_number, max_sample_number, sigma
+                       , statistics(static_cast<DataType const&>(flagged_data)));
+}
 
-    float mean      = boost::accumulators::mean(acc);
-    float variance  = boost::accumulators::variance(acc);
-    float stddev    = sqrtf(variance);
+template<typename DataType>
+void RfiGenerator<DataType>::rfi_broadband_block(FlaggedDataType& flagged_data
+                            , std::size_t min_sample_number
+                            , std::size_t max_sample_number
+                            , float sigma
+                            , Statistics const& statistics
+                            )
+{
+    DataType& data = static_cast<DataType&>(flagged_data);
     std::size_t min_channel = 1;
     std::size_t max_channel = flagged_data.number_of_channels()-1;
 
     //width of the gaussian pulse is taken as the half of the given time range. We can compute the width of the gaussian
     float width = float((max_sample_number-min_sample_number)/2.0f);
-    float variance_of_gaussian =  powf(width/2.355, 2.0f);
+    float variance_of_gaussian = (width/2.355f) * (width/2.355f);
 
     // Choose a peak value. This should depend on the size of the data, because the highest expected stochastic outlier
     // obviously increases when you draw more samples from a normal distribution.
     // General rule is sigma>=10 for strong RFI and less for weak. That should surely be detected and will very seldom be a noise
     // peak, i.e. falsely flagged.
-    float    max           = mean + sigma * stddev;
+    float    max           = statistics.mean + sigma * statistics.standard_deviation;
 
     // Determine centre of data chunk.
-    int centre_sample    = int((max_sample_number + min_sample_number)/2);
+    long centre_sample    = long((max_sample_number + min_sample_number)/2);
+    long const sample_half_width = long(std::floor(width));
 
     auto & flags = flagged_data.rfi_flags();
 
-    for (unsigned time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
+    std::size_t const number_of_channels = (max_channel >= min_channel) ? max_channel - min_channel + 1 : 0;
+    for (std::size_t time_sample = min_sample_number; time_sample < max_sample_number; ++time_sample)
     {
+        // the signal is constant across the band for each sample
+        float const offset = float(time_sample) - float(centre_sample);
+        float const value = max * std::exp(-(offset * offset)/(2.0f*variance_of_gaussian));
+
         auto spectrum = data.spectrum(time_sample);
         auto channel_it = spectrum.begin();
         channel_it += min_channel;
-        unsigned channel_number = min_channel;
-        auto flag_slice = flags.spectrum(time_sample);
-        auto flag_it = flag_slice.begin();
-        flag_it += min_channel;
-        while(channel_number <= max_channel)
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel)
         {
-            *channel_it += max * std::exp(-(powf(float(time_sample) - float(centre_sample), 2.0f))/(2.0f*variance_of_gaussian));
-            if(time_sample<centre_sample+std::floor(width)+1 &&
-               time_sample>centre_sample-std::floor(width)-1)
-            {
-                *flag_it = true;
-            }
-
-            ++flag_it;
+            *channel_it += value;
             ++channel_it;
-            ++channel_number;
+        }
+
+        long const sample_offset = long(time_sample) - centre_sample;
+        if(sample_offset >= -sample_half_width && sample_offset <= sample_half_width)
+        {
+            auto flag_slice = flags.spectrum(time_sample);
+            auto flag_it = flag_slice.begin();
+            flag_it += min_channel;
+            std::fill_n(flag_it, number_of_channels, true);
         }
     }
 }
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "cheetah/generators/RfiScenario.h"
+#include "panda/Log.h"
 #include <random>
 
 
@@ -29,6 +30,21 @@ namespace ska {
 namespace cheetah {
 namespace generators {
 
+namespace {
+
+// a seed of 0 is replaced by a random one. The seed in use is logged so that the run can be replayed
+inline std::size_t rfi_scenario_seed(std::size_t seed, char const* scenario_name)
+{
+    if(seed == 0) {
+        std::random_device rd;
+        seed = (static_cast<std::size_t>(rd()) << 32) ^ rd();
+    }
+    PANDA_LOG << scenario_name << " using seed " << seed;
+    return seed;
+}
+
+} // namespace
+
 
 // -------------------- Scenario 0 ---------------------
 template<typename DataType>
@@ -112,6 +128,14 @@ void RfiScenario<2, DataType>::next(FlaggedDataType& data)
 // -------------------- Scenario 3 ---------------------
 template<typename DataType>
 RfiScenario<3, DataType>::RfiScenario()
+    : RfiScenario(RfiScenarioConfig())
+{
+}
+
+template<typename DataType>
+RfiScenario<3, DataType>::RfiScenario(RfiScenarioConfig const& config)
+    : _seed(rfi_scenario_seed(config.seed(), "RfiScenario<3>"))
+    , _engine(_seed)
 {
 }
 
@@ -123,6 +147,12 @@ RfiScenario<3, DataType>::~RfiScenario()
 template<typename DataType>
 constexpr char RfiScenario<3, DataType>::description[];
 
+template<typename DataType>
+std::size_t RfiScenario<3, DataType>::seed() const
+{
+    return _seed;
+}
+
 template<typename DataType>
 void RfiScenario<3, DataType>::next(FlaggedDataType& data)
 {
@@ -131,13 +161,14 @@ void RfiScenario<3, DataType>::next(FlaggedDataType& data)
     if(channel_range>32) channel_range = 32;
     if(sample_range>64) sample_range = 64;
 
-    std::random_device rd;
-    std::mt19937 mt(rd());
     std::uniform_int_distribution<int> dist(sample_range, data.number_of_spectra()-sample_range);
 
     std::size_t pulse_channel_centre = data.number_of_channels()/4;
     std::size_t min_channel  = pulse_channel_centre-channel_range;
     std::size_t max_channel  = pulse_channel_centre+channel_range;
+
+    // scale all the spikes to the statistics of the block before any RFI is added
+    auto const statistics = BaseT::statistics(static_cast<DataType const&>(data));
     for(int i=0;i<4;++i)
     {
         if(i==2)
@@ -146,17 +177,25 @@ void RfiScenario<3, DataType>::next(FlaggedDataType& data)
             min_channel  = pulse_channel_centre-channel_range;
             max_channel  = pulse_channel_centre+channel_range;
         }
-        std::size_t pulse_sample_centre = dist(mt);
+        std::size_t pulse_sample_centre = dist(_engine);
 
         std::size_t min_sample   = pulse_sample_centre-sample_range;
         std::size_t max_sample   = pulse_sample_centre+sample_range;
-        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample,6.0);
+        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample, 6.0, statistics);
     }
 }
 
 // -------------------- Scenario 4 ---------------------
 template<typename DataType>
 RfiScenario<4, DataType>::RfiScenario()
+    : RfiScenario(RfiScenarioConfig())
+{
+}
+
+template<typename DataType>
+RfiScenario<4, DataType>::RfiScenario(RfiScenarioConfig const& config)
+    : _seed(rfi_scenario_seed(config.seed(), "RfiScenario<4>"))
+    , _engine(_seed)
 {
 }
 
@@ -168,6 +207,12 @@ RfiScenario<4, DataType>::~RfiScenario()
 template<typename DataType>
 constexpr char RfiScenario<4, DataType>::description[];
 
+template<typename DataType>
+std::size_t RfiScenario<4, DataType>::seed() const
+{
+    return _seed;
+}
+
 template<typename DataType>
 void RfiScenario<4, DataType>::next(FlaggedDataType& data)
 {
@@ -176,27 +221,26 @@ void RfiScenario<4, DataType>::next(FlaggedDataType& data)
     if(channel_range>32) channel_range = 32;
     if(sample_range>128) sample_range = 128;
 
-    std::random_device rd;
-    std::mt19937 mt(rd());
     std::uniform_int_distribution<int> sample_dist(sample_range, data.number_of_spectra()-sample_range);
     std::uniform_int_distribution<int> channel_dist(channel_range, data.number_of_channels()-channel_range);
     std::uniform_int_distribution<int> sample_width_dist(sample_range/8, 2*sample_range);
     std::uniform_int_distribution<int> channel_width_dist(channel_range/4, 2*channel_range);
     unsigned number_of_pulses = 8;
+    auto const statistics = BaseT::statistics(static_cast<DataType const&>(data));
     for(unsigned i=0;i<number_of_pulses;++i)
     {
-        std::size_t pulse_channel_width =  channel_width_dist(mt);
-        std::size_t pulse_sample_width =  sample_width_dist(mt);
+        std::size_t pulse_channel_width =  channel_width_dist(_engine);
+        std::size_t pulse_sample_width =  sample_width_dist(_engine);
 
-        std::size_t pulse_channel_centre = channel_dist(mt);
+        std::size_t pulse_channel_centre = channel_dist(_engine);
         std::size_t min_channel  = pulse_channel_centre-pulse_channel_width/2;
         std::size_t max_channel  = pulse_channel_centre+pulse_channel_width/2;
 
-        std::size_t pulse_sample_centre = sample_dist(mt);
+        std::size_t pulse_sample_centre = sample_dist(_engine);
 
         std::size_t min_sample   = pulse_sample_centre-pulse_sample_width/2;
         std::size_t max_sample   = pulse_sample_centre+pulse_sample_width/2;
-        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample,6.0);
+        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample, 6.0, statistics);
     }
 }
 
@@ -253,12 +297,13 @@ void RfiScenario<6, T>::next(FlaggedDataType& data)
     std::size_t min_sample            =  1*sample_stride;
     std::size_t max_sample            =  3*sample_stride;
 
+    auto const statistics = BaseT::statistics(static_cast<T const&>(data));
     for(unsigned i=0; i<factor-1; ++i)
     {
         min_sample            +=  4*sample_stride;
         max_sample            +=  4*sample_stride;
 
-        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample,6.0);
+        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample, 6.0, statistics);
     }
 }
 
@@ -314,12 +359,13 @@ void RfiScenario<8, T>::next(FlaggedDataType& data)
     std::size_t min_sample            =  1*sample_stride;
     std::size_t max_sample            =  3*sample_stride;
 
+    auto const statistics = BaseT::statistics(static_cast<T const&>(data));
     for(unsigned i=0; i<factor-1; ++i)
     {
         min_sample            +=  4*sample_stride;
         max_sample            +=  4*sample_stride;
 
-        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample,4.0);
+        this->rfi_gaussian_block(data, min_channel, max_channel, min_sample, max_sample, 4.0, statistics);
     }
 }
 
@@ -375,12 +421,13 @@ void RfiScenario<10, T>::next(FlaggedDataType& data)
     std::size_t min_sample            =  1*sample_stride;
     std::size_t max_sample            =  3*sample_stride;
 
+    auto const statistics = BaseT::statistics(static_cast<T const&>(data));
     for(unsigned i=0; i<factor-1; ++i)
     {
         min_sample            +=  4*sample_stride;
         max_sample            +=  4*sample_stride;
 
-        this->rfi_broadband_block(data, min_sample, max_sample,5.0);
+        this->rfi_broadband_block(data, min_sample, max_sample, 5.0, statistics);
     }
 }
 #endif // NDEBUG
@@ -35,6 +35,7 @@ Config::Config()
     add(_gaussian_noise);
     //add(_baseband_gaussian_noise);
     add(_dispersed_pulse);
+    add(_rfi_scenario);
     add_factory("pulsar_injection", [](){ return new PulsarInjectionConfig(); });
 }
 
@@ -61,6 +62,16 @@ DispersedPulseConfig const& Config::dispersed_pulse() const
     return _dispersed_pulse;
 }
 
+RfiScenarioConfig const& Config::rfi_scenario() const
+{
+    return _rfi_scenario;
+}
+
+RfiScenarioConfig& Config::rfi_scenario()
+{
+    return _rfi_scenario;
+}
+
 Config::PulsarInjectionIterartorType Config::pulsar_injection_begin() const
 {
     return PulsarInjectionIterartorType(subsection("pulsar_injection"));
@@ -33,6 +33,8 @@ GaussianNoiseConfig::GaussianNoiseConfig()
     : cheetah::utils::Config("gaussian_noise")
     , _mean(96.0)
     , _deviation(24.0)
+    , _seed(0)
+    , _number_of_threads(1)
 {
 }
 
@@ -44,7 +46,9 @@ void GaussianNoiseConfig::add_options(OptionsDescriptionEasyInit& add_options)
 {
     add_options
     ("mean", boost::program_options::value<float>(&_mean)->default_value(_mean), "The mean value of the distribution")
-    ("dev", boost::program_options::value<float>(&_deviation)->default_value(_deviation), "The deviation of the distribution");
+    ("dev", boost::program_options::value<float>(&_deviation)->default_value(_deviation), "The deviation of the distribution")
+    ("seed", boost::program_options::value<std::size_t>(&_seed)->default_value(_seed), "random number seed (0=seed from std::random_device)")
+    ("threads", boost::program_options::value<unsigned>(&_number_of_threads)->default_value(_number_of_threads), "the number of threads to use");
 }
 
 float GaussianNoiseConfig::mean() const
@@ -67,6 +71,26 @@ void GaussianNoiseConfig::std_deviation(float val)
     _deviation = val;
 }
 
+std::size_t GaussianNoiseConfig::seed() const
+{
+    return _seed;
+}
+
+void GaussianNoiseConfig::seed(std::size_t seed)
+{
+    _seed = seed;
+}
+
+unsigned GaussianNoiseConfig::number_of_threads() const
+{
+    return _number_of_threads;
+}
+
+void GaussianNoiseConfig::number_of_threads(unsigned number_of_threads)
+{
+    _number_of_threads = number_of_threads;
+}
+
 } // namespace generators
 } // namespace cheetah
 } // namespace ska
\ No newline at end of file
@@ -23,6 +23,7 @@
  */
 #include "cheetah/generators/GeneratorAppConfig.h"
 #include "cheetah/data/Units.h"
+#include "cheetah/utils/JulianClock.h"
 #include "cheetah/version.h"
 
 
@@ -34,11 +35,13 @@ namespace generators {
 GeneratorAppConfig::GeneratorAppConfig(std::string const& app_name, std::string const& description)
     : BasicAppConfig(app_name, description)
     , _number_of_chunks(1)
+    , _number_of_buffers(2)
     , _number_of_channels(1024)
     , _number_of_time_samples(4096)
     , _frequency(1200.0 * boost::units::si::mega * data::hz)
     , _channel_width(-300.0 * boost::units::si::kilo * data::hz)
     , _sample_interval(1.0 * boost::units::si::milli * boost::units::si::seconds)
+    , _start_time()
 {
     add(_generator_config);
     add(_sigproc_config);
@@ -58,6 +61,11 @@ sigproc::WriterConfig const& GeneratorAppConfig::sigproc_config() const
     return _sigproc_config;
 }
 
+sigproc::WriterConfig& GeneratorAppConfig::sigproc_config()
+{
+    return _sigproc_config;
+}
+
 std::string GeneratorAppConfig::version() const
 {
     return std::string(cheetah::version) + "\n" + BasicAppConfig::version();
@@ -83,6 +91,8 @@ void GeneratorAppConfig::add_options(OptionsDescriptionEasyInit& add_options)
               , "the number of time samples in each block of data")
     ("chunks", boost::program_options::value<std::size_t>(&_number_of_chunks)->default_value(_number_of_chunks)
              , "the number of block of data to generate")
+    ("buffers", boost::program_options::value<std::size_t>(&_number_of_buffers)->default_value(_number_of_buffers)
+              , "the number of blocks of data to cycle through, allowing the generation of one block to overlap writing the others")
     ("start_freq", boost::program_options::value<typename FrequencyType::value_type>()->default_value(_frequency.value())
                    ->notifier([this](typename FrequencyType::value_type const& val)
                               {
@@ -100,7 +110,13 @@ void GeneratorAppConfig::add_options(OptionsDescriptionEasyInit& add_options)
                               {
                                 _sample_interval= val * boost::units::si::seconds;
                               })
-                    , "the width of each channel (MHz)");
+                    , "the width of each channel (MHz)")
+    ("start_mjd", boost::program_options::value<double>()->default_value(0.0)
+                   ->notifier([this](double const& val)
+                              {
+                                _start_time = TimePointType(utils::julian_day(val));
+                              })
+                , "the MJD of the first sample (0 uses the current time)");
 }
 
 void GeneratorAppConfig::set_generator_list(std::vector<std::string> const& generator_names)
@@ -118,21 +134,51 @@ std::vector<std::string> const& GeneratorAppConfig::data_generator() const
     return _generator_selected;
 }
 
+void GeneratorAppConfig::data_generator(std::vector<std::string> const& generator_names)
+{
+    _generator_selected = generator_names;
+}
+
 std::size_t GeneratorAppConfig::number_of_chunks() const
 {
     return _number_of_chunks;
 }
 
+void GeneratorAppConfig::number_of_chunks(std::size_t n)
+{
+    _number_of_chunks = n;
+}
+
+std::size_t GeneratorAppConfig::number_of_buffers() const
+{
+    return _number_of_buffers;
+}
+
+void GeneratorAppConfig::number_of_buffers(std::size_t n)
+{
+    _number_of_buffers = n;
+}
+
 std::size_t GeneratorAppConfig::number_of_time_samples() const
 {
     return _number_of_time_samples;
 }
 
+void GeneratorAppConfig::number_of_time_samples(std::size_t n)
+{
+    _number_of_time_samples = n;
+}
+
 std::size_t GeneratorAppConfig::number_of_channels() const
 {
     return _number_of_channels;
 }
 
+void GeneratorAppConfig::number_of_channels(std::size_t n)
+{
+    _number_of_channels = n;
+}
+
 typename GeneratorAppConfig::FrequencyType GeneratorAppConfig::start_frequency() const
 {
     return _frequency;
@@ -148,6 +194,16 @@ typename GeneratorAppConfig::IntervalType GeneratorAppConfig::sample_interval()
     return _sample_interval;
 }
 
+typename GeneratorAppConfig::TimePointType const& GeneratorAppConfig::start_time() const
+{
+    return _start_time;
+}
+
+void GeneratorAppConfig::start_time(TimePointType const& start_time)
+{
+    _start_time = start_time;
+}
+
 } // namespace generators
 } // namespace cheetah
 } // namespace ska
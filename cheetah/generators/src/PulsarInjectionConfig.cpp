@@ -38,6 +38,8 @@ PulsarInjectionConfig::PulsarInjectionConfig(std::string const& tag_name)
     , _profile_name("B0011+47")
     , _phase_model_factory(*this)
     , _dm(50.0*data::parsecs_per_cube_cm)
+    , _seed(0)
+    , _number_of_threads(8)
 {
     add(_simple_phase_model_config);
     add(_tempo2_phase_model_config);
@@ -73,6 +75,9 @@ void PulsarInjectionConfig::add_options(OptionsDescriptionEasyInit& add_options)
                             }
                         )
                       , phase_model_type_help.c_str() )
+        ("fftw_wisdom", boost::program_options::value<std::string>(&_fftw_wisdom_file)->default_value(_fftw_wisdom_file), "file to load/save FFTW plans (wisdom) so that restarts skip the planning stage")
+        ("seed", boost::program_options::value<std::size_t>(&_seed)->default_value(_seed), "random number seed (0=seed from the clock)")
+        ("threads", boost::program_options::value<unsigned>(&_number_of_threads)->default_value(_number_of_threads), "the number of threads to use (max 8)")
     ;
 }
 
@@ -139,6 +144,36 @@ void PulsarInjectionConfig::dm(data::DedispersionMeasureType<double> dm)
     _dm = dm;
 }
 
+std::string const& PulsarInjectionConfig::fftw_wisdom_file() const
+{
+    return _fftw_wisdom_file;
+}
+
+void PulsarInjectionConfig::fftw_wisdom_file(std::string const& filename)
+{
+    _fftw_wisdom_file = filename;
+}
+
+std::size_t PulsarInjectionConfig::seed() const
+{
+    return _seed;
+}
+
+void PulsarInjectionConfig::seed(std::size_t seed)
+{
+    _seed = seed;
+}
+
+unsigned PulsarInjectionConfig::number_of_threads() const
+{
+    return _number_of_threads;
+}
+
+void PulsarInjectionConfig::number_of_threads(unsigned number_of_threads)
+{
+    _number_of_threads = number_of_threads;
+}
+
 } // namespace generators
 } // namespace cheetah
 } // namespace ska
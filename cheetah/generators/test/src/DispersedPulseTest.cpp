@@ -0,0 +1,123 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/generators/test/DispersedPulseTest.h"
+#include "cheetah/generators/DispersedPulse.h"
+#include "cheetah/data/TimeFrequency.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace ska {
+namespace cheetah {
+namespace generators {
+namespace test {
+
+
+DispersedPulseTest::DispersedPulseTest()
+    : ::testing::Test()
+{
+}
+
+DispersedPulseTest::~DispersedPulseTest()
+{
+}
+
+void DispersedPulseTest::SetUp()
+{
+}
+
+void DispersedPulseTest::TearDown()
+{
+}
+
+namespace {
+
+typedef data::TimeFrequency<Cpu, uint8_t> TimeFrequencyType;
+
+TimeFrequencyType make_data(double sample_interval_s, double fch1_mhz, double channel_width_mhz)
+{
+    TimeFrequencyType data(data::DimensionSize<data::Time>(500), data::DimensionSize<data::Frequency>(16));
+    std::fill(data.begin(), data.end(), 0);
+    data.sample_interval(sample_interval_s * boost::units::si::seconds);
+    data.set_channel_frequencies_const_width(TimeFrequencyType::FrequencyType(fch1_mhz * boost::units::si::mega * boost::units::si::hertz),
+                                             TimeFrequencyType::FrequencyType(channel_width_mhz * boost::units::si::mega * boost::units::si::hertz));
+    return data;
+}
+
+// the pulse occupies the samples [delay, delay + width) of each channel, delay = round(k.DM.(1/f^2 - 1/f_top^2)/tsamp)
+void verify_pulse(TimeFrequencyType& data, double dm, std::size_t width)
+{
+    auto const& freqs = data.channel_frequencies();
+    double const f_top = std::max_element(freqs.begin(), freqs.end())->value();
+    double const tsamp = data.sample_interval().value();
+    for(std::size_t ch = 0; ch < data.number_of_channels(); ++ch) {
+        double const f = freqs[ch].value();
+        std::size_t const delay = std::round(4.1493775933609e3 * dm * (1.0/(f * f) - 1.0/(f_top * f_top)) / tsamp);
+        auto channel = data.channel(ch);
+        for(std::size_t sample = 0; sample < data.number_of_spectra(); ++sample) {
+            unsigned const expected = (sample >= delay && sample < delay + width) ? 1 : 0;
+            ASSERT_EQ(expected, static_cast<unsigned>(channel[pss::astrotypes::DimensionIndex<pss::astrotypes::units::Time>(sample)]))
+                << "channel " << ch << " sample " << sample;
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(DispersedPulseTest, test_pulse_delays)
+{
+    // default pulse: DM 500, 3 ms wide, delta 1
+    generators::DispersedPulse<TimeFrequencyType> generator;
+    TimeFrequencyType data = make_data(0.001, 1400.0, -10.0);
+    generator.next(data);
+    verify_pulse(data, 500.0, 3);
+}
+
+TEST_F(DispersedPulseTest, test_delays_follow_data_changes)
+{
+    generators::DispersedPulse<TimeFrequencyType> generator;
+    TimeFrequencyType data = make_data(0.001, 1400.0, -10.0);
+    generator.next(data);
+    verify_pulse(data, 500.0, 3);
+
+    // new sample interval
+    TimeFrequencyType data_tsamp = make_data(0.002, 1400.0, -10.0);
+    generator.next(data_tsamp);
+    verify_pulse(data_tsamp, 500.0, 1);
+
+    // new channel frequencies
+    TimeFrequencyType data_freq = make_data(0.002, 1500.0, -20.0);
+    generator.next(data_freq);
+    verify_pulse(data_freq, 500.0, 1);
+
+    // and back again
+    TimeFrequencyType data_again = make_data(0.001, 1400.0, -10.0);
+    generator.next(data_again);
+    verify_pulse(data_again, 500.0, 3);
+}
+
+} // namespace test
+} // namespace generators
+} // namespace cheetah
+} // namespace ska
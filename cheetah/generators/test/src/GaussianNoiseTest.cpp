@@ -25,6 +25,10 @@
 #include "cheetah/generators/GaussianNoise.h"
 #include "cheetah/data/TimeFrequency.h"
 #include "cheetah/data/FrequencyTime.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
 
 
 
@@ -59,6 +63,44 @@ TEST_F(GaussianNoiseTest, test_default_config)
     noise_generator.next(data);
 }
 
+TEST_F(GaussianNoiseTest, test_distribution)
+{
+    generators::GaussianNoiseConfig config;
+    config.mean(10.0);
+    config.std_deviation(2.0);
+    config.seed(42);
+    generators::GaussianNoise<data::TimeFrequency<Cpu, float>> noise_generator(config);
+    data::TimeFrequency<Cpu, float> data(data::DimensionSize<data::Time>(1000), data::DimensionSize<data::Frequency>(101));
+    noise_generator.next(data);
+
+    std::size_t const size = std::distance(data.begin(), data.end());
+    double const mean = std::accumulate(data.begin(), data.end(), 0.0) / size;
+    double const variance = std::accumulate(data.begin(), data.end(), 0.0, [mean](double sum, float v) { return sum + (v - mean) * (v - mean); }) / size;
+    ASSERT_NEAR(10.0, mean, 0.05);
+    ASSERT_NEAR(2.0, std::sqrt(variance), 0.05);
+}
+
+TEST_F(GaussianNoiseTest, test_thread_count_independent)
+{
+    // for a given seed the output must not depend on how the data is shared between threads
+    typedef data::TimeFrequency<Cpu, uint8_t> TimeFrequencyType;
+    generators::GaussianNoiseConfig config;
+    config.seed(1234);
+
+    std::vector<TimeFrequencyType> results;
+    results.reserve(3);
+    for(unsigned number_of_threads : { 1, 3, 8 }) {
+        config.number_of_threads(number_of_threads);
+        generators::GaussianNoise<TimeFrequencyType> noise_generator(config);
+        results.emplace_back(data::DimensionSize<data::Time>(1000), data::DimensionSize<data::Frequency>(101));
+        noise_generator.next(results.back());
+        noise_generator.next(results.back()); // the second chunk must also match
+    }
+    for(std::size_t i=1; i < results.size(); ++i) {
+        ASSERT_TRUE(std::equal(results[0].begin(), results[0].end(), results[i].begin())) << "result " << i;
+    }
+}
+
 } // namespace test
 } // namespace generators
 } // namespace cheetah
@@ -0,0 +1,148 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/generators/test/GeneratorAppTest.h"
+#include "cheetah/generators/GeneratorApp.h"
+#include "cheetah/generators/GeneratorAppConfig.h"
+#include "cheetah/generators/GeneratorFactory.h"
+#include "cheetah/sigproc/SigProcWriter.h"
+#include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/JulianClock.h"
+#include "panda/test/TestDir.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+
+namespace ska {
+namespace cheetah {
+namespace generators {
+namespace test {
+
+
+GeneratorAppTest::GeneratorAppTest()
+    : ::testing::Test()
+{
+}
+
+GeneratorAppTest::~GeneratorAppTest()
+{
+}
+
+void GeneratorAppTest::SetUp()
+{
+}
+
+void GeneratorAppTest::TearDown()
+{
+}
+
+namespace {
+
+typedef data::TimeFrequency<Cpu, uint8_t> TimeFrequencyType;
+
+void configure(GeneratorAppConfig& config)
+{
+    config.number_of_chunks(5);
+    config.number_of_time_samples(256);
+    config.number_of_channels(64);
+    config.start_time(utils::ModifiedJulianClock::time_point(utils::julian_day(58179.5)));
+    config.data_generator({"dispersed_pulse", "RfiScenario3"});
+    config.generator_config().rfi_scenario().seed(42); // reproducible RFI that differs in each chunk
+}
+
+// the contents of the single file written to the directory
+std::vector<char> file_contents(panda::test::TestDir const& dir)
+{
+    std::vector<boost::filesystem::path> files;
+    std::copy(boost::filesystem::directory_iterator(dir.path()), boost::filesystem::directory_iterator(), std::back_inserter(files));
+    EXPECT_EQ(1U, files.size());
+    if(files.empty()) return std::vector<char>();
+    std::ifstream file(files[0].native(), std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// generate and write each chunk in turn on the calling thread, reusing a single block
+std::vector<char> sequential_output(GeneratorAppConfig& config)
+{
+    panda::test::TestDir dir;
+    dir.create();
+    config.sigproc_config().dir(dir.dir_name());
+    {
+        GeneratorFactory<TimeFrequencyType> factory(config.generator_config());
+        std::vector<std::unique_ptr<DataGenerator<TimeFrequencyType>>> models;
+        for(auto const& generator_name : config.data_generator()) {
+            models.emplace_back(std::unique_ptr<DataGenerator<TimeFrequencyType>>(factory.create(generator_name)));
+        }
+        sigproc::SigProcWriter<> writer(config.sigproc_config());
+        TimeFrequencyType data(data::DimensionSize<data::Time>(config.number_of_time_samples()), data::DimensionSize<data::Frequency>(config.number_of_channels()));
+        data.set_channel_frequencies_const_width(config.start_frequency(), config.channel_width());
+        data.sample_interval(config.sample_interval());
+        data.start_time(config.start_time());
+        for(std::size_t chunk = 0; chunk < config.number_of_chunks(); ++chunk) {
+            if(chunk != 0) data.start_time(data.end_time() + data.sample_interval());
+            for(auto& model : models) {
+                model->next(data);
+            }
+            writer << data;
+        }
+    } // the writer flushes on destruction
+    return file_contents(dir);
+}
+
+std::vector<char> app_output(GeneratorAppConfig& config, std::size_t number_of_buffers)
+{
+    panda::test::TestDir dir;
+    dir.create();
+    config.sigproc_config().dir(dir.dir_name());
+    config.number_of_buffers(number_of_buffers);
+    {
+        GeneratorFactory<TimeFrequencyType> factory(config.generator_config());
+        GeneratorApp<TimeFrequencyType> app(config, factory);
+        app.exec();
+    }
+    return file_contents(dir);
+}
+
+} // namespace
+
+TEST_F(GeneratorAppTest, test_output_matches_sequential_generation)
+{
+    GeneratorAppConfig config("test", "GeneratorApp test");
+    configure(config);
+    std::vector<char> const expected = sequential_output(config);
+    ASSERT_FALSE(expected.empty());
+
+    for(std::size_t number_of_buffers : { 1U, 2U }) {
+        std::vector<char> const output = app_output(config, number_of_buffers);
+        ASSERT_EQ(expected.size(), output.size()) << "buffers=" << number_of_buffers;
+        ASSERT_TRUE(expected == output) << "buffers=" << number_of_buffers;
+    }
+}
+
+} // namespace test
+} // namespace generators
+} // namespace cheetah
+} // namespace ska
@@ -80,6 +80,14 @@ TEST_F(PulsarInjectionConfigTest, test_tempo2_phase_model)
     config.phase_model();
 }
 
+TEST_F(PulsarInjectionConfigTest, test_fftw_wisdom_file)
+{
+    PulsarInjectionConfig config;
+    ASSERT_TRUE(config.fftw_wisdom_file().empty());
+    config.fftw_wisdom_file("wisdom.fftw");
+    ASSERT_EQ("wisdom.fftw", config.fftw_wisdom_file());
+}
+
 } // namespace test
 } // namespace generators
 } // namespace cheetah
@@ -25,6 +25,9 @@
 #include "cheetah/generators/PulsarInjection.h"
 #include "cheetah/data/TimeFrequency.h"
 #include "cheetah/data/FrequencyTime.h"
+#include "panda/test/TestDir.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
 
 
 namespace ska {
@@ -95,6 +98,84 @@ TEST_F(PulsarInjectionTest, test_generated_profile)
     injector.next(data);
 }
 
+TEST_F(PulsarInjectionTest, test_repeated_chunks)
+{
+    // the plans and ISM models are cached between calls and must follow changes in the data shape
+    typedef typename data::TimeFrequency<cheetah::Cpu, uint8_t> TimeFrequencyType;
+
+    PulsarInjectionConfig config;
+    SimplePhaseModelConfig phase_model_config;
+    phase_model_config.coefficients({1, 1}); // simple periodix model
+    config.set_phase_model(phase_model_config);
+    generators::PulsarInjection<TimeFrequencyType> injector(config, _manager);
+
+    for(std::size_t number_of_channels : { 64, 64, 128 }) {
+        TimeFrequencyType data(data::DimensionSize<data::Frequency>(number_of_channels), data::DimensionSize<data::Time>(1000));
+        data.set_channel_frequencies_const_width(1592.0 * boost::units::si::mega * boost::units::si::hertz,
+                                                 TimeFrequencyType::FrequencyType(-1.0 * boost::units::si::mega * boost::units::si::hertz));
+        std::fill(data.begin(), data.end(), 0);
+        ASSERT_NO_THROW(injector.next(data));
+    }
+}
+
+TEST_F(PulsarInjectionTest, test_thread_count_independent)
+{
+    // for a given seed the output must not depend on how the channels are shared between threads
+    typedef typename data::TimeFrequency<cheetah::Cpu, uint8_t> TimeFrequencyType;
+
+    PulsarInjectionConfig config;
+    SimplePhaseModelConfig phase_model_config;
+    phase_model_config.coefficients({1, 1000}); // simple periodix model
+    config.set_phase_model(phase_model_config);
+    config.seed(1234);
+
+    std::vector<TimeFrequencyType> results;
+    results.reserve(3);
+    for(unsigned number_of_threads : { 1, 3, 8 }) {
+        config.number_of_threads(number_of_threads);
+        generators::PulsarInjection<TimeFrequencyType> injector(config, _manager);
+        results.emplace_back(data::DimensionSize<data::Frequency>(100), data::DimensionSize<data::Time>(2000));
+        TimeFrequencyType& data = results.back();
+        data.set_channel_frequencies_const_width(1592.0 * boost::units::si::mega * boost::units::si::hertz,
+                                                 TimeFrequencyType::FrequencyType(-1.0 * boost::units::si::mega * boost::units::si::hertz));
+        data.sample_interval(0.001 * boost::units::si::seconds);
+        std::fill(data.begin(), data.end(), 0);
+        injector.next(data);
+    }
+    ASSERT_TRUE(std::any_of(results[0].begin(), results[0].end(), [](uint8_t v) { return v != 0; }));
+    for(std::size_t i=1; i < results.size(); ++i) {
+        ASSERT_TRUE(std::equal(results[0].begin(), results[0].end(), results[i].begin())) << "result " << i;
+    }
+}
+
+TEST_F(PulsarInjectionTest, test_fftw_wisdom)
+{
+    typedef typename data::TimeFrequency<cheetah::Cpu, uint8_t> TimeFrequencyType;
+
+    panda::test::TestDir tmp_dir;
+    ASSERT_NO_THROW(tmp_dir.create());
+    boost::filesystem::path wisdom_file = tmp_dir.path() / "wisdom";
+
+    PulsarInjectionConfig config;
+    SimplePhaseModelConfig phase_model_config;
+    phase_model_config.coefficients({1, 1}); // simple periodix model
+    config.set_phase_model(phase_model_config);
+    config.fftw_wisdom_file(wisdom_file.string());
+
+    TimeFrequencyType data(data::DimensionSize<data::Frequency>(64), data::DimensionSize<data::Time>(100));
+    data.set_channel_frequencies_const_width(1592.0 * boost::units::si::mega * boost::units::si::hertz,
+                                             TimeFrequencyType::FrequencyType(-1.0 * boost::units::si::mega * boost::units::si::hertz));
+    {
+        generators::PulsarInjection<TimeFrequencyType> injector(config, _manager);
+        injector.next(data);
+    }
+    ASSERT_TRUE(boost::filesystem::exists(wisdom_file));
+
+    // a new injector should pick up the saved wisdom
+    generators::PulsarInjection<TimeFrequencyType> injector(config, _manager);
+    ASSERT_NO_THROW(injector.next(data));
+}
+
 } // namespace test
 } // namespace generators
 } // namespace cheetah
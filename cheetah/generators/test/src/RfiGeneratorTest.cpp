@@ -0,0 +1,214 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/generators/test/RfiGeneratorTest.h"
+#include "cheetah/generators/RfiGenerator.h"
+#include "cheetah/data/TimeFrequency.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+
+namespace ska {
+namespace cheetah {
+namespace generators {
+namespace test {
+
+
+RfiGeneratorTest::RfiGeneratorTest()
+    : ::testing::Test()
+{
+}
+
+RfiGeneratorTest::~RfiGeneratorTest()
+{
+}
+
+void RfiGeneratorTest::SetUp()
+{
+}
+
+void RfiGeneratorTest::TearDown()
+{
+}
+
+namespace {
+
+typedef data::TimeFrequency<Cpu, float> TimeFrequencyType;
+typedef data::RfimFlaggedData<TimeFrequencyType> FlaggedDataType;
+
+// exposes the RfiGenerator shape functions without injecting anything of its own
+class TestRfiGenerator : public RfiGenerator<TimeFrequencyType>
+{
+    public:
+        using RfiGenerator<TimeFrequencyType>::next;
+        void next(FlaggedDataType&) override {}
+};
+
+// the number of samples is chosen so the data size is not a multiple of the statistics lanes
+std::shared_ptr<TimeFrequencyType> test_data(std::size_t number_of_samples=257, std::size_t number_of_channels=63)
+{
+    auto data = std::make_shared<TimeFrequencyType>(data::DimensionSize<data::Time>(number_of_samples)
+                                                  , data::DimensionSize<data::Frequency>(number_of_channels));
+    std::mt19937 engine(1234);
+    std::normal_distribution<float> distribution(96.0, 24.0);
+    std::generate(data->begin(), data->end(), [&]() { return distribution(engine); });
+    return data;
+}
+
+// check the flags match the expected region and that the data outside the injected block is untouched
+void check_block(FlaggedDataType const& flagged_data
+               , TimeFrequencyType const& original
+               , std::size_t min_channel, std::size_t max_channel
+               , std::size_t min_sample, std::size_t max_sample
+               , std::function<bool(std::size_t, std::size_t)> const& expect_flagged)
+{
+    TimeFrequencyType const& data = static_cast<TimeFrequencyType const&>(flagged_data);
+    std::size_t const number_of_channels = data.number_of_channels();
+    auto flag_it = flagged_data.rfi_flags().begin();
+    auto data_it = data.begin();
+    auto original_it = original.begin();
+    for(std::size_t sample = 0; sample < data.number_of_spectra(); ++sample) {
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel) {
+            ASSERT_EQ(expect_flagged(sample, channel), static_cast<bool>(*flag_it)) << "sample=" << sample << " channel=" << channel;
+            bool const in_block = sample >= min_sample && sample < max_sample && channel >= min_channel && channel <= max_channel;
+            if(!in_block) {
+                ASSERT_EQ(*original_it, *data_it) << "sample=" << sample << " channel=" << channel;
+            }
+            ++flag_it;
+            ++data_it;
+            ++original_it;
+        }
+    }
+}
+
+} // namespace
+
+TEST_F(RfiGeneratorTest, test_statistics)
+{
+    auto data = test_data();
+
+    // reference two pass calculation
+    double sum = 0.0;
+    for(auto const& value : *data) sum += value;
+    double const size = std::distance(data->begin(), data->end());
+    double const mean = sum / size;
+    double sum_of_squares = 0.0;
+    for(auto const& value : *data) sum_of_squares += (value - mean) * (value - mean);
+    double const standard_deviation = std::sqrt(sum_of_squares / size);
+
+    auto const statistics = TestRfiGenerator::statistics(*data);
+    ASSERT_NEAR(mean, statistics.mean, 1e-3);
+    ASSERT_NEAR(standard_deviation, statistics.standard_deviation, 1e-3);
+}
+
+TEST_F(RfiGeneratorTest, test_statistics_constant_data)
+{
+    TimeFrequencyType data(data::DimensionSize<data::Time>(13), data::DimensionSize<data::Frequency>(7));
+    std::fill(data.begin(), data.end(), 5.0f);
+    auto const statistics = TestRfiGenerator::statistics(data);
+    ASSERT_FLOAT_EQ(5.0f, statistics.mean);
+    ASSERT_FLOAT_EQ(0.0f, statistics.standard_deviation);
+}
+
+TEST_F(RfiGeneratorTest, test_gaussian_block_flags)
+{
+    std::size_t const min_channel = 10;
+    std::size_t const max_channel = 41;
+    std::size_t const min_sample = 100;
+    std::size_t const max_sample = 229;
+
+    auto data = test_data();
+    TimeFrequencyType const original(*data);
+    FlaggedDataType flagged_data(data);
+    TestRfiGenerator generator;
+    generator.rfi_gaussian_block(flagged_data, min_channel, max_channel, min_sample, max_sample, 6.0);
+
+    // flagged within the (floored) half width of the centre in both dimensions
+    long const centre_sample = long((min_sample + max_sample)/2);
+    long const centre_channel = long((min_channel + max_channel)/2);
+    long const sample_width = long(std::floor((max_sample - min_sample)/2.0));
+    long const channel_width = long(std::floor((max_channel - min_channel)/2.0));
+    check_block(flagged_data, original, min_channel, max_channel, min_sample, max_sample
+               , [&](std::size_t sample, std::size_t channel)
+                 {
+                     return sample >= min_sample && sample < max_sample
+                         && channel >= min_channel && channel <= max_channel
+                         && std::abs(long(sample) - centre_sample) <= sample_width
+                         && std::abs(long(channel) - centre_channel) <= channel_width;
+                 });
+}
+
+TEST_F(RfiGeneratorTest, test_ramp_block_flags)
+{
+    std::size_t const min_channel = 16;
+    std::size_t const max_channel = 48;
+    std::size_t const min_sample = 30;
+    std::size_t const max_sample = 77;
+
+    auto data = test_data();
+    TimeFrequencyType const original(*data);
+    FlaggedDataType flagged_data(data);
+    TestRfiGenerator generator;
+    generator.rfi_ramp_block(flagged_data, min_channel, max_channel, min_sample, max_sample);
+
+    // the whole block is flagged
+    check_block(flagged_data, original, min_channel, max_channel, min_sample, max_sample
+               , [&](std::size_t sample, std::size_t channel)
+                 {
+                     return sample >= min_sample && sample < max_sample
+                         && channel >= min_channel && channel <= max_channel;
+                 });
+}
+
+TEST_F(RfiGeneratorTest, test_broadband_block_flags)
+{
+    std::size_t const min_sample = 150;
+    std::size_t const max_sample = 167;
+
+    auto data = test_data();
+    TimeFrequencyType const original(*data);
+    FlaggedDataType flagged_data(data);
+    std::size_t const number_of_channels = flagged_data.number_of_channels();
+    TestRfiGenerator generator;
+    generator.rfi_broadband_block(flagged_data, min_sample, max_sample, 5.0);
+
+    // all channels but the first are flagged within the (floored) half width of the centre
+    long const centre_sample = long((min_sample + max_sample)/2);
+    long const sample_width = long(std::floor((max_sample - min_sample)/2.0));
+    check_block(flagged_data, original, 1, number_of_channels - 1, min_sample, max_sample
+               , [&](std::size_t sample, std::size_t channel)
+                 {
+                     return sample >= min_sample && sample < max_sample
+                         && channel >= 1 && channel <= number_of_channels - 1
+                         && std::abs(long(sample) - centre_sample) <= sample_width;
+                 });
+}
+
+} // namespace test
+} // namespace generators
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,107 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/generators/test/RfiScenarioTest.h"
+#include "cheetah/generators/RfiScenario.h"
+#include "cheetah/data/TimeFrequency.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+
+namespace ska {
+namespace cheetah {
+namespace generators {
+namespace test {
+
+
+RfiScenarioTest::RfiScenarioTest()
+    : ::testing::Test()
+{
+}
+
+RfiScenarioTest::~RfiScenarioTest()
+{
+}
+
+void RfiScenarioTest::SetUp()
+{
+}
+
+void RfiScenarioTest::TearDown()
+{
+}
+
+namespace {
+
+typedef data::TimeFrequency<Cpu, uint8_t> TimeFrequencyType;
+
+std::shared_ptr<TimeFrequencyType> test_data()
+{
+    auto data = std::make_shared<TimeFrequencyType>(data::DimensionSize<data::Time>(1024), data::DimensionSize<data::Frequency>(128));
+    unsigned n = 0;
+    std::generate(data->begin(), data->end(), [&n]() { return static_cast<uint8_t>(n++ % 17); });
+    return data;
+}
+
+} // namespace
+
+TEST_F(RfiScenarioTest, test_seed_reproducible)
+{
+    // scenarios constructed with the same seed must inject identical RFI
+    RfiScenarioConfig config;
+    config.seed(42);
+
+    std::vector<std::shared_ptr<TimeFrequencyType>> results;
+    for(unsigned i=0; i < 2; ++i) {
+        RfiScenario<4, TimeFrequencyType> scenario(config);
+        ASSERT_EQ(42U, scenario.seed());
+        results.push_back(test_data());
+        data::RfimFlaggedData<TimeFrequencyType> flagged_data(results.back());
+        scenario.next(flagged_data);
+        scenario.next(flagged_data); // the engine state carries over between calls
+    }
+    ASSERT_TRUE(std::equal(results[0]->begin(), results[0]->end(), results[1]->begin()));
+}
+
+TEST_F(RfiScenarioTest, test_replay_random_seed)
+{
+    // a seed of 0 chooses a random seed, which can be used to replay the same RFI
+    RfiScenarioConfig config;
+    RfiScenario<3, TimeFrequencyType> scenario(config);
+    config.seed(scenario.seed());
+    RfiScenario<3, TimeFrequencyType> replay_scenario(config);
+
+    auto data = test_data();
+    auto replay_data = test_data();
+    data::RfimFlaggedData<TimeFrequencyType> flagged_data(data);
+    data::RfimFlaggedData<TimeFrequencyType> replay_flagged_data(replay_data);
+    scenario.next(flagged_data);
+    replay_scenario.next(replay_flagged_data);
+    ASSERT_TRUE(std::equal(data->begin(), data->end(), replay_data->begin()));
+}
+
+} // namespace test
+} // namespace generators
+} // namespace cheetah
+} // namespace ska
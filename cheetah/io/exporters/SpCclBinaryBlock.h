@@ -0,0 +1,135 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYBLOCK_H
+#define SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYBLOCK_H
+
+#include <ctime>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+
+/**
+ * @brief
+ *    A block of single pulse candidates stored column by column, and its on disk format
+ *
+ * @details
+ *    A file consists of a header (the 8 byte magic "SPCCLBIN" followed by a uint32 format version)
+ *    and a sequence of blocks, one per data::SpCcl exported. Each block is
+ *    @verbatim
+        uint64  number of candidates (n)
+        float64 x n  start time (MJD, decimal days)
+        float32 x n  dm (pc/cm^3)
+        float64 x n  width (ms)
+        float32 x n  sigma
+      @endverbatim
+ *    All values are little endian.
+ */
+
+class SpCclBinaryBlock
+{
+    public:
+        static constexpr std::uint32_t format_version = 1;
+
+    public:
+        SpCclBinaryBlock();
+        ~SpCclBinaryBlock();
+
+        /**
+         * @brief the number of candidates in the block
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief remove all candidates (retaining the allocated memory)
+         */
+        void clear();
+
+        /**
+         * @brief reserve space for at least n candidates
+         */
+        void reserve(std::size_t n);
+
+        /**
+         * @brief append a candidate
+         */
+        void push_back(double mjd, float dm, double width, float sigma);
+
+        /**
+         * @brief the columns
+         */
+        std::vector<double> const& mjd() const;
+        std::vector<float> const& dm() const;
+        std::vector<double> const& width() const;
+        std::vector<float> const& sigma() const;
+
+        /**
+         * @brief the wall clock start time of the data the candidates were found in (used for naming files)
+         */
+        std::time_t start_time() const;
+        void start_time(std::time_t);
+
+        /**
+         * @brief write the block to the stream in the binary format
+         */
+        void write(std::ostream&) const;
+
+        /**
+         * @brief replace the contents with the next block in the stream
+         * @return false if the end of the stream has been reached
+         * @throw panda::Error if the stream ends part way through a block
+         */
+        bool read(std::istream&);
+
+        /**
+         * @brief write the file header
+         */
+        static void write_file_header(std::ostream&);
+
+        /**
+         * @brief consume and check the file header
+         * @throw panda::Error if the stream is not a supported SpCcl binary file
+         */
+        static void read_file_header(std::istream&);
+
+    private:
+        std::vector<double> _mjd;
+        std::vector<float> _dm;
+        std::vector<double> _width;
+        std::vector<float> _sigma;
+        std::time_t _start_time;
+};
+
+
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYBLOCK_H
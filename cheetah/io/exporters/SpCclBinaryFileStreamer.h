@@ -0,0 +1,113 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMER_H
+#define SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMER_H
+
+#include "SpCclBinaryFileStreamerConfig.h"
+#include "SpCclBinaryBlock.h"
+#include "detail/SpCclBinaryFileStreamerTraits.h"
+#include "cheetah/data/SpCcl.h"
+#include "panda/OutputFileStreamer.h"
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+
+/**
+ * @brief
+ *    Write Sps candidates to a file in a binary columnar format (see SpCclBinaryBlock)
+ *
+ * @details
+ *    The caller only copies the candidate fields into a (recycled) SpCclBinaryBlock and queues it.
+ *    A dedicated writer thread takes care of the file I/O. If more than queue_length lists are
+ *    waiting the caller is blocked until the writer catches up, so no candidates are ever dropped.
+ *
+ *    Use the cheetah_spccl_binary_to_text tool to convert the files to the SpCclFileStreamer text format.
+ */
+
+template<typename NumericalRep>
+class SpCclBinaryFileStreamer
+{
+    public:
+        SpCclBinaryFileStreamer(SpCclBinaryFileStreamerConfig const&);
+        SpCclBinaryFileStreamer(SpCclBinaryFileStreamer const&) = delete;
+
+        /**
+         * @brief writes out any queued candidates before returning
+         */
+        ~SpCclBinaryFileStreamer();
+
+        /**
+         * @brief queue the candidates for writing
+         */
+        SpCclBinaryFileStreamer& operator<<(data::SpCcl<NumericalRep> const&);
+
+        /**
+         * @brief block until all the candidates queued so far have been written
+         */
+        void flush();
+
+    private:
+        class FileStreamer : public panda::OutputFileStreamer<SpCclBinaryBlock, SpCclBinaryFileStreamerTraits>
+        {
+                typedef panda::OutputFileStreamer<SpCclBinaryBlock, SpCclBinaryFileStreamerTraits> BaseT;
+
+            public:
+                FileStreamer(SpCclBinaryFileStreamerConfig const&);
+
+            protected:
+                boost::filesystem::path next_filename(SpCclBinaryBlock const&) override;
+        };
+
+        void run();
+
+    private:
+        FileStreamer _file_streamer;
+        std::size_t const _queue_length;
+        std::deque<std::unique_ptr<SpCclBinaryBlock>> _queue;
+        std::vector<std::unique_ptr<SpCclBinaryBlock>> _free_blocks;
+        bool _writing;
+        bool _stop;
+        bool _stall_reported;
+        std::mutex _mutex;
+        std::condition_variable _data_available;
+        std::condition_variable _space_available;
+        std::thread _thread;
+};
+
+
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
+#include "detail/SpCclBinaryFileStreamer.cpp"
+
+#endif // SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMER_H
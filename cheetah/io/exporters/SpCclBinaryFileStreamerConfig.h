@@ -0,0 +1,70 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMERCONFIG_H
+#define SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMERCONFIG_H
+
+
+#include "cheetah/io/exporters/FileStreamerConfig.h"
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+
+/**
+ * @brief
+ *    User Configuration of the SpCclBinaryFileStreamer
+ * @details
+ */
+
+class SpCclBinaryFileStreamerConfig : public FileStreamerConfig
+{
+    public:
+        SpCclBinaryFileStreamerConfig();
+        ~SpCclBinaryFileStreamerConfig();
+
+        /**
+         * @brief the maximum number of candidate lists waiting to be written before the caller is blocked
+         */
+        std::size_t queue_length() const;
+
+        /**
+         * @brief set the maximum number of candidate lists waiting to be written
+         */
+        void queue_length(std::size_t);
+
+    protected:
+        void add_options(OptionsDescriptionEasyInit& add_options) override;
+
+    private:
+        std::size_t _queue_length;
+};
+
+
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_IO_EXPORTERS_SPCCLBINARYFILESTREAMERCONFIG_H
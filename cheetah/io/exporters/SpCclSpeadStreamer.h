@@ -35,6 +35,11 @@
 #include <spead2/common_flavour.h>
 #include <spead2/send_heap.h>
 #include <spead2/send_udp.h>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace ska {
 namespace cheetah {
@@ -42,8 +47,13 @@ namespace io {
 namespace exporters {
 
 /**
- * @brief
- * @details
+ * @brief Publish SpCcl candidate lists as spead2 heaps over UDP
+ * @details The candidates are sent directly from the candidate list storage as a single
+ *          contiguous block item per heap, without copying. Candidate lists larger than
+ *          the configured max_heap_size are split over several heaps.
+ *          Heaps are sent asynchronously. Each heap keeps its candidate list alive until it has
+ *          been sent, so operator<< only waits if the stream queue is full. The destructor
+ *          blocks until every queued heap has been sent.
  */
 
 class SpCclSpeadStreamer : public SpCclSpeadStreamTraits
@@ -55,26 +65,56 @@ class SpCclSpeadStreamer : public SpCclSpeadStreamTraits
         SpCclSpeadStreamer(SpCclSpeadStreamer const&) = delete;
         ~SpCclSpeadStreamer();
 
+        /**
+         * @brief send the candidate list
+         * @details if the list is owned by a std::shared_ptr (as lists passed through the pipeline are)
+         *          ownership is shared until it has been sent, and the list must not be modified
+         *          in the meantime. Otherwise a copy is sent and the caller may reuse its list as
+         *          soon as the call returns.
+         */
         template<typename NumericalRep>
         SpCclSpeadStreamer& operator<<(data::SpCcl<NumericalRep> const&);
 
+        /**
+         * @brief send the candidate list, sharing ownership until it has been sent
+         */
+        template<typename NumericalRep>
+        SpCclSpeadStreamer& operator<<(std::shared_ptr<data::SpCcl<NumericalRep>> const&);
+
+    private:
+        /**
+         * @brief split the candidate list into heaps and queue them for sending
+         */
+        template<typename NumericalRep>
+        void send(std::shared_ptr<data::SpCcl<NumericalRep> const> const& cand_list);
+
+        /**
+         * @brief queue a heap, waiting for space in the stream queue if it is full
+         * @param keep_alive released once the heap has been sent
+         */
+        void send(spead2::send::heap const& heap, std::shared_ptr<void const> keep_alive);
+
+        /**
+         * @brief block until all queued heaps have been sent
+         */
+        void flush();
+
     private:
         SpCclSpeadStreamerConfig const& _config;
+        std::size_t                     _max_heaps;
+        std::size_t                     _max_heap_size;
         spead2::flavour                 _sp_flavour;
         spead2::send::heap              _sp_end;
         spead2::send::udp_stream        _sp_stream;
-        spead2::descriptor              _tf_data_desc;
-        spead2::descriptor              _ft_data_desc;
-        spead2::descriptor              _data_start_time_desc;
-        spead2::descriptor              _data_number_of_channels_desc;
-        spead2::descriptor              _data_sammple_interval;
-        spead2::descriptor              _data_channel_1;
-        spead2::descriptor              _data_channel_width;
-        spead2::descriptor              _candidate_start_time_desc;
-        spead2::descriptor              _candidate_dm_desc;
-        spead2::descriptor              _candidate_width_desc;
-        spead2::descriptor              _candidate_sigma_desc;
-        spead2::descriptor              _candidate_duration_desc;
+        std::size_t                     _candidate_stride;
+        std::array<std::uint64_t, 5>    _candidate_layout;
+        spead2::descriptor              _candidate_block_desc;
+        spead2::descriptor              _candidate_block_start_time_desc;
+        spead2::descriptor              _candidate_block_stride_desc;
+        spead2::descriptor              _candidate_block_layout_desc;
+        std::mutex                      _send_mutex;
+        std::condition_variable         _send_cv;
+        std::size_t                     _heaps_in_flight;
 };
 
 } // namespace exporters
@@ -70,6 +70,13 @@ class SpCclSpeadStreamerConfig : public utils::Config
          */
         float send_rate_limit() const;
 
+        /**
+         * @brief the maximum number of candidates to publish in a single spead heap
+         * @details larger candidate lists are split over several heaps
+         */
+        std::size_t max_heap_size() const;
+        void max_heap_size(std::size_t number_of_candidates);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
@@ -78,6 +85,7 @@ class SpCclSpeadStreamerConfig : public utils::Config
         data::CandidateWindowConfig _window_config;
         unsigned _packet_size;
         float _send_rate;
+        std::size_t _max_heap_size;
 };
 
 
@@ -0,0 +1,150 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/io/exporters/SpCclBinaryFileStreamer.h"
+#include "panda/Log.h"
+#include <chrono>
+#include <ctime>
+
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+
+
+template<typename NumericalRep>
+SpCclBinaryFileStreamer<NumericalRep>::FileStreamer::FileStreamer(SpCclBinaryFileStreamerConfig const& config)
+    : BaseT(config.dir())
+{
+    this->extension(config.extension());
+}
+
+template<typename NumericalRep>
+boost::filesystem::path SpCclBinaryFileStreamer<NumericalRep>::FileStreamer::next_filename(SpCclBinaryBlock const& block)
+{
+    std::time_t ttp = block.start_time();
+    char stem[20];
+    std::strftime(stem, sizeof(stem), "%Y_%m_%d_%H:%M:%S", std::gmtime(&ttp));
+    return boost::filesystem::path(this->_prefix + stem + this->_extension);
+}
+
+template<typename NumericalRep>
+SpCclBinaryFileStreamer<NumericalRep>::SpCclBinaryFileStreamer(SpCclBinaryFileStreamerConfig const& config)
+    : _file_streamer(config)
+    , _queue_length(std::max<std::size_t>(config.queue_length(), 1))
+    , _writing(false)
+    , _stop(false)
+    , _stall_reported(false)
+    , _thread([this]() { run(); })
+{
+}
+
+template<typename NumericalRep>
+SpCclBinaryFileStreamer<NumericalRep>::~SpCclBinaryFileStreamer()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _data_available.notify_one();
+    _thread.join();
+}
+
+template<typename NumericalRep>
+SpCclBinaryFileStreamer<NumericalRep>& SpCclBinaryFileStreamer<NumericalRep>::operator<<(data::SpCcl<NumericalRep> const& candidate_list)
+{
+    if(candidate_list.empty()) return *this;
+
+    std::unique_ptr<SpCclBinaryBlock> block;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if(_queue.size() >= _queue_length && !_stall_reported) {
+            PANDA_LOG_WARN << "SpCclBinaryFileStreamer: writer is falling behind (" << _queue.size() << " candidate lists queued)";
+            _stall_reported = true;
+        }
+        _space_available.wait(lock, [this]() { return _queue.size() < _queue_length; });
+        if(!_free_blocks.empty()) {
+            block = std::move(_free_blocks.back());
+            _free_blocks.pop_back();
+        }
+    }
+    if(!block) block.reset(new SpCclBinaryBlock());
+
+    block->start_time(std::chrono::system_clock::to_time_t(candidate_list.start_time()));
+    block->reserve(candidate_list.size());
+    for(auto it = candidate_list.begin(); it != candidate_list.end(); ++it)
+    {
+        auto const& candidate = *it;
+        auto dmjd = candidate_list.start_time(candidate).time_since_epoch();
+        block->push_back(dmjd.count(), candidate.dm().value(), candidate.width().value(), candidate.sigma());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(std::move(block));
+    }
+    _data_available.notify_one();
+    return *this;
+}
+
+template<typename NumericalRep>
+void SpCclBinaryFileStreamer<NumericalRep>::flush()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _space_available.wait(lock, [this]() { return _queue.empty() && !_writing; });
+}
+
+template<typename NumericalRep>
+void SpCclBinaryFileStreamer<NumericalRep>::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while(true)
+    {
+        _data_available.wait(lock, [this]() { return _stop || !_queue.empty(); });
+        if(_queue.empty()) break; // only once stopped and drained
+
+        std::unique_ptr<SpCclBinaryBlock> block = std::move(_queue.front());
+        _queue.pop_front();
+        _writing = true;
+        lock.unlock();
+
+        try {
+            _file_streamer << *block;
+        }
+        catch(std::exception const& e) {
+            PANDA_LOG_ERROR << "SpCclBinaryFileStreamer: failed to write " << block->size() << " candidates: " << e.what();
+        }
+        block->clear();
+
+        lock.lock();
+        _free_blocks.push_back(std::move(block));
+        _writing = false;
+        _space_available.notify_all();
+    }
+}
+
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
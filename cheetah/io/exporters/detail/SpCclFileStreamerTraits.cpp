@@ -50,14 +50,20 @@ void SpCclFileStreamerTraits<NumericalRep>::write(std::ostream& os, data::SpCcl<
         auto start_mjd = candidate_list.start_time(candidate);
         auto dmjd = start_mjd.time_since_epoch();
 
-        os << std::left << std::setw(_column_width) << std::setprecision(15) << dmjd.count()
-           << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << candidate.dm().value()
-           << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << candidate.width().value()
-           << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << candidate.sigma() << "\n";
+        write_row(os, dmjd.count(), candidate.dm().value(), candidate.width().value(), candidate.sigma());
     }
     os.flush();
 }
 
+template<typename NumericalRep>
+void SpCclFileStreamerTraits<NumericalRep>::write_row(std::ostream& os, double mjd, float dm, double width, float sigma)
+{
+    os << std::left << std::setw(_column_width) << std::setprecision(15) << mjd
+       << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << dm
+       << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << width
+       << std::left << std::setw(_column_width) << "\t" << std::setprecision(6) << sigma << "\n";
+}
+
 } // namespace exporters
 } // namespace io
 } // namespace cheetah
@@ -57,6 +57,13 @@ class SpCclFileStreamerTraits
         static
         void write(std::ostream& os, data::SpCcl<NumericalRep> const&);
 
+        /**
+         * @brief write a single candidate line
+         * @param mjd the candidate start time (decimal days)
+         */
+        static
+        void write_row(std::ostream& os, double mjd, float dm, double width, float sigma);
+
     protected:
         static constexpr unsigned _column_width=14;
 };
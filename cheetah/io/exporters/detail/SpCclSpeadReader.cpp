@@ -24,6 +24,8 @@
 
 #include "SpeadLoggingAdapter.h"
 #include <panda/Log.h>
+#include <cstdint>
+#include <cstring>
 
 namespace ska {
 namespace cheetah {
@@ -220,6 +222,12 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
     std::vector<SigmaType> candidate_sigma;
     std::vector<DurationType> candidate_duration;
 
+    // candidates sent as raw blocks of SpCandidate objects
+    time_point candidate_block_start_time;
+    std::size_t candidate_stride = 0;
+    std::uint64_t const* candidate_layout = nullptr;
+    std::vector<spead2::recv::item const*> candidate_blocks;
+
     for (auto const& item : items)
     {
         switch(item.id)
@@ -269,6 +277,18 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
             case candidate_duration_id:
                 candidate_duration.emplace_back(*reinterpret_cast<typename DurationType::value_type*>(item.ptr) * boost::units::si::milli * boost::units::si::second);
                 break;
+            case candidate_block_id:
+                candidate_blocks.push_back(&item);
+                break;
+            case candidate_block_start_time_id:
+                candidate_block_start_time = time_point(julian_day(*reinterpret_cast<double*>(item.ptr)));
+                break;
+            case candidate_block_stride_id:
+                candidate_stride = *reinterpret_cast<std::size_t*>(item.ptr);
+                break;
+            case candidate_block_layout_id:
+                if(item.length == 5 * sizeof(std::uint64_t)) candidate_layout = reinterpret_cast<std::uint64_t const*>(item.ptr);
+                break;
 
             default:
                 PANDA_LOG_WARN << "unknown id in spead packet detectedi: " << item.id;
@@ -276,30 +296,34 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
     }
 
     // load in tf data
-    if(tf_items.size() != tf_start_time.size()) {
-        PANDA_LOG_ERROR << "TimeFrequency data corrupted" << tf_items.size() << " vs " << tf_start_time.size();
-    }
+    std::shared_ptr<TimeFrequencyType> tf_block;
+    if(!tf_items.empty()) {
+        if(tf_items.size() != tf_start_time.size()) {
+            PANDA_LOG_ERROR << "TimeFrequency data corrupted" << tf_items.size() << " vs " << tf_start_time.size();
+            return;
+        }
 
-    data::DimensionSize<data::Time> number_of_spectra(0);
-    const std::size_t sample_size=sizeof(NumericalRep);
-    for( std::size_t i=0; i < tf_items.size(); ++i) {
-        auto const& item = *tf_items[i];
-        number_of_spectra += data::DimensionSize<data::Time>(item.length/sample_size/(std::size_t)number_of_channels);
-    }
-    std::shared_ptr<TimeFrequencyType> tf_block = std::make_shared<TimeFrequencyType>(number_of_spectra, number_of_channels);
-    TimeFrequencyType& dat = *tf_block;
-    dat.start_time(tf_start_time[0]);
-    dat.sample_interval(tsamp);
-    dat.set_channel_frequencies_const_width(fch1, foff);
-    auto dat_it=dat.begin();
-
-    // copy data into tf_block
-    for( std::size_t i=0; i < tf_items.size(); ++i) {
-        auto const& item = *tf_items[i];
-        NumericalRep* start=reinterpret_cast<NumericalRep*>(item.ptr);
-        std::size_t length = item.length/sizeof(NumericalRep);
-        std::copy(start, start + length, dat_it);
-        dat_it += length;
+        data::DimensionSize<data::Time> number_of_spectra(0);
+        const std::size_t sample_size=sizeof(NumericalRep);
+        for( std::size_t i=0; i < tf_items.size(); ++i) {
+            auto const& item = *tf_items[i];
+            number_of_spectra += data::DimensionSize<data::Time>(item.length/sample_size/(std::size_t)number_of_channels);
+        }
+        tf_block = std::make_shared<TimeFrequencyType>(number_of_spectra, number_of_channels);
+        TimeFrequencyType& dat = *tf_block;
+        dat.start_time(tf_start_time[0]);
+        dat.sample_interval(tsamp);
+        dat.set_channel_frequencies_const_width(fch1, foff);
+        auto dat_it=dat.begin();
+
+        // copy data into tf_block
+        for( std::size_t i=0; i < tf_items.size(); ++i) {
+            auto const& item = *tf_items[i];
+            NumericalRep* start=reinterpret_cast<NumericalRep*>(item.ptr);
+            std::size_t length = item.length/sizeof(NumericalRep);
+            std::copy(start, start + length, dat_it);
+            dat_it += length;
+        }
     }
 
     // load in ft data
@@ -321,7 +345,7 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
     }
 
     // load in candidates
-    data::SpCandidateData<TimeFrequencyType> dt(tf_block);
+    SpCclType dt = tf_block ? SpCclType(tf_block) : SpCclType();
     std::size_t total_candidates=candidate_dm.size();
 
     // sanity check
@@ -334,9 +358,9 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
         return;
     }
 
+    typedef typename SpCclType::CandidateType SpCandidateType;
     for(std::size_t i=0; i< total_candidates; ++i)
     {
-        typedef typename std::remove_reference<decltype(data)>::type::CandidateType SpCandidateType;
         dt.add(SpCandidateType(candidate_dm[i]
                                  , candidate_start_time[i]
                                  , candidate_width[i]
@@ -345,6 +369,49 @@ void SpCclSpeadReader<TimeFrequencyT, Callback, DataFactory>::fill(SpCclType& da
                                  ));
     }
 
+    // unpack the candidate blocks using the layout provided by the sender
+    if(!candidate_blocks.empty()) {
+        if(candidate_stride == 0 || candidate_layout == nullptr) {
+            PANDA_LOG_ERROR << "candidate block received without a layout description";
+            return;
+        }
+        std::size_t const field_size[5] = { sizeof(float), sizeof(double), sizeof(double), sizeof(double), sizeof(float) };
+        for(std::size_t i=0; i < 5; ++i) {
+            if(candidate_layout[i] + field_size[i] > candidate_stride) {
+                PANDA_LOG_ERROR << "candidate block layout is inconsistent with the candidate size";
+                return;
+            }
+        }
+    }
+    for(auto const* item : candidate_blocks)
+    {
+        if(item->length % candidate_stride != 0) {
+            PANDA_LOG_ERROR << "candidate block corrupted (size " << item->length << " is not a multiple of " << candidate_stride << ")";
+            return;
+        }
+        std::uint8_t const* cand_ptr = item->ptr;
+        std::uint8_t const* const cand_end = item->ptr + item->length;
+        for(; cand_ptr != cand_end; cand_ptr += candidate_stride)
+        {
+            float dm;
+            double tstart;
+            double width;
+            double tend;
+            float sigma;
+            std::memcpy(&dm, cand_ptr + candidate_layout[0], sizeof(dm));
+            std::memcpy(&tstart, cand_ptr + candidate_layout[1], sizeof(tstart));
+            std::memcpy(&width, cand_ptr + candidate_layout[2], sizeof(width));
+            std::memcpy(&tend, cand_ptr + candidate_layout[3], sizeof(tend));
+            std::memcpy(&sigma, cand_ptr + candidate_layout[4], sizeof(sigma));
+            dt.add(SpCandidateType(Dm(dm * data::parsecs_per_cube_cm)
+                                 , candidate_block_start_time + pss::astrotypes::units::duration_cast<julian_day>(DurationType(tstart * data::milliseconds))
+                                 , Width(width * data::milliseconds)
+                                 , DurationType(tend * data::milliseconds)
+                                 , SigmaType(sigma)
+                                 ));
+        }
+    }
+
     // transfer the data to the passed object
     data = std::move(dt);
 }
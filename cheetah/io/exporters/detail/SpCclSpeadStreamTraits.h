@@ -58,6 +58,12 @@ class SpCclSpeadStreamTraits : private SpeadLoggingAdapter
         static constexpr int candidate_sigma_id                     = 0x1023;
         static constexpr int candidate_duration_id                  = 0x1024;
 
+        // candidates sent as a single block of SpCandidate objects
+        static constexpr int candidate_block_id                     = 0x1025; // the raw candidate storage
+        static constexpr int candidate_block_start_time_id          = 0x1026; // MJD the candidate tstart values are relative to
+        static constexpr int candidate_block_stride_id              = 0x1027; // size in bytes of each candidate in the block
+        static constexpr int candidate_block_layout_id              = 0x1028; // byte offsets of dm, tstart, width, tend, sigma within a candidate
+
 };
 
 
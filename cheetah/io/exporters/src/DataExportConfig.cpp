@@ -26,6 +26,7 @@
 #include "cheetah/io/exporters/SclFileStreamerConfig.h"
 #include "cheetah/io/exporters/SclCandidateDataStreamerConfig.h"
 #include "cheetah/io/exporters/SpCclFileStreamerConfig.h"
+#include "cheetah/io/exporters/SpCclBinaryFileStreamerConfig.h"
 #include "cheetah/io/exporters/SpCandidateDataStreamerConfig.h"
 #ifdef ENABLE_SPEAD
 #include "cheetah/io/exporters/SpCclSpeadStreamerConfig.h"
@@ -58,6 +59,7 @@ DataExportConfig::DataExportConfig( std::string const& tag)
     add(_sink_configs);
     _sink_configs.add_factory("sigproc", []() { return new sigproc::WriterConfig(); });
     _sink_configs.add_factory("spccl_files", []() { return new SpCclFileStreamerConfig(); });
+    _sink_configs.add_factory("spccl_binary_files", []() { return new SpCclBinaryFileStreamerConfig(); });
     _sink_configs.add_factory("sp_candidate_data", []() { return new SpCandidateDataStreamerConfig(); });
     _sink_configs.add_factory("ocld_files", []() { return new OcldFileStreamerConfig(); });
     _sink_configs.add_factory("scl_files", []() { return new SclFileStreamerConfig(); });
@@ -0,0 +1,208 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/io/exporters/SpCclBinaryBlock.h"
+#include "panda/Error.h"
+#include <boost/endian/conversion.hpp>
+#include <cstring>
+
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+
+namespace {
+
+char const magic[8] = { 'S', 'P', 'C', 'C', 'L', 'B', 'I', 'N' };
+
+template<typename T>
+void write_value(std::ostream& os, T value)
+{
+    boost::endian::native_to_little_inplace(value);
+    os.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read_value(std::istream& is, T& value)
+{
+    if(!is.read(reinterpret_cast<char*>(&value), sizeof(T))) return false;
+    boost::endian::little_to_native_inplace(value);
+    return true;
+}
+
+// floating point columns are copied through the same width unsigned type for the byte swapping
+template<typename T, typename BitsT>
+void write_column(std::ostream& os, std::vector<T> const& column)
+{
+    static_assert(sizeof(T) == sizeof(BitsT), "column type mismatch");
+    if(boost::endian::order::native == boost::endian::order::little) {
+        os.write(reinterpret_cast<char const*>(column.data()), column.size() * sizeof(T));
+        return;
+    }
+    for(T const& value : column) {
+        BitsT bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        write_value(os, bits);
+    }
+}
+
+template<typename T, typename BitsT>
+bool read_column(std::istream& is, std::vector<T>& column, std::size_t size)
+{
+    static_assert(sizeof(T) == sizeof(BitsT), "column type mismatch");
+    column.resize(size);
+    if(!is.read(reinterpret_cast<char*>(column.data()), size * sizeof(T))) return false;
+    if(boost::endian::order::native != boost::endian::order::little) {
+        for(T& value : column) {
+            BitsT bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            boost::endian::little_to_native_inplace(bits);
+            std::memcpy(&value, &bits, sizeof(T));
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+constexpr std::uint32_t SpCclBinaryBlock::format_version;
+
+SpCclBinaryBlock::SpCclBinaryBlock()
+    : _start_time(0)
+{
+}
+
+SpCclBinaryBlock::~SpCclBinaryBlock()
+{
+}
+
+std::size_t SpCclBinaryBlock::size() const
+{
+    return _mjd.size();
+}
+
+void SpCclBinaryBlock::clear()
+{
+    _mjd.clear();
+    _dm.clear();
+    _width.clear();
+    _sigma.clear();
+    _start_time = 0;
+}
+
+void SpCclBinaryBlock::reserve(std::size_t n)
+{
+    _mjd.reserve(n);
+    _dm.reserve(n);
+    _width.reserve(n);
+    _sigma.reserve(n);
+}
+
+void SpCclBinaryBlock::push_back(double mjd, float dm, double width, float sigma)
+{
+    _mjd.push_back(mjd);
+    _dm.push_back(dm);
+    _width.push_back(width);
+    _sigma.push_back(sigma);
+}
+
+std::vector<double> const& SpCclBinaryBlock::mjd() const
+{
+    return _mjd;
+}
+
+std::vector<float> const& SpCclBinaryBlock::dm() const
+{
+    return _dm;
+}
+
+std::vector<double> const& SpCclBinaryBlock::width() const
+{
+    return _width;
+}
+
+std::vector<float> const& SpCclBinaryBlock::sigma() const
+{
+    return _sigma;
+}
+
+std::time_t SpCclBinaryBlock::start_time() const
+{
+    return _start_time;
+}
+
+void SpCclBinaryBlock::start_time(std::time_t t)
+{
+    _start_time = t;
+}
+
+void SpCclBinaryBlock::write(std::ostream& os) const
+{
+    write_value(os, static_cast<std::uint64_t>(size()));
+    write_column<double, std::uint64_t>(os, _mjd);
+    write_column<float, std::uint32_t>(os, _dm);
+    write_column<double, std::uint64_t>(os, _width);
+    write_column<float, std::uint32_t>(os, _sigma);
+}
+
+bool SpCclBinaryBlock::read(std::istream& is)
+{
+    std::uint64_t size;
+    if(!read_value(is, size)) return false;
+    if(!(read_column<double, std::uint64_t>(is, _mjd, size)
+         && read_column<float, std::uint32_t>(is, _dm, size)
+         && read_column<double, std::uint64_t>(is, _width, size)
+         && read_column<float, std::uint32_t>(is, _sigma, size)))
+    {
+        panda::Error e("SpCclBinaryBlock: truncated block of ");
+        e << size << " candidates";
+        throw e;
+    }
+    return true;
+}
+
+void SpCclBinaryBlock::write_file_header(std::ostream& os)
+{
+    os.write(magic, sizeof(magic));
+    write_value(os, format_version);
+}
+
+void SpCclBinaryBlock::read_file_header(std::istream& is)
+{
+    char buffer[sizeof(magic)];
+    std::uint32_t version;
+    if(!is.read(buffer, sizeof(buffer)) || std::memcmp(buffer, magic, sizeof(magic)) != 0 || !read_value(is, version)) {
+        throw panda::Error("SpCclBinaryBlock: not an SpCcl binary file");
+    }
+    if(version != format_version) {
+        panda::Error e("SpCclBinaryBlock: unsupported format version ");
+        e << version;
+        throw e;
+    }
+}
+
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
@@ -22,22 +22,36 @@
  * SOFTWARE.
  */
 #include "cheetah/io/exporters/SpCclSpeadStreamer.h"
+#include <algorithm>
 
 namespace ska {
 namespace cheetah {
 namespace io {
 namespace exporters {
 
+namespace {
+
+template<typename MemberT>
+std::uint64_t member_offset(void const* object, MemberT const& member)
+{
+    return reinterpret_cast<char const*>(&member) - reinterpret_cast<char const*>(object);
+}
+
+} // namespace
+
 SpCclSpeadStreamer::SpCclSpeadStreamer(SpCclSpeadStreamerConfig const& config, panda::Engine& engine)
     : _config(config)
+    , _max_heaps(spead2::send::stream_config::default_max_heaps * 8)
+    , _max_heap_size(std::max<std::size_t>(1, config.max_heap_size()))
     , _sp_flavour(spead2::maximum_version, 64, 48, spead2::BUG_COMPAT_PYSPEAD_0_5_2)
     , _sp_end(_sp_flavour)
     , _sp_stream(engine, config.send_address().end_point<boost::asio::ip::udp::endpoint>()
                 , spead2::send::stream_config().set_max_packet_size(config.packet_size())
                                                .set_rate(config.send_rate_limit())
                                                .set_burst_size(spead2::send::stream_config::default_burst_size)
-                                               .set_max_heaps(spead2::send::stream_config::default_max_heaps * 8)
+                                               .set_max_heaps(_max_heaps)
                 )
+    , _heaps_in_flight(0)
 {
     std::string limit_msg;
     if(config.send_rate_limit()!=0.0) {
@@ -47,71 +61,67 @@ SpCclSpeadStreamer::SpCclSpeadStreamer(SpCclSpeadStreamerConfig const& config, p
               << ":" << config.send_address().port()
               << limit_msg;
     _sp_end.add_end();
-    _tf_data_desc.id = tf_data_id;
-    _tf_data_desc.name = "TimeFrequency";
-    _tf_data_desc.description = "TimeFrequency Data In Spectra order";
-
-    _ft_data_desc.id = tf_data_id;
-    _ft_data_desc.name = "FrequencyTime";
-    _ft_data_desc.description = "Frequency TimeSeries Data";
-
-    _data_start_time_desc.id = candidate_start_time_id;
-    _data_start_time_desc.name = "DataStartTime";
-    _data_start_time_desc.description= "MJD of candidate block start";
-    _data_start_time_desc.format.emplace_back('f', sizeof(double) * 8);
-
-    _data_number_of_channels_desc.id = data_number_of_channels_id;
-    _data_number_of_channels_desc.name = "channels";
-    _data_number_of_channels_desc.description = "number of channels in the data block";
-    _data_number_of_channels_desc.format.emplace_back('i', sizeof(std::size_t) * 8);
-
-    _data_channel_1.id = data_channel_1_id;
-    _data_channel_1.name = "top frequency";
-
-    _data_channel_width.id = data_channel_width_id;
-    _data_channel_width.name = "channel_width";
-
-    _data_sammple_interval.id = data_sample_interval_id;
-    _data_sammple_interval.name = "sample_interval";
-
-    _candidate_start_time_desc.id = candidate_start_time_id;
-    _candidate_start_time_desc.name = "CandidateStartTime";
-    _candidate_start_time_desc.description= "MJD of candidate pulse start";
-    _candidate_start_time_desc.format.emplace_back('f', sizeof(double) * 8);
-
-    _candidate_dm_desc.id = candidate_dm_id;
-    _candidate_dm_desc.name = "dm";
-    _candidate_dm_desc.description = "DispersionMeasure";
-
-    _candidate_width_desc.id = candidate_width_id;
-    _candidate_width_desc.name = "width";
-    _candidate_width_desc.description = "Pulse Width";
-
-    _candidate_sigma_desc.id = candidate_sigma_id;
-    _candidate_sigma_desc.name = "sigma";
-    _candidate_sigma_desc.description = "Pulse Sigma";
-
-    _candidate_duration_desc.id = candidate_duration_id;
-    _candidate_duration_desc.name = "duration";
-    _candidate_duration_desc.description = "Pulse Duration";
 
+    // describe where each field lives in the candidate objects so the receiver can unpack the raw block
     typedef typename data::SpCcl<uint8_t>::SpCandidateType CandidateType;
-    _candidate_dm_desc.format.push_back(TypeHelper<typename CandidateType::Dm::value_type>::format());
-    _candidate_width_desc.format.push_back(TypeHelper<typename CandidateType::MsecTimeType::value_type>::format());
-    _candidate_sigma_desc.format.push_back(TypeHelper<typename CandidateType::SigmaType>::format());
-    _candidate_duration_desc.format.push_back(TypeHelper<typename CandidateType::MsecTimeType::value_type>::format());
-
+    CandidateType const candidate;
+    _candidate_stride = sizeof(CandidateType);
+    _candidate_layout = {{ member_offset(&candidate, candidate.dm())
+                         , member_offset(&candidate, candidate.tstart())
+                         , member_offset(&candidate, candidate.width())
+                         , member_offset(&candidate, candidate.tend())
+                         , member_offset(&candidate, candidate.sigma())
+                        }};
+
+    _candidate_block_desc.id = candidate_block_id;
+    _candidate_block_desc.name = "candidates";
+    _candidate_block_desc.description = "Block of single pulse candidates (see CandidateStride and CandidateLayout)";
+
+    _candidate_block_start_time_desc.id = candidate_block_start_time_id;
+    _candidate_block_start_time_desc.name = "CandidateBlockStartTime";
+    _candidate_block_start_time_desc.description = "MJD the candidate start times are measured from";
+    _candidate_block_start_time_desc.format.emplace_back('f', sizeof(double) * 8);
+
+    _candidate_block_stride_desc.id = candidate_block_stride_id;
+    _candidate_block_stride_desc.name = "CandidateStride";
+    _candidate_block_stride_desc.description = "size in bytes of each candidate in the candidate block";
+    _candidate_block_stride_desc.format.emplace_back('u', sizeof(std::size_t) * 8);
+
+    _candidate_block_layout_desc.id = candidate_block_layout_id;
+    _candidate_block_layout_desc.name = "CandidateLayout";
+    _candidate_block_layout_desc.description = "byte offsets of the dm(f32, pc/cm^3), tstart(f64, ms), width(f64, ms), tend(f64, ms) and sigma(f32) within a candidate";
+    _candidate_block_layout_desc.format.emplace_back('u', sizeof(std::uint64_t) * 8);
+    _candidate_block_layout_desc.shape.push_back(_candidate_layout.size());
 }
 
 SpCclSpeadStreamer::~SpCclSpeadStreamer()
 {
-    _sp_stream.async_send_heap(_sp_end, [] (const boost::system::error_code&, spead2::item_pointer_t /*bytes_transferred*/){});
-    bool stopped = false;
-    std::thread th([&]() { _sp_stream.flush(); stopped=true; });
-    while(!stopped) {
-        _sp_stream.get_io_service().poll_one();
+    send(_sp_end, nullptr);
+    flush();
+}
+
+void SpCclSpeadStreamer::send(spead2::send::heap const& heap, std::shared_ptr<void const> keep_alive)
+{
+    {
+        std::unique_lock<std::mutex> lock(_send_mutex);
+        _send_cv.wait(lock, [this]() { return _heaps_in_flight < _max_heaps; });
+        ++_heaps_in_flight;
     }
-    th.join();
+    _sp_stream.async_send_heap(heap, [this, keep_alive] (const boost::system::error_code &ec, spead2::item_pointer_t /*bytes_transferred*/)
+                                     {
+                                         if (ec) {
+                                             PANDA_LOG_ERROR << "spead2 output stream failure: " << ec.message();
+                                         }
+                                         std::lock_guard<std::mutex> lock(_send_mutex);
+                                         --_heaps_in_flight;
+                                         _send_cv.notify_all();
+                                     });
+}
+
+void SpCclSpeadStreamer::flush()
+{
+    std::unique_lock<std::mutex> lock(_send_mutex);
+    _send_cv.wait(lock, [this]() { return _heaps_in_flight == 0; });
 }
 
 
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "cheetah/io/exporters/SpCclSpeadStreamerConfig.h"
+#include "panda/Error.h"
 
 
 namespace ska {
@@ -34,6 +35,7 @@ SpCclSpeadStreamerConfig::SpCclSpeadStreamerConfig()
     , _endpoint_config("ip")
     , _packet_size(4736)
     , _send_rate(1000000)
+    , _max_heap_size(1024)
 {
     _endpoint_config.address(ska::panda::IpAddress(9027, "127.0.0.1"));
     add(_endpoint_config);
@@ -48,7 +50,8 @@ void SpCclSpeadStreamerConfig::add_options(OptionsDescriptionEasyInit& add_optio
 {
     add_options
        ("packet_size",boost::program_options::value<unsigned>(&_packet_size)->default_value(_packet_size), "size of the UDP packet")
-       ("rate_limit",boost::program_options::value<float>(&_send_rate)->default_value(_send_rate), "limit the UDP send rate to avoid dropped packets (0.0=nlimited)");
+       ("rate_limit",boost::program_options::value<float>(&_send_rate)->default_value(_send_rate), "limit the UDP send rate to avoid dropped packets (0.0=nlimited)")
+       ("max_heap_size",boost::program_options::value<std::size_t>(&_max_heap_size)->default_value(_max_heap_size), "the maximum number of candidates to send in a single heap. Larger candidate lists are split over several heaps");
 }
 
 unsigned SpCclSpeadStreamerConfig::packet_size() const
@@ -76,6 +79,17 @@ float SpCclSpeadStreamerConfig::send_rate_limit() const
     return _send_rate;
 }
 
+std::size_t SpCclSpeadStreamerConfig::max_heap_size() const
+{
+    return _max_heap_size;
+}
+
+void SpCclSpeadStreamerConfig::max_heap_size(std::size_t number_of_candidates)
+{
+    if(number_of_candidates == 0) throw panda::Error("SpCclSpeadStreamerConfig: max_heap_size must be at least 1");
+    _max_heap_size = number_of_candidates;
+}
+
 } // namespace exporters
 } // namespace io
 } // namespace cheetah
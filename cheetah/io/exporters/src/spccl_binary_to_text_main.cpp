@@ -0,0 +1,97 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/** @addtogroup apps
+ * @{
+ * @section app_spccl_binary_to_text
+ * @brief cheetah_spccl_binary_to_text
+ * @details
+ *    Converts the files written by the spccl_binary_files exporter
+ *    into the text format of the spccl_files exporter.
+ *
+ *    @verbatim
+       cheetah_spccl_binary_to_text input.spcclb [output.spccl]
+      @endverbatim
+ *    If no output file is given the text is written to stdout.
+ *
+ * @} */ // end group
+
+#include "cheetah/io/exporters/SpCclBinaryBlock.h"
+#include "cheetah/io/exporters/detail/SpCclFileStreamerTraits.h"
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+void convert(std::istream& is, std::ostream& os)
+{
+    typedef ska::cheetah::io::exporters::SpCclFileStreamerTraits<uint8_t> TextTraits; // the text format does not depend on the data type
+
+    ska::cheetah::io::exporters::SpCclBinaryBlock::read_file_header(is);
+    TextTraits::headers(os, ska::cheetah::data::SpCcl<uint8_t>());
+
+    ska::cheetah::io::exporters::SpCclBinaryBlock block;
+    while(block.read(is))
+    {
+        for(std::size_t i=0; i < block.size(); ++i)
+        {
+            TextTraits::write_row(os, block.mjd()[i], block.dm()[i], block.width()[i], block.sigma()[i]);
+        }
+    }
+    os.flush();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+
+    if(argc < 2 || argc > 3 || std::string(argv[1]) == "--help" || std::string(argv[1]) == "-h") {
+        std::cerr << "usage: " << argv[0] << " input.spcclb [output.spccl]\n"
+                  << "    convert a binary single pulse candidate file to the text format" << std::endl;
+        return argc == 2 ? 0 : 1;
+    }
+
+    try {
+        std::ifstream input(argv[1], std::ios::binary);
+        if(!input) {
+            std::cerr << "unable to open " << argv[1] << std::endl;
+            return 1;
+        }
+        if(argc == 3) {
+            std::ofstream output(argv[2]);
+            if(!output) {
+                std::cerr << "unable to open " << argv[2] << std::endl;
+                return 1;
+            }
+            convert(input, output);
+        }
+        else {
+            convert(input, std::cout);
+        }
+    }
+    catch(std::exception const& e) {
+        std::cerr << "cheetah_spccl_binary_to_text: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
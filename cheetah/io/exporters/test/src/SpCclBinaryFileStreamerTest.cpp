@@ -0,0 +1,159 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/io/exporters/test/SpCclBinaryFileStreamerTest.h"
+#include "cheetah/io/exporters/SpCclBinaryFileStreamer.h"
+#include "cheetah/io/exporters/SpCclFileStreamer.h"
+#include "cheetah/data/DmTrials.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
+#include "panda/test/TestDir.h"
+#include <boost/filesystem/fstream.hpp>
+#include <sstream>
+
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace exporters {
+namespace test {
+
+
+SpCclBinaryFileStreamerTest::SpCclBinaryFileStreamerTest()
+    : ::testing::Test()
+{
+}
+
+SpCclBinaryFileStreamerTest::~SpCclBinaryFileStreamerTest()
+{
+}
+
+void SpCclBinaryFileStreamerTest::SetUp()
+{
+}
+
+void SpCclBinaryFileStreamerTest::TearDown()
+{
+}
+
+TEST_F(SpCclBinaryFileStreamerTest, test_block_round_trip)
+{
+    SpCclBinaryBlock block;
+    for(unsigned i=0; i < 5; ++i) {
+        block.push_back(58000.5 + i * 1e-6, 10.0f * i, 0.5 * i, 6.0f + i);
+    }
+    std::stringstream ss;
+    SpCclBinaryBlock::write_file_header(ss);
+    block.write(ss);
+    block.write(ss);
+
+    SpCclBinaryBlock read_block;
+    ASSERT_NO_THROW(SpCclBinaryBlock::read_file_header(ss));
+    for(unsigned n=0; n < 2; ++n) {
+        ASSERT_TRUE(read_block.read(ss));
+        ASSERT_EQ(block.mjd(), read_block.mjd());
+        ASSERT_EQ(block.dm(), read_block.dm());
+        ASSERT_EQ(block.width(), read_block.width());
+        ASSERT_EQ(block.sigma(), read_block.sigma());
+    }
+    ASSERT_FALSE(read_block.read(ss));
+}
+
+TEST_F(SpCclBinaryFileStreamerTest, test_block_corrupt)
+{
+    std::stringstream bad_header("not a candidate file");
+    ASSERT_THROW(SpCclBinaryBlock::read_file_header(bad_header), panda::Error);
+
+    SpCclBinaryBlock block;
+    block.push_back(58000.5, 10.0f, 0.5, 6.0f);
+    std::stringstream ss;
+    block.write(ss);
+    std::string truncated = ss.str();
+    truncated.resize(truncated.size() - 1);
+    std::stringstream truncated_ss(truncated);
+    ASSERT_THROW(block.read(truncated_ss), panda::Error);
+}
+
+TEST_F(SpCclBinaryFileStreamerTest, test_write)
+{
+    typedef typename data::SpCcl<uint8_t>::DmTrialsType DmTrialsType;
+
+    panda::test::TestDir tmp_dir;
+    SpCclBinaryFileStreamerConfig config;
+    config.queue_length(1);
+    ASSERT_NO_THROW(tmp_dir.create());
+    config.dir(tmp_dir.dir_name());
+
+    std::stringstream expected_text;
+    unsigned const number_of_lists = 4;
+    {
+        typename utils::ModifiedJulianClock::time_point start_time(utils::julian_day(2458179.500000));
+        auto metadata = std::make_shared<data::DmTrialsMetadata>(0.001 * data::seconds, 1000);
+        metadata->emplace_back(typename data::DmTrialsMetadata::DmType(0.0 * data::parsecs_per_cube_cm));
+        auto dm_trials = DmTrialsType::make_shared(metadata, start_time);
+        data::SpCcl<uint8_t> d1(dm_trials);
+        data::SpCcl<uint8_t>::SpCandidateType::MsecTimeType width(0.001 * boost::units::si::seconds);
+        data::SpCcl<uint8_t>::SpCandidateType::MsecTimeType tstart(0.5 * boost::units::si::seconds);
+
+        for (auto idx=0; idx<10; ++idx)
+        {
+            typename data::SpCcl<uint8_t>::SpCandidateType::Dm dm((12.0 + idx) * data::parsecs_per_cube_cm);
+            data::SpCcl<uint8_t>::SpCandidateType candidate(dm, tstart, width, 20.0f + idx, idx);
+            d1.push_back(candidate);
+        }
+
+        SpCclBinaryFileStreamer<uint8_t> writer(config);
+        for(unsigned n=0; n < number_of_lists; ++n) {
+            writer << d1;
+            SpCclFileStreamerTraits<uint8_t>::write(expected_text, d1);
+        }
+    } // the writer thread should drain its queue on leaving scope
+
+    auto it = boost::filesystem::directory_iterator(tmp_dir.path());
+    ASSERT_FALSE(it == boost::filesystem::directory_iterator());
+    boost::filesystem::path file = *it;
+    ASSERT_EQ(file.extension().string(), ".spcclb");
+    ASSERT_EQ(file.stem().string(), "2018_03_02_00:00:00");
+    ASSERT_EQ(1U, std::distance(it, boost::filesystem::directory_iterator()));
+
+    // convert back to the text format
+    boost::filesystem::ifstream input(file, std::ios::binary);
+    SpCclBinaryBlock::read_file_header(input);
+    SpCclBinaryBlock read_block;
+    std::stringstream text;
+    unsigned count = 0;
+    while(read_block.read(input)) {
+        ASSERT_EQ(10U, read_block.size());
+        for(std::size_t i=0; i < read_block.size(); ++i) {
+            SpCclFileStreamerTraits<uint8_t>::write_row(text, read_block.mjd()[i], read_block.dm()[i], read_block.width()[i], read_block.sigma()[i]);
+        }
+        ++count;
+    }
+    ASSERT_EQ(number_of_lists, count);
+    ASSERT_EQ(expected_text.str(), text.str());
+}
+
+} // namespace test
+} // namespace exporters
+} // namespace io
+} // namespace cheetah
+} // namespace ska
@@ -24,6 +24,9 @@
 #include "cheetah/io/exporters/test/SpCclSpeadReaderTest.h"
 #include "cheetah/io/exporters/SpCclSpeadReader.h"
 #include "cheetah/io/exporters/SpCclSpeadStreamer.h"
+#include "cheetah/data/DmTrials.h"
+#include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
 #include <memory>
 
 
@@ -55,28 +58,15 @@ template<typename NumericalRep>
 std::shared_ptr<data::SpCcl<NumericalRep>> spccl_data()
 {
     typedef data::SpCcl<NumericalRep> SpCclType;
-    typedef typename SpCclType::TimeFrequencyType TimeFrequencyType;
     typedef typename SpCclType::SpCandidateType Candidate;
 
     // set up the data
     typename utils::ModifiedJulianClock::time_point start_time(utils::julian_day(2458179.500000));
+    auto metadata = std::make_shared<data::DmTrialsMetadata>(0.001 * data::seconds, 1000);
+    metadata->emplace_back(typename data::DmTrialsMetadata::DmType(0.0 * data::parsecs_per_cube_cm));
+    std::shared_ptr<SpCclType> data = std::make_shared<SpCclType>(SpCclType::DmTrialsType::make_shared(metadata, start_time));
 
-    typename SpCclType::BlocksType blocks;
-    std::shared_ptr<TimeFrequencyType> block = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(1000)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block->start_time(static_cast<typename TimeFrequencyType::TimePointType>(start_time));
-    block->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block);
-    blocks.push_back(std::make_shared<TimeFrequencyType>( data::DimensionSize<data::Time>(100)
-                                                        , data::DimensionSize<data::Frequency>(10)));
-
-    std::shared_ptr<data::SpCcl<NumericalRep>> data(new data::SpCcl<NumericalRep>(blocks
-                                                   , data::DimensionIndex<data::Time>(0)));
-
-    std::size_t cand_duration = 40; // number of bins candidate covers
-    typename Candidate::MsecTimeType cand1_tend(cand_duration * block->sample_interval());
+    typename Candidate::MsecTimeType cand1_tend(40.0 * data::milliseconds);
     typename Candidate::Dm cand1_dm(00.0 * data::parsecs_per_cube_cm);
     Candidate candidate_1( cand1_dm
                         , typename Candidate::MsecTimeType(0.0 * boost::units::si::seconds)
@@ -104,7 +94,7 @@ TEST_F(SpCclSpeadReaderTest, test_reset)
 
     // generate some data
     auto data = spccl_data<NumericalRep>();
-    typedef typename std::remove_reference<decltype(*data)>::type::TimeFrequencyType TimeFrequencyType;
+    typedef data::TimeFrequency<Cpu, NumericalRep> TimeFrequencyType;
 
     std::vector<std::shared_ptr<data::SpCandidateData<TimeFrequencyType>>> recv_data;
     SpCclSpeadReader<TimeFrequencyType> reader(reader_config
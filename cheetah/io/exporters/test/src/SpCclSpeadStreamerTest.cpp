@@ -24,7 +24,10 @@
 #include "cheetah/io/exporters/test/SpCclSpeadStreamerTest.h"
 #include "cheetah/io/exporters/SpCclSpeadStreamer.h"
 #include "cheetah/io/exporters/SpCclSpeadReader.h"
+#include "cheetah/data/DmTrials.h"
+#include "cheetah/data/TimeFrequency.h"
 #include "cheetah/utils/ModifiedJulianClock.h"
+#include "panda/Error.h"
 #include <vector>
 
 
@@ -79,6 +82,12 @@ class TestExporter {
             return *this;
         }
 
+        template<typename T>
+        TestExporter& operator<<(std::shared_ptr<data::SpCcl<T>> const& data) {
+            _writer << data;
+            return *this;
+        }
+
         // returns the next received chunk, blocking
         data::SpCandidateData<TimeFrequencyType> const& get()
         {
@@ -106,40 +115,36 @@ TYPED_TEST(SpCclSpeadStreamerTest, test_construct_destruct_without_using)
     exporters::SpCclSpeadStreamer writer(config, engine);
 }
 
-TYPED_TEST(SpCclSpeadStreamerTest, test_send_single_candidate)
+template<typename NumericalRep>
+std::shared_ptr<data::SpCcl<NumericalRep>> make_candidate_list(std::size_t number_of_candidates)
 {
-    typedef TypeParam NumericalRep;
     typedef data::SpCcl<NumericalRep> SpCclType;
-    typedef typename SpCclType::TimeFrequencyType TimeFrequencyType;
     typedef typename SpCclType::SpCandidateType Candidate;
 
-    // set up the data
     typename utils::ModifiedJulianClock::time_point start_time(utils::julian_day(2458179.500000));
+    auto metadata = std::make_shared<data::DmTrialsMetadata>(0.001 * data::seconds, 1000);
+    metadata->emplace_back(typename data::DmTrialsMetadata::DmType(0.0 * data::parsecs_per_cube_cm));
+    auto data = std::make_shared<SpCclType>(SpCclType::DmTrialsType::make_shared(metadata, start_time));
+
+    for(std::size_t i=0; i < number_of_candidates; ++i) {
+        typename Candidate::MsecTimeType tstart((10.0 * i) * data::milliseconds);
+        data->push_back(Candidate( typename Candidate::Dm((10.0 + i) * data::parsecs_per_cube_cm)
+                                 , tstart
+                                 , typename Candidate::MsecTimeType((1.0 + i) * data::milliseconds)
+                                 , tstart + typename Candidate::MsecTimeType(40.0 * data::milliseconds)
+                                 , 2.0 + i
+                                 , i
+                                 ));
+    }
+    return data;
+}
+
+TYPED_TEST(SpCclSpeadStreamerTest, test_send_single_candidate)
+{
+    typedef TypeParam NumericalRep;
+    typedef data::TimeFrequency<Cpu, NumericalRep> TimeFrequencyType;
 
-    typename SpCclType::BlocksType blocks;
-    std::shared_ptr<TimeFrequencyType> block = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(1000)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block->start_time(static_cast<typename TimeFrequencyType::TimePointType>(start_time));
-    block->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block);
-    blocks.push_back(std::make_shared<TimeFrequencyType>( data::DimensionSize<data::Time>(100)
-                                                        , data::DimensionSize<data::Frequency>(10)));
-
-    std::shared_ptr<data::SpCcl<NumericalRep>> data(new data::SpCcl<NumericalRep>(blocks
-                                                                                 , data::DimensionIndex<data::Time>(0)));
-
-    std::size_t cand_duration = 40; // number of bins candidate covers
-    typename Candidate::MsecTimeType cand1_tend(cand_duration * block->sample_interval());
-    typename Candidate::Dm cand1_dm(00.0 * data::parsecs_per_cube_cm);
-    Candidate candidate_1( cand1_dm
-                        , typename Candidate::MsecTimeType(0.0 * boost::units::si::seconds)
-                        , typename Candidate::MsecTimeType(0.001 * boost::units::si::seconds)
-                        , cand1_tend
-                        , 2.0
-                        );
-    data->push_back(candidate_1);
+    auto data = make_candidate_list<NumericalRep>(1);
 
     // send and recieve the data
     SpCclSpeadStreamerConfig config;
@@ -150,155 +155,124 @@ TYPED_TEST(SpCclSpeadStreamerTest, test_send_single_candidate)
     auto const& rdata = exporter.get();
 
     // verify reception
-    // data
-    ASSERT_LE(rdata.data_size(), data->tf_blocks()[0]->data_size());
-    ASSERT_EQ(rdata.number_of_channels(), block->number_of_channels());
-    ASSERT_EQ(rdata.sample_interval(), block->sample_interval());
-    ASSERT_EQ(rdata.number_of_spectra(), cand_duration);
-
-    // candidates
     ASSERT_EQ(rdata.number_of_candidates(), data->size());
-    for(std::size_t i=0; i< rdata.number_of_candidates(); ++i) {
-        ASSERT_EQ((rdata).candidate(i).dm(), (*data)[i].dm());
-        ASSERT_EQ((rdata).candidate(i).sigma(), (*data)[i].sigma());
-        ASSERT_EQ((rdata).candidate(i).width(), (*data)[i].width());
-        ASSERT_EQ((rdata).candidate(i).duration(), (*data)[i].tend());
-    }
-    ASSERT_EQ((rdata).candidate(0).start_time(), block->start_time());
+    ASSERT_EQ(rdata.candidate(0).dm(), (*data)[0].dm());
+    ASSERT_EQ(rdata.candidate(0).sigma(), (*data)[0].sigma());
+    ASSERT_EQ(rdata.candidate(0).width(), (*data)[0].width());
+    ASSERT_EQ(rdata.candidate(0).duration(), (*data)[0].tend());
+    ASSERT_EQ(rdata.candidate(0).start_time(), data->start_time());
 }
 
-TYPED_TEST(SpCclSpeadStreamerTest, test_send_single_candidate_across_blocks)
+TYPED_TEST(SpCclSpeadStreamerTest, test_send_candidates_split_across_heaps)
 {
     typedef TypeParam NumericalRep;
-    typedef data::SpCcl<NumericalRep> SpCclType;
-    typedef typename SpCclType::TimeFrequencyType TimeFrequencyType;
-    typedef typename SpCclType::SpCandidateType Candidate;
-
-    // set up the data
-    typename utils::ModifiedJulianClock::time_point start_time(utils::julian_day(2458179.500000));
+    typedef data::TimeFrequency<Cpu, NumericalRep> TimeFrequencyType;
 
-    typename SpCclType::BlocksType blocks;
-    std::shared_ptr<TimeFrequencyType> block = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(1000)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block->start_time(static_cast<typename TimeFrequencyType::TimePointType>(start_time));
-    block->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block);
-    std::shared_ptr<TimeFrequencyType> block_2 = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(100)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block_2->start_time(block->end_time() + block->sample_interval());
-    block_2->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block_2);
-
-    std::shared_ptr<data::SpCcl<NumericalRep>> data(new data::SpCcl<NumericalRep>(blocks
-                                                                                  , data::DimensionIndex<data::Time>(0)));
-
-    std::size_t cand_duration = block->number_of_spectra() + 10; // number of bins candidate covers
-    typename Candidate::MsecTimeType cand1_tstart(10.0 * block->sample_interval());
-    typename Candidate::MsecTimeType cand1_tend(cand_duration * block->sample_interval()); cand1_tend += cand1_tstart;
-    typename Candidate::Dm cand1_dm(100.0 * data::parsecs_per_cube_cm);
-    Candidate candidate_1( cand1_dm
-                         , cand1_tstart
-                         , typename Candidate::MsecTimeType(0.1 * boost::units::si::seconds)
-                         , cand1_tend
-                         , 2.0
-                         );
-    data->push_back(candidate_1);
+    std::size_t const number_of_candidates = 5;
+    auto data = make_candidate_list<NumericalRep>(number_of_candidates);
 
+    // send and recieve the data
     SpCclSpeadStreamerConfig config;
+    config.max_heap_size(2);
     SpCclSpeadReaderConfig reader_config;
     TestExporter<TimeFrequencyType> exporter(config, reader_config);
     exporter << *data;
 
-    auto const& rdata = exporter.get();
+    // expect ceil(5/2) heaps, each arriving as a separate chunk
+    std::size_t received = 0;
+    for(std::size_t heap=0; heap < 3; ++heap) {
+        auto const& rdata = exporter.get();
+        ASSERT_EQ(rdata.number_of_candidates(), (heap == 2) ? 1U : 2U);
+        for(std::size_t i=0; i< rdata.number_of_candidates(); ++i, ++received) {
+            auto const& candidate = (*data)[received];
+            ASSERT_EQ(rdata.candidate(i).dm(), candidate.dm());
+            ASSERT_EQ(rdata.candidate(i).sigma(), candidate.sigma());
+            ASSERT_EQ(rdata.candidate(i).width(), candidate.width());
+            ASSERT_EQ(rdata.candidate(i).duration(), candidate.tend());
+            ASSERT_EQ(rdata.candidate(i).start_time(), data->start_time(candidate));
+        }
+    }
+    ASSERT_EQ(number_of_candidates, received);
+}
 
-    // verify reception
-    // data
-    ASSERT_EQ(rdata.number_of_channels(), block->number_of_channels());
-    ASSERT_EQ(rdata.sample_interval(), block->sample_interval());
-    ASSERT_EQ(rdata.number_of_spectra(), cand_duration);
+TYPED_TEST(SpCclSpeadStreamerTest, test_send_does_not_wait_for_the_candidate_list)
+{
+    typedef TypeParam NumericalRep;
+    typedef data::TimeFrequency<Cpu, NumericalRep> TimeFrequencyType;
+
+    std::size_t const number_of_candidates = 5;
+    auto data = make_candidate_list<NumericalRep>(number_of_candidates);
+    data::SpCcl<NumericalRep> const expected(*data);
+
+    SpCclSpeadStreamerConfig config;
+    config.max_heap_size(2);
+    SpCclSpeadReaderConfig reader_config;
+    TestExporter<TimeFrequencyType> exporter(config, reader_config);
 
+    // the streamer holds on to the list until it has been sent
+    exporter << data;
+    data.reset();
+
+    // a list passed by reference that is not shared is copied, so it may be reused as soon as the call returns
+    data::SpCcl<NumericalRep> reused(*make_candidate_list<NumericalRep>(1));
+    exporter << reused;
+    reused.clear();
+
+    std::size_t received = 0;
+    for(std::size_t heap=0; heap < 3; ++heap) {
+        auto const& rdata = exporter.get();
+        for(std::size_t i=0; i< rdata.number_of_candidates(); ++i, ++received) {
+            ASSERT_EQ(rdata.candidate(i).dm(), expected[received].dm());
+            ASSERT_EQ(rdata.candidate(i).sigma(), expected[received].sigma());
+        }
+    }
+    ASSERT_EQ(number_of_candidates, received);
+
+    auto const& rdata = exporter.get();
+    ASSERT_EQ(1U, rdata.number_of_candidates());
+    ASSERT_EQ(rdata.candidate(0).dm(), expected[0].dm());
 }
 
-TYPED_TEST(SpCclSpeadStreamerTest, test_send_overlapping_candidates_in_first_block)
+TYPED_TEST(SpCclSpeadStreamerTest, test_send_shared_list_by_reference_is_not_copied)
 {
     typedef TypeParam NumericalRep;
-    typedef data::SpCcl<NumericalRep> SpCclType;
-    typedef typename SpCclType::TimeFrequencyType TimeFrequencyType;
-    typedef typename SpCclType::SpCandidateType Candidate;
+    typedef data::TimeFrequency<Cpu, NumericalRep> TimeFrequencyType;
 
-    // set up the data
-    typename utils::ModifiedJulianClock::time_point start_time(utils::julian_day(2458179.500000));
+    std::size_t const number_of_candidates = 5;
+    auto data = make_candidate_list<NumericalRep>(number_of_candidates);
+    data::SpCcl<NumericalRep> const expected(*data);
 
-    typename SpCclType::BlocksType blocks;
-    std::shared_ptr<TimeFrequencyType> block = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(1000)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block->start_time(static_cast<typename TimeFrequencyType::TimePointType>(start_time));
-    block->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block);
-    std::shared_ptr<TimeFrequencyType> block_2 = std::make_shared<TimeFrequencyType>(
-                                                         data::DimensionSize<data::Time>(600)
-                                                       , data::DimensionSize<data::Frequency>(10));
-
-    block_2->start_time(block->end_time() + block->sample_interval());
-    block_2->sample_interval(0.001 * boost::units::si::seconds);
-    blocks.push_back(block_2);
-
-    std::shared_ptr<data::SpCcl<NumericalRep>> data(new data::SpCcl<NumericalRep>(blocks
-                                                                                 , data::DimensionIndex<data::Time>(0)));
-
-    std::size_t cand_duration = 40; // number of bins candidate covers
-    typename Candidate::MsecTimeType cand1_tend(cand_duration * block->sample_interval());
-    typename Candidate::Dm cand1_dm(10.0 * data::parsecs_per_cube_cm);
-    Candidate candidate_1( cand1_dm
-                        , typename Candidate::MsecTimeType(0.0 * boost::units::si::seconds)
-                        , typename Candidate::MsecTimeType(0.001 * boost::units::si::seconds)
-                        , cand1_tend
-                        , 2.0
-                        );
-    data->push_back(candidate_1);
-    // candidate 2 starts before the cand1_tend by a single sample and extends to 1 sample beyond it
-    Candidate candidate_2( cand1_dm
-                        , cand1_tend - static_cast<typename Candidate::MsecTimeType>(block->sample_interval())
-                        , typename Candidate::MsecTimeType(0.001 * boost::units::si::seconds)
-                        , cand1_tend + static_cast<typename Candidate::MsecTimeType>(block->sample_interval())
-                        , 2.0
-                        );
-    data->push_back(candidate_2);
+    // the streamer recovers the owning shared_ptr from the reference
+    ASSERT_EQ(data, data->weak_from_this().lock());
 
-    // send and recieve the data
     SpCclSpeadStreamerConfig config;
+    config.max_heap_size(2);
     SpCclSpeadReaderConfig reader_config;
     TestExporter<TimeFrequencyType> exporter(config, reader_config);
-    exporter << *data;
 
-    auto const& rdata = exporter.get();
-
-    // verify reception
-    // data
-    ASSERT_EQ(rdata.number_of_channels(), block->number_of_channels());
-    ASSERT_LE(rdata.data_size(), data->tf_blocks()[0]->data_size());
-    ASSERT_EQ(rdata.sample_interval(), block->sample_interval());
-    ASSERT_EQ(rdata.number_of_spectra(), cand_duration + 1); // enough to cover both candidates
+    // as the DataExport handlers do: a reference to a list owned by a shared_ptr
+    exporter << static_cast<data::SpCcl<NumericalRep> const&>(*data);
+    data.reset();
 
-    // candidates
-    ASSERT_EQ(rdata.number_of_candidates(), data->size());
-    for(std::size_t i=0; i< rdata.number_of_candidates(); ++i) {
-        ASSERT_EQ(rdata.candidate(i).dm(), (*data)[i].dm());
-        ASSERT_EQ(rdata.candidate(i).sigma(), (*data)[i].sigma());
-        ASSERT_EQ(rdata.candidate(i).width(), (*data)[i].width());
-        ASSERT_EQ(rdata.candidate(i).duration(), (*data)[i].tend());
+    std::size_t received = 0;
+    for(std::size_t heap=0; heap < 3; ++heap) {
+        auto const& rdata = exporter.get();
+        for(std::size_t i=0; i< rdata.number_of_candidates(); ++i, ++received) {
+            ASSERT_EQ(rdata.candidate(i).dm(), expected[received].dm());
+            ASSERT_EQ(rdata.candidate(i).sigma(), expected[received].sigma());
+        }
     }
-    ASSERT_EQ(rdata.candidate(0).start_time(), block->start_time());
-    ASSERT_EQ(rdata.candidate(1).start_time(), data->start_time(candidate_2));
+    ASSERT_EQ(number_of_candidates, received);
 }
 
-
+TEST(SpCclSpeadStreamerConfigTest, test_max_heap_size)
+{
+    SpCclSpeadStreamerConfig config;
+    ASSERT_EQ(1024U, config.max_heap_size());
+    config.max_heap_size(10);
+    ASSERT_EQ(10U, config.max_heap_size());
+    ASSERT_THROW(config.max_heap_size(0), panda::Error);
+}
 
 } // namespace test
 } // namespace exporters
@@ -0,0 +1,103 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_IO_PRODUCERS_RCPT_MISSINGPACKETPOLICY_H
+#define SKA_CHEETAH_IO_PRODUCERS_RCPT_MISSINGPACKETPOLICY_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace producers {
+namespace rcpt {
+
+/**
+ * @brief Describes how the data corresponding to a lost UDP packet is to be replaced
+ * @details The fill operations work on contiguous ranges of the chunk and are written
+ *          so that the compiler can turn them into memset/memcpy or vectorised loops.
+ *          They are called from the packet stream threads and so must remain cheap
+ *          even under packet loss bursts.
+ */
+
+class MissingPacketPolicy
+{
+    public:
+        /**
+         * @brief the available fill strategies
+         * @details Zero     : replace missing samples with zero
+         *          LastGood : replicate the preceding slice of the chunk
+         *          Noise    : random samples matching the mean and rms of the preceding slice
+         */
+        enum class Type { Zero, LastGood, Noise };
+
+    public:
+        /**
+         * @brief convert a policy name (zero, last_good, noise) into its Type
+         * @throw panda::Error if the name is not recognised
+         */
+        static Type from_string(std::string const& name);
+
+        /**
+         * @brief the name of the policy type
+         */
+        static std::string to_string(Type type);
+
+        /**
+         * @brief the names of all available policies
+         */
+        static std::vector<std::string> available();
+
+        /**
+         * @brief fill the missing slice [chunk_begin + offset, chunk_begin + offset + size)
+         * @param chunk_begin iterator to the first element of the chunk. Must be a contiguous iterator.
+         * @param offset the position of the missing slice in the chunk
+         * @param size the number of elements to fill
+         * @details where a policy requires prior data that is not available (e.g. at the start
+         *          of a chunk) the slice is zero filled.
+         */
+        template<typename IteratorT>
+        static void fill(Type type, IteratorT chunk_begin, std::size_t offset, std::size_t size);
+
+    private:
+        template<typename T>
+        static void fill_zero(T* begin, std::size_t size);
+
+        template<typename T>
+        static void fill_last_good(T* chunk_begin, std::size_t offset, std::size_t size);
+
+        template<typename T>
+        static void fill_noise(T* chunk_begin, std::size_t offset, std::size_t size);
+};
+
+
+} // namespace rcpt
+} // namespace producers
+} // namespace io
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/io/producers/rcpt/detail/MissingPacketPolicy.cpp"
+
+#endif // SKA_CHEETAH_IO_PRODUCERS_RCPT_MISSINGPACKETPOLICY_H
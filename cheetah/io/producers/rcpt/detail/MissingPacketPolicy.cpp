@@ -0,0 +1,133 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/io/producers/rcpt/MissingPacketPolicy.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace producers {
+namespace rcpt {
+
+template<typename IteratorT>
+void MissingPacketPolicy::fill(Type type, IteratorT chunk_begin, std::size_t offset, std::size_t size)
+{
+    typedef typename std::remove_cv<typename std::iterator_traits<IteratorT>::value_type>::type ValueType;
+    if(size == 0) return;
+    // work on raw pointers so the compiler is free to vectorise
+    ValueType* begin = &*chunk_begin;
+    switch(type) {
+        case Type::LastGood:
+            fill_last_good(begin, offset, size);
+            break;
+        case Type::Noise:
+            fill_noise(begin, offset, size);
+            break;
+        default:
+            fill_zero(begin + offset, size);
+            break;
+    }
+}
+
+template<typename T>
+void MissingPacketPolicy::fill_zero(T* begin, std::size_t size)
+{
+    std::fill_n(begin, size, T(0));
+}
+
+template<typename T>
+void MissingPacketPolicy::fill_last_good(T* chunk_begin, std::size_t offset, std::size_t size)
+{
+    if(offset == 0) {
+        fill_zero(chunk_begin, size);
+        return;
+    }
+
+    // replicate the preceding data in blocks of up to offset elements (non overlapping copies)
+    T* out = chunk_begin + offset;
+    std::size_t remaining = size;
+    std::size_t const block = std::min(offset, size);
+    T const* const src = chunk_begin + offset - block;
+    while(remaining > 0) {
+        std::size_t const n = std::min(block, remaining);
+        std::memcpy(out, src, n * sizeof(T));
+        out += n;
+        remaining -= n;
+    }
+}
+
+template<typename T>
+void MissingPacketPolicy::fill_noise(T* chunk_begin, std::size_t offset, std::size_t size)
+{
+    std::size_t const reference_size = std::min(offset, size);
+    if(reference_size == 0) {
+        fill_zero(chunk_begin + offset, size);
+        return;
+    }
+
+    // single pass estimate of the statistics of the preceding slice
+    T const* const reference = chunk_begin + offset - reference_size;
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for(std::size_t i=0; i < reference_size; ++i) {
+        double const v = static_cast<double>(reference[i]);
+        sum += v;
+        sum_sq += v * v;
+    }
+    float const mean = static_cast<float>(sum / reference_size);
+    float const rms = static_cast<float>(std::sqrt(std::max(0.0, sum_sq / reference_size - (sum / reference_size) * (sum / reference_size))));
+
+    // approximately gaussian noise from the sum of 4 uniform deviates (Irwin-Hall)
+    // generated with a xorshift generator. This is not intended to be statistically
+    // perfect, only cheap and free of obvious artefacts.
+    static thread_local uint64_t state = 0x9E3779B97F4A7C15ULL;
+    float const scale = rms * std::sqrt(3.0f) / static_cast<float>(1U<<16);
+    float const lower = static_cast<float>(std::numeric_limits<T>::lowest());
+    float const upper = static_cast<float>(std::numeric_limits<T>::max());
+    T* out = chunk_begin + offset;
+    for(std::size_t i=0; i < size; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        float const sum_uniform = static_cast<float>((state & 0xFFFF) + ((state >> 16) & 0xFFFF) + ((state >> 32) & 0xFFFF) + (state >> 48));
+        float value = mean + (sum_uniform - 2.0f * static_cast<float>(1U<<16)) * scale;
+        if(std::is_integral<T>::value) {
+            value = std::min(upper, std::max(lower, std::round(value)));
+        }
+        out[i] = static_cast<T>(value);
+    }
+}
+
+} // namespace rcpt
+} // namespace producers
+} // namespace io
+} // namespace cheetah
+} // namespace ska
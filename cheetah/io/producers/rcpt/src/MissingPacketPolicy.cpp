@@ -0,0 +1,66 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/io/producers/rcpt/MissingPacketPolicy.h"
+#include "panda/Error.h"
+
+
+namespace ska {
+namespace cheetah {
+namespace io {
+namespace producers {
+namespace rcpt {
+
+
+MissingPacketPolicy::Type MissingPacketPolicy::from_string(std::string const& name)
+{
+    if(name == "zero") return Type::Zero;
+    if(name == "last_good") return Type::LastGood;
+    if(name == "noise") return Type::Noise;
+    panda::Error e("unknown missing packet policy: ");
+    e << name;
+    throw e;
+}
+
+std::string MissingPacketPolicy::to_string(Type type)
+{
+    switch(type) {
+        case Type::LastGood:
+            return "last_good";
+        case Type::Noise:
+            return "noise";
+        default:
+            return "zero";
+    }
+}
+
+std::vector<std::string> MissingPacketPolicy::available()
+{
+    return { "zero", "last_good", "noise" };
+}
+
+} // namespace rcpt
+} // namespace producers
+} // namespace io
+} // namespace cheetah
+} // namespace ska
@@ -25,6 +25,7 @@
 #define SKA_CHEETAH_IO_PRODUCERS_RCPT_LOW_CONFIG_H
 
 #include "cheetah/utils/Config.h"
+#include "cheetah/io/producers/rcpt/MissingPacketPolicy.h"
 #include "panda/EndpointConfig.h"
 #include <panda/ProcessingEngine.h>
 #include <panda/ProcessingEngineConfig.h>
@@ -85,6 +86,16 @@ class Config : public utils::Config
          */
         std::size_t max_buffers() const;
 
+        /**
+         * @brief the policy used to replace the data of missing packets
+         */
+        rcpt::MissingPacketPolicy::Type missing_packet_policy() const;
+
+        /**
+         * @brief set the policy used to replace the data of missing packets
+         */
+        void missing_packet_policy(rcpt::MissingPacketPolicy::Type policy);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
@@ -94,6 +105,7 @@ class Config : public utils::Config
         unsigned _spectra_per_chunk;
         unsigned _number_of_channels;
         std::size_t _max_buffer_count;
+        rcpt::MissingPacketPolicy::Type _missing_packet_policy;
         ska::panda::EndpointConfig _endpoint_config; // listen address
 };
 
@@ -33,7 +33,8 @@ namespace producers {
 namespace rcpt_low {
 
 template<class PacketTraits>
-BeamFormerDataTraits<PacketTraits>::BeamFormerDataTraits()
+BeamFormerDataTraits<PacketTraits>::BeamFormerDataTraits(rcpt::MissingPacketPolicy::Type policy)
+    : _missing_packet_policy(policy)
 {
 }
 
@@ -116,17 +117,23 @@ void BeamFormerDataTraits<PacketTraits>::deserialise_packet(ContextType& context
 
 template<class PacketTraits>
 template<typename ContextType>
-void BeamFormerDataTraits<PacketTraits>::process_missing_slice(ContextType& context)
+void BeamFormerDataTraits<PacketTraits>::process_missing_slice(ContextType& context) const
 {
-    // essentially replacing the data corresponding to the missing packet to 0. (Dont know what is the best approach here.)
-    unsigned offset = context.offset();
-    auto it=context.chunk().begin() + offset;
-    PANDA_LOG_DEBUG << "processing missing packet: data=" << (void*)&*it << context;
-    for(std::size_t i=0; i < context.size() ; ++i) {
-        *it = 0;
-        assert(it!=context.chunk().end());
-        ++it;
-    }
+    PANDA_LOG_DEBUG << "processing missing packet: data=" << (void*)&*(context.chunk().begin() + context.offset()) << context;
+    assert(context.offset() + context.size() <= chunk_size(context.chunk()));
+    rcpt::MissingPacketPolicy::fill(_missing_packet_policy, context.chunk().begin(), context.offset(), context.size());
+}
+
+template<class PacketTraits>
+void BeamFormerDataTraits<PacketTraits>::missing_packet_policy(rcpt::MissingPacketPolicy::Type policy)
+{
+    _missing_packet_policy = policy;
+}
+
+template<class PacketTraits>
+rcpt::MissingPacketPolicy::Type BeamFormerDataTraits<PacketTraits>::missing_packet_policy() const
+{
+    return _missing_packet_policy;
 }
 
 template<class PacketTraits>
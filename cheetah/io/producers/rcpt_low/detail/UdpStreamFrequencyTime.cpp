@@ -30,9 +30,12 @@ namespace rcpt_low {
 
 template<typename Producer>
 UdpStreamFrequencyTimeTmpl<Producer>::UdpStreamFrequencyTimeTmpl(Config const& config)
-    : BaseT(config.engine(), ConnectionTraits::SocketType(static_cast<panda::Engine&>(config.engine()), config.remote_end_point()))
+    : BaseT(config.engine(), ConnectionTraits::SocketType(static_cast<panda::Engine&>(config.engine()), config.remote_end_point()), BeamFormerDataTraitsLow(config.missing_packet_policy()))
     , _n_channels(config.number_of_channels())
     , _n_samples(config.spectra_per_chunk())
+    , _metadata_valid(false)
+    , _first_channel_frequency(0)
+    , _channel_separation(0)
 {
     boost::asio::socket_base::receive_buffer_size option(16*1024*1024);
     this->connection().socket().set_option(option);
@@ -51,24 +54,45 @@ void UdpStreamFrequencyTimeTmpl<Producer>::init()
 }
 
 
+template<typename Producer>
+void UdpStreamFrequencyTimeTmpl<Producer>::update_metadata(PacketInspector const& packet)
+{
+    // the frequency and sampling metadata only change with the stream configuration
+    // so we only regenerate it when the packet header values it depends on change
+    auto const first_channel_frequency = packet.packet().first_channel_frequency();
+    auto const channel_separation = packet.packet().channel_separation();
+    if(_metadata_valid && first_channel_frequency == _first_channel_frequency && channel_separation == _channel_separation) return;
+
+    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType fch1 = first_channel_frequency * data::megahertz;
+    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType bandwidth = (((double)std::ceil((channel_separation*1e-9)*PssLowTraits::number_of_channels))*boost::units::si::mega * ska::cheetah::data::hertz);
+    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType foff = (-1.0*bandwidth.value()/(double)PssLowTraits::number_of_channels)*boost::units::si::mega * ska::cheetah::data::hertz;
+    _metadata.sample_interval(TimeType(((double)PssLowTraits::number_of_channels/bandwidth.value())*1e-6 * ska::cheetah::data::seconds));
+    _metadata.channel_frequencies_const_width(fch1, foff, _n_channels);
+
+    _first_channel_frequency = first_channel_frequency;
+    _channel_separation = channel_separation;
+    _metadata_valid = true;
+}
+
 template<typename Producer>
 template<typename DataType>
 std::shared_ptr<DataType> UdpStreamFrequencyTimeTmpl<Producer>::get_chunk(unsigned , PacketInspector const& packet)
 {
     auto chunk = BaseT::template get_chunk<DataType>();
-    if(chunk) {
+    if(!chunk) return chunk;
+
+    // chunks are recycled so we only need to resize if the shape has changed
+    if(chunk->number_of_spectra() != _n_samples || chunk->number_of_channels() != _n_channels) {
         chunk->resize( _n_samples, _n_channels);
     }
+
+    update_metadata(packet);
+    chunk->metadata(_metadata);
+
     const UdpStreamFrequencyTimeTmpl<Producer>::TsampType fraction = ((double)(packet.packet().timestamp_attoseconds()*1e-18)*ska::cheetah::data::seconds);
     const UdpStreamFrequencyTimeTmpl<Producer>::TsampType seconds = ((double)(packet.packet().timestamp_seconds())*ska::cheetah::data::seconds);
     const std::chrono::time_point<std::chrono::system_clock> system_epoch;
     chunk->start_time(ska::cheetah::utils::ModifiedJulianClock::time_point(system_epoch+seconds+fraction));
-
-    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType fch1 = packet.packet().first_channel_frequency() * data::megahertz;
-    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType bandwidth = (((double)std::ceil((packet.packet().channel_separation()*1e-9)*PssLowTraits::number_of_channels))*boost::units::si::mega * ska::cheetah::data::hertz);
-    UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType foff = (-1.0*static_cast<UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType>(bandwidth).value()/(double)PssLowTraits::number_of_channels)*boost::units::si::mega * ska::cheetah::data::hertz;
-    chunk->sample_interval(TimeType(((double)PssLowTraits::number_of_channels/static_cast<UdpStreamFrequencyTimeTmpl<Producer>::FrequencyType>(bandwidth).value())*1e-6 * ska::cheetah::data::seconds));
-    chunk->set_channel_frequencies_const_width(fch1, foff);
     return chunk;
 }
 
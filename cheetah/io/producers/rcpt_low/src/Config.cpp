@@ -35,6 +35,7 @@ Config::Config()
     : utils::Config("udp_low")
     , _engine_config(2)
     , _spectra_per_chunk(128U)
+    , _missing_packet_policy(rcpt::MissingPacketPolicy::Type::Zero)
     , _endpoint_config("listen")
 {
     _endpoint_config.address(ska::panda::IpAddress(34345, "127.0.0.1"));
@@ -51,7 +52,8 @@ void Config::add_options(OptionsDescriptionEasyInit& add_options)
     ("number_of_threads", boost::program_options::value<unsigned>()->default_value(1U)->notifier([&](unsigned v) { _engine_config = v; }) , "the number of threads to run the engine")
     ("spectra_per_chunk", boost::program_options::value<unsigned>(&_spectra_per_chunk)->default_value(_spectra_per_chunk), "the number of time slices in each chunk (time_slices x no_of_channels = total data samples)")
     ("number_of_channels", boost::program_options::value<unsigned>(&_number_of_channels)->default_value(8U), "the number of frequency channels in each time sample")
-    ("max_buffers", boost::program_options::value<std::size_t>(&_max_buffer_count)->default_value(10U), "the max number of udp packet buffers to use");
+    ("max_buffers", boost::program_options::value<std::size_t>(&_max_buffer_count)->default_value(10U), "the max number of udp packet buffers to use")
+    ("missing_packet_policy", boost::program_options::value<std::string>()->default_value(rcpt::MissingPacketPolicy::to_string(_missing_packet_policy))->notifier([&](std::string const& v) { _missing_packet_policy = rcpt::MissingPacketPolicy::from_string(v); }), "how to replace the data of missing packets (zero, last_good, noise)");
 }
 
 Config::Engine& Config::engine() const
@@ -97,6 +99,16 @@ std::size_t Config::max_buffers() const
     return _max_buffer_count;
 }
 
+rcpt::MissingPacketPolicy::Type Config::missing_packet_policy() const
+{
+    return _missing_packet_policy;
+}
+
+void Config::missing_packet_policy(rcpt::MissingPacketPolicy::Type policy)
+{
+    _missing_packet_policy = policy;
+}
+
 } // namespace rcpt_low
 } // namespace producers
 } // namespace io
@@ -25,6 +25,8 @@
 #include "cheetah/io/producers/rcpt_low/BeamFormerPacketInspector.h"
 #include "cheetah/io/producers/rcpt_low/BeamFormerDataTraits.h"
 #include "panda/concepts/ChunkerContextDataTraitsConcept.h"
+#include "panda/Error.h"
+#include <numeric>
 #include <vector>
 
 
@@ -94,6 +96,32 @@ struct TestContext {
 template<typename T>
 std::ostream& operator<<(std::ostream& os, TestContext<T> const&) { return os; }
 
+// context describing a missing slice part way through a chunk
+template<typename T>
+struct MissingSliceContext {
+    public:
+        MissingSliceContext(std::size_t offset, std::size_t size)
+            : _data(new data::FrequencyTime<Cpu, T>(data::DimensionSize<data::Time>(128), data::DimensionSize<data::Frequency>(9)))
+            , _offset(offset)
+            , _size(size)
+        {
+            std::iota(_data->begin(), _data->end(), 1);
+        }
+
+        std::size_t offset() const { return _offset; }
+        std::size_t packet_offset() const { return 0; }
+        data::FrequencyTime<Cpu, T>& chunk() { return *_data; }
+        std::size_t size() const { return _size; }
+
+    private:
+        std::shared_ptr<data::FrequencyTime<Cpu, T>> _data;
+        std::size_t _offset;
+        std::size_t _size;
+};
+
+template<typename T>
+std::ostream& operator<<(std::ostream& os, MissingSliceContext<T> const&) { return os; }
+
 TEST_F(BeamFormerDataTraitsTest, test_deserialise)
 {
     // basic compile test
@@ -114,6 +142,112 @@ TEST_F(BeamFormerDataTraitsTest, test_deserialise)
 }
 
 
+TEST_F(BeamFormerDataTraitsTest, test_missing_packet_policy_from_string)
+{
+    for(auto const& name : rcpt::MissingPacketPolicy::available()) {
+        ASSERT_EQ(name, rcpt::MissingPacketPolicy::to_string(rcpt::MissingPacketPolicy::from_string(name)));
+    }
+    ASSERT_THROW(rcpt::MissingPacketPolicy::from_string("not_a_policy"), panda::Error);
+}
+
+TEST_F(BeamFormerDataTraitsTest, test_process_missing_slice_zero)
+{
+    typedef BeamFormerDataTraitsLow::DataType::value_type ValueType;
+    BeamFormerDataTraitsLow traits(rcpt::MissingPacketPolicy::Type::Zero);
+    MissingSliceContext<ValueType> context(128, 256);
+    traits.process_missing_slice(context);
+
+    auto it = context.chunk().begin();
+    for(std::size_t i=0; i < context.chunk().data_size(); ++i) {
+        if(i >= context.offset() && i < context.offset() + context.size()) {
+            ASSERT_EQ(0, *(it + i)) << i;
+        }
+        else {
+            ASSERT_EQ(static_cast<ValueType>(i + 1), *(it + i)) << i;
+        }
+    }
+}
+
+TEST_F(BeamFormerDataTraitsTest, test_process_missing_slice_last_good)
+{
+    typedef BeamFormerDataTraitsLow::DataType::value_type ValueType;
+    BeamFormerDataTraitsLow traits(rcpt::MissingPacketPolicy::Type::LastGood);
+    {
+        // missing slice larger than the available history : history is repeated
+        MissingSliceContext<ValueType> context(100, 250);
+        traits.process_missing_slice(context);
+        auto it = context.chunk().begin();
+        for(std::size_t i=0; i < context.size(); ++i) {
+            ASSERT_EQ(static_cast<ValueType>(i % context.offset() + 1), *(it + context.offset() + i)) << i;
+        }
+        ASSERT_EQ(static_cast<ValueType>(context.offset() + context.size() + 1), *(it + context.offset() + context.size()));
+    }
+    {
+        // no history : zero fill
+        MissingSliceContext<ValueType> context(0, 128);
+        traits.process_missing_slice(context);
+        auto it = context.chunk().begin();
+        for(std::size_t i=0; i < context.size(); ++i) {
+            ASSERT_EQ(0, *(it + i)) << i;
+        }
+    }
+}
+
+TEST_F(BeamFormerDataTraitsTest, test_process_missing_slice_noise)
+{
+    typedef BeamFormerDataTraitsLow::DataType::value_type ValueType;
+    BeamFormerDataTraitsLow traits(rcpt::MissingPacketPolicy::Type::Noise);
+    // the reference slice is the ramp 1..576 (mean 288.5, rms 166.3)
+    MissingSliceContext<ValueType> context(576, 576);
+    double reference_sum = 0.0;
+    double reference_sum_sq = 0.0;
+    for(auto it = context.chunk().begin(); it != context.chunk().begin() + context.offset(); ++it) {
+        reference_sum += *it;
+        reference_sum_sq += static_cast<double>(*it) * *it;
+    }
+    double const reference_mean = reference_sum / context.offset();
+    double const reference_variance = reference_sum_sq / context.offset() - reference_mean * reference_mean;
+
+    traits.process_missing_slice(context);
+
+    auto it = context.chunk().begin() + context.offset();
+    double sum = 0.0;
+    double sum_sq = 0.0;
+    for(std::size_t i=0; i < context.size(); ++i) {
+        sum += *(it + i);
+        sum_sq += static_cast<double>(*(it + i)) * *(it + i);
+    }
+    double const mean = sum / context.size();
+    double const variance = sum_sq / context.size() - mean * mean;
+    ASSERT_NEAR(reference_mean, mean, 0.1 * reference_mean);
+    ASSERT_NEAR(reference_variance, variance, 0.25 * reference_variance);
+
+    // the data before the missing slice is untouched
+    for(std::size_t i=0; i < context.offset(); ++i) {
+        ASSERT_EQ(static_cast<ValueType>(i + 1), *(context.chunk().begin() + i)) << i;
+    }
+}
+
+TEST_F(BeamFormerDataTraitsTest, test_missing_packet_policy_per_instance)
+{
+    // each stream owns its traits so the policies must not interfere
+    typedef BeamFormerDataTraitsLow::DataType::value_type ValueType;
+    BeamFormerDataTraitsLow zero_traits(rcpt::MissingPacketPolicy::Type::Zero);
+    BeamFormerDataTraitsLow last_good_traits(rcpt::MissingPacketPolicy::Type::LastGood);
+    ASSERT_EQ(rcpt::MissingPacketPolicy::Type::Zero, zero_traits.missing_packet_policy());
+    ASSERT_EQ(rcpt::MissingPacketPolicy::Type::LastGood, last_good_traits.missing_packet_policy());
+    ASSERT_EQ(rcpt::MissingPacketPolicy::Type::Zero, BeamFormerDataTraitsLow().missing_packet_policy());
+
+    MissingSliceContext<ValueType> zero_context(128, 128);
+    MissingSliceContext<ValueType> last_good_context(128, 128);
+    zero_traits.process_missing_slice(zero_context);
+    last_good_traits.process_missing_slice(last_good_context);
+    for(std::size_t i=0; i < 128; ++i) {
+        ASSERT_EQ(0, *(zero_context.chunk().begin() + 128 + i)) << i;
+        ASSERT_EQ(static_cast<ValueType>(i + 1), *(last_good_context.chunk().begin() + 128 + i)) << i;
+    }
+}
+
 } // namespace test
 } // namespace rcpt_low
 } // namespace producers
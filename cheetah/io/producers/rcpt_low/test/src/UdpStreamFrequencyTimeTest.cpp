@@ -32,6 +32,7 @@
 #include "panda/Engine.h"
 #include <algorithm>
 #include <deque>
+#include <iterator>
 #include <mutex>
 #include <iostream>
 #include <sstream>
@@ -216,6 +217,118 @@ TEST_F(UdpStreamFrequencyTimeTest, test_udp_packets_stream_data_consistency_chan
     test_udp_packets_stream_data_consistency<Packet>(128, 7776);
 }
 
+// every sample sent has the same value, so any data filled in by the stream is easy to spot
+struct ConstantModel {
+    public:
+        typedef data::FrequencyTime<Cpu, int8_t> DataType;
+        static constexpr int8_t value = 3;
+        static constexpr uint16_t intensity = 4 * value * value; // the value received for every sample sent
+
+        DataType& next(DataType& data) {
+            std::fill(data.begin(), data.end(), int8_t(value));
+            return data;
+        }
+};
+
+/**
+ * @brief stream several chunks, dropping packets on the way, and return the number of zero samples received
+ * @details each chunk is released before the next is requested so the stream has to recycle them
+ */
+std::size_t stream_with_missing_packets(rcpt::MissingPacketPolicy::Type policy)
+{
+    typedef ska::panda::Connection<ska::panda::ConnectionTraits<ska::panda::Udp>> ConnectionType;
+    std::size_t const number_of_channels = 128;
+    std::size_t const number_of_samples = 7776;
+    std::size_t const samples_per_packet = BeamFormerDataTraitsLow::packet_size();
+    std::size_t const packets_per_chunk = number_of_channels * number_of_samples / samples_per_packet;
+    std::size_t const number_of_chunks = 3;
+    std::size_t const drop_interval = 100; // not a factor of packets_per_chunk so the losses move through the chunks
+
+    panda::IpAddress address(0, "127.0.0.1");
+    rcpt_low::Config config;
+    config.spectra_per_chunk(number_of_samples);
+    config.number_of_channels(number_of_channels);
+    config.remote_end_point(address.end_point<boost::asio::ip::udp::endpoint>());
+    config.missing_packet_policy(policy);
+
+    rcpt_low::UdpStreamFrequencyTime stream(config);
+    ska::panda::DataManager<UdpStreamFrequencyTime> dm(stream);
+    ConstantModel model;
+    rcpt_low::PacketGeneratorConfig generator_config;
+    PacketGenerator<ConstantModel> generator(model, generator_config);
+    panda::Engine& engine = config.engine();
+    ConnectionType connection(engine);
+    connection.set_remote_end_point(stream.local_end_point());
+    engine.poll();
+
+    // one chunk more than we read so the last chunk read is complete
+    unsigned sent_count = 0U;
+    unsigned received_count = 0U;
+    for(std::size_t packet=0; packet < (number_of_chunks + 1) * packets_per_chunk; ++packet)
+    {
+        if(packet % drop_interval == drop_interval - 1) {
+            generator.next(); // lost in transit
+            continue;
+        }
+        ++sent_count;
+        connection.send(generator.next(), [&](ska::panda::Error e) {
+                EXPECT_FALSE(e);
+                ++received_count;
+                });
+        engine.poll_one();
+    }
+    unsigned max_attempts = 10000;
+    while(received_count < sent_count) {
+        engine.poll_one();
+        if(--max_attempts == 0) {
+            ADD_FAILURE() << "time out: expected packets not received";
+            return 0;
+        }
+    }
+
+    uint16_t const expected = ConstantModel::intensity;
+    std::size_t number_of_zeros = 0;
+    for(std::size_t chunk_index=0; chunk_index < number_of_chunks; ++chunk_index)
+    {
+        SCOPED_TRACE(chunk_index);
+        auto chunk = std::get<0>(dm.next());
+        EXPECT_EQ(number_of_samples, chunk->number_of_spectra());
+        EXPECT_EQ(number_of_channels, chunk->number_of_channels());
+        EXPECT_DOUBLE_EQ(350.0, static_cast<boost::units::quantity<data::MegaHertz, double>>(chunk->low_high_frequencies().second).value());
+
+        // a sample is either received or filled: zero (zero policy, or no preceding data to fill from) or the constant
+        for(auto it = chunk->cbegin(); it != chunk->cend(); ++it)
+        {
+            if(*it == 0) {
+                ++number_of_zeros;
+                continue;
+            }
+            EXPECT_EQ(expected, *it) << "sample " << std::distance(chunk->cbegin(), it);
+            if(*it != expected) break;
+        }
+        // the chunk is released here so the stream can reuse it for a later chunk
+    }
+    return number_of_zeros;
+}
+
+TEST_F(UdpStreamFrequencyTimeTest, test_missing_packets_zero_policy)
+{
+    // each lost packet leaves a zero slice in a recycled chunk
+    ASSERT_GE(stream_with_missing_packets(rcpt::MissingPacketPolicy::Type::Zero), BeamFormerDataTraitsLow::packet_size());
+}
+
+TEST_F(UdpStreamFrequencyTimeTest, test_missing_packets_last_good_policy)
+{
+    // the slice preceding a lost packet is replicated, so only leading gaps can be zero
+    ASSERT_GT(3 * BeamFormerDataTraitsLow::packet_size(), stream_with_missing_packets(rcpt::MissingPacketPolicy::Type::LastGood));
+}
+
+TEST_F(UdpStreamFrequencyTimeTest, test_missing_packets_noise_policy)
+{
+    // the data is constant so the noise (mean and rms of the preceding slice) is the constant itself
+    ASSERT_GT(3 * BeamFormerDataTraitsLow::packet_size(), stream_with_missing_packets(rcpt::MissingPacketPolicy::Type::Noise));
+}
+
 } // namespace test
 } // namespace rcpt_low
 } // namespace producers
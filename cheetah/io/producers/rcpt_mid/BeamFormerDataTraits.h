@@ -26,6 +26,7 @@
 
 #include "ska/cbf_psr_interface/CbfPsrPacket.h"
 #include "cheetah/io/producers/rcpt_mid/BeamFormerPacketInspector.h"
+#include "cheetah/io/producers/rcpt/MissingPacketPolicy.h"
 #include "cheetah/data/FrequencyTime.h"
 
 
@@ -54,7 +55,10 @@ class BeamFormerDataTraits
         static constexpr std::size_t contexts_per_block = 10;
 
     public:
-        BeamFormerDataTraits();
+        /**
+         * @param policy how to fill the data lost with missing packets on the stream using these traits
+         */
+        BeamFormerDataTraits(rcpt::MissingPacketPolicy::Type policy = rcpt::MissingPacketPolicy::Type::Zero);
         ~BeamFormerDataTraits();
 
         /**
@@ -103,16 +107,31 @@ class BeamFormerDataTraits
 
         /**
          * @brief perform operations to compenste for a missing packet
-         * @details currently this does nothing, but this is expected to change
+         * @details the missing slice is filled according to the missing_packet_policy()
          */
         template<typename ContextType>
-        static void process_missing_slice(ContextType& context);
+        void process_missing_slice(ContextType& context) const;
 
         /**
          * @brief estimates the missing packets
          */
         static void packet_stats(uint64_t packets_received, uint64_t packets_expected);
 
+        /**
+         * @brief set the policy to use to fill data lost with missing packets
+         * @details each stream has its own traits instance and so its own policy.
+         *          Not thread safe: set it before the stream is started.
+         */
+        void missing_packet_policy(rcpt::MissingPacketPolicy::Type policy);
+
+        /**
+         * @brief the policy used to fill data lost with missing packets
+         */
+        rcpt::MissingPacketPolicy::Type missing_packet_policy() const;
+
+    private:
+        rcpt::MissingPacketPolicy::Type _missing_packet_policy;
+
 };
 
 typedef BeamFormerDataTraits<PssMidTraits> BeamFormerDataTraitsMid;
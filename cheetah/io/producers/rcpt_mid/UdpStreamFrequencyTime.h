@@ -26,6 +26,7 @@
 
 #include "cheetah/io/producers/rcpt_mid/Config.h"
 #include "cheetah/io/producers/rcpt_mid/BeamFormerDataTraits.h"
+#include "cheetah/data/TimeFrequencyMetadata.h"
 #include "cheetah/utils/ModifiedJulianClock.h"
 #include <panda/PacketStream.h>
 #include <panda/ResourceManager.h>
@@ -76,6 +77,12 @@ class UdpStreamFrequencyTimeTmpl : public panda::PacketStream<UdpStreamFrequency
         template<typename DataType>
         std::shared_ptr<DataType> get_chunk(unsigned sequence_number, PacketInspector const& p);
 
+    private:
+        /**
+         * @brief regenerate the cached chunk metadata if the stream configuration has changed
+         */
+        void update_metadata(PacketInspector const& packet);
+
     private:
         data::DimensionSize<data::Frequency> _n_channels;
         data::DimensionSize<data::Time> _n_samples;
@@ -83,6 +90,10 @@ class UdpStreamFrequencyTimeTmpl : public panda::PacketStream<UdpStreamFrequency
         unsigned _n_channels_per_packet;
         TsampType _tsamp;
         static ska::cheetah::utils::ModifiedJulianClock::time_point _tstart;
+        bool _metadata_valid;
+        uint64_t _first_channel_frequency;
+        uint32_t _channel_separation;
+        data::TimeFrequencyMetadata _metadata;
 };
 
 class UdpStreamFrequencyTime : public UdpStreamFrequencyTimeTmpl<UdpStreamFrequencyTime>
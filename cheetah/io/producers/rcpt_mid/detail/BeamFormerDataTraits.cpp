@@ -33,7 +33,8 @@ namespace producers {
 namespace rcpt_mid {
 
 template<class Traits>
-BeamFormerDataTraits<Traits>::BeamFormerDataTraits()
+BeamFormerDataTraits<Traits>::BeamFormerDataTraits(rcpt::MissingPacketPolicy::Type policy)
+    : _missing_packet_policy(policy)
 {
 }
 
@@ -93,17 +94,23 @@ void BeamFormerDataTraits<Traits>::deserialise_packet(ContextType& context, Pack
 
 template<class Traits>
 template<typename ContextType>
-void BeamFormerDataTraits<Traits>::process_missing_slice(ContextType& context)
+void BeamFormerDataTraits<Traits>::process_missing_slice(ContextType& context) const
 {
-    //essentially replacing the data corresponding to the missing packet to 0. (Dont know what is the best approch here.)
-    unsigned offset = context.offset();
-    auto it=context.chunk().begin() + offset;
-    PANDA_LOG_DEBUG << "processing missing packet: data=" << (void*)&*it << context;
-    for(std::size_t i=0; i < context.size() ; ++i) {
-        *it = 0;
-        assert(it!=context.chunk().end());
-        ++it;
-    }
+    PANDA_LOG_DEBUG << "processing missing packet: data=" << (void*)&*(context.chunk().begin() + context.offset()) << context;
+    assert(context.offset() + context.size() <= chunk_size(context.chunk()));
+    rcpt::MissingPacketPolicy::fill(_missing_packet_policy, context.chunk().begin(), context.offset(), context.size());
+}
+
+template<class Traits>
+void BeamFormerDataTraits<Traits>::missing_packet_policy(rcpt::MissingPacketPolicy::Type policy)
+{
+    _missing_packet_policy = policy;
+}
+
+template<class Traits>
+rcpt::MissingPacketPolicy::Type BeamFormerDataTraits<Traits>::missing_packet_policy() const
+{
+    return _missing_packet_policy;
 }
 
 template<class Traits>
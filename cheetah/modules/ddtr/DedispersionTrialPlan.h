@@ -27,11 +27,13 @@
 
 #include "cheetah/utils/Config.h"
 #include "cheetah/modules/ddtr/DedispersionConfig.h"
+#include "cheetah/modules/ddtr/DownsamplingPlan.h"
 #include "cheetah/data/DedispersionMeasure.h"
 #include "cheetah/data/DmConstant.h"
 #include "cheetah/data/DmTrialsMetadata.h"
 #include "cheetah/data/TimeFrequency.h"
 #include "cheetah/data/Units.h"
+#include "cheetah/utils/HugePageAllocator.h"
 #include <vector>
 #include <string>
 
@@ -92,6 +94,41 @@ class DedispersionTrialPlan : public utils::Config
         */
         std::shared_ptr<data::DmTrialsMetadata> generate_dmtrials_metadata(TimeType sample_interval, std::size_t nspectra, std::size_t nsamples) const;
 
+        /**
+         * @brief Generate metadata with the downsampling factors of the DownsamplingPlan provided
+         * @throw Error if size of DM overlap region exceeds number of spectra
+         *        or the plan does not match the number of DM ranges
+         */
+        std::shared_ptr<data::DmTrialsMetadata> generate_dmtrials_metadata(TimeType sample_interval, std::size_t nspectra, std::size_t nsamples, DownsamplingPlan const& downsampling) const;
+
+        /**
+         * @brief the downsampling factors to apply to each DM range
+         * @details with adaptive_downsampling off this is the fixed factor of 2 per range.
+         *          Otherwise the factors are matched to the smearing expected in each range for the data provided.
+         * @param number_of_samples if non zero the factors will be restricted to exact divisors of this value
+         */
+        DownsamplingPlan downsampling_plan(TimeType sample_interval, FrequencyType freq_low, FrequencyType freq_high, std::size_t number_of_channels, std::size_t number_of_samples = 0) const;
+
+        /**
+         * @brief true if the downsampling factors should be matched to the smearing in each DM range
+         */
+        bool adaptive_downsampling() const;
+
+        /**
+         * @brief set to use downsampling factors matched to the smearing in each DM range
+         */
+        void adaptive_downsampling(bool);
+
+        /**
+         * @brief the fraction of the expected smearing the downsampled sample interval is allowed to reach
+         */
+        double downsampling_tolerance() const;
+
+        /**
+         * @brief set the fraction of the expected smearing the downsampled sample interval is allowed to reach
+         */
+        void downsampling_tolerance(double);
+
         /**
          * @brief list of Dm trials and downsample factor pairs
          */
@@ -130,6 +167,61 @@ class DedispersionTrialPlan : public utils::Config
          */
         void dedispersion_samples(std::size_t);
 
+        /**
+         * @brief the number of dedispersed chunks that may be in flight downstream (e.g. in spdt) at once
+         * @details algorithms preallocate this many DmTrials objects so that the dedispersion of
+         *          the next chunk can overlap the processing of earlier ones. Once all are in flight
+         *          the dedispersion of the next chunk waits for one to be released.
+         */
+        std::size_t pipeline_depth() const;
+
+        /**
+         * @brief set the number of dedispersed chunks that may be in flight at once
+         */
+        void pipeline_depth(std::size_t);
+
+        /**
+         * @brief the page size policy for the buffers that aggregate the incoming data for dedispersion
+         */
+        utils::HugePagePolicy aggregation_buffer_pages() const;
+
+        /**
+         * @brief set the page size policy for the aggregation buffers
+         */
+        void aggregation_buffer_pages(utils::HugePagePolicy);
+
+        /**
+         * @brief the minimum number of aggregation buffers laid out along a shared ring (0 = ring mode off)
+         * @details in ring mode consecutive buffers share their overlap in place rather than copying it
+         */
+        std::size_t aggregation_ring_depth() const;
+
+        /**
+         * @brief set the minimum number of aggregation buffers laid out along a shared ring (0 = ring mode off)
+         */
+        void aggregation_ring_depth(std::size_t);
+
+        /**
+         * @brief the number of threads used to corner turn the incoming data into the aggregation buffers
+         */
+        unsigned corner_turn_threads() const;
+
+        /**
+         * @brief set the number of threads used to corner turn the incoming data into the aggregation buffers
+         */
+        void corner_turn_threads(unsigned);
+
+        /**
+         * @brief true if the corner turn of the incoming data is deferred until the dedisperser reads the buffer
+         * @details see AggregationBufferFiller::defer_corner_turn
+         */
+        bool defer_corner_turn() const;
+
+        /**
+         * @brief defer the corner turn of the incoming data until the dedisperser reads the buffer
+         */
+        void defer_corner_turn(bool);
+
         /**
          * @brief vector consisting of number of dms per range
          */
@@ -144,6 +236,13 @@ class DedispersionTrialPlan : public utils::Config
         mutable std::vector<std::size_t> _number_of_dms;
         mutable Dm              _max_dm;
         std::size_t             _dedispersion_samples;
+        std::size_t             _pipeline_depth;
+        utils::HugePagePolicy   _aggregation_buffer_pages;
+        std::size_t             _aggregation_ring_depth;
+        unsigned                _corner_turn_threads;
+        bool                    _defer_corner_turn;
+        bool                    _adaptive_downsampling;
+        double                  _downsampling_tolerance;
 };
 
 
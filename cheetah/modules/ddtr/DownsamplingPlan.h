@@ -0,0 +1,117 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_MODULES_DDTR_DOWNSAMPLINGPLAN_H
+#define SKA_CHEETAH_MODULES_DDTR_DOWNSAMPLINGPLAN_H
+
+#include <vector>
+#include <cstddef>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+
+/**
+ * @brief The time downsampling factor to apply to the data before dedispersing each DM range
+ * @details Once the dispersion smearing across a channel, together with the smearing from
+ *          the DM step, exceeds the sample interval the extra time resolution is wasted work.
+ *          The adaptive plan chooses, for each range, the largest factor that keeps the sample
+ *          interval within tolerance * smearing (evaluated at the start of the range).
+ *
+ *          Factors need not be powers of two but each is a multiple of the one before it so that
+ *          every level of the resulting pyramid can be generated from the level above it. If a
+ *          number_of_samples is given all factors will divide it exactly.
+ */
+
+class DownsamplingPlan
+{
+    public:
+        /**
+         * @brief a DM range (in pc/cm^3)
+         */
+        struct Range
+        {
+            double dm_start;
+            double dm_end;
+            double dm_step;
+        };
+
+    public:
+        /**
+         * @brief the fixed plan: a factor of 2 between each consecutive range
+         */
+        explicit DownsamplingPlan(std::size_t number_of_ranges);
+
+        /**
+         * @brief a plan adapted to the smearing expected in each range
+         * @param sample_interval  the undownsampled sample interval (s)
+         * @param freq_low         the lowest frequency of the band (MHz)
+         * @param freq_high        the highest frequency of the band (MHz)
+         * @param dm_constant      the dispersion constant (s MHz^2 cm^3/pc)
+         * @param tolerance        the fraction of the smearing the downsampled interval may reach
+         * @param number_of_samples if non zero, all factors are restricted to exact divisors of this value
+         */
+        DownsamplingPlan(double sample_interval
+                        , double freq_low
+                        , double freq_high
+                        , std::size_t number_of_channels
+                        , std::vector<Range> const& ranges
+                        , double dm_constant
+                        , double tolerance = 1.0
+                        , std::size_t number_of_samples = 0
+                        );
+
+        /**
+         * @brief the number of ranges in the plan
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief the downsampling factor of each range relative to the input data
+         */
+        std::vector<unsigned> const& factors() const;
+        unsigned factor(std::size_t range) const;
+
+        /**
+         * @brief the factor required to generate the data for range from that of the previous range
+         * @details always 1 when the range can reuse the data of the previous range
+         */
+        unsigned relative_factor(std::size_t range) const;
+
+        /**
+         * @brief the estimated smearing (s) at the start of the range (0 for the fixed plan)
+         */
+        double smearing(std::size_t range) const;
+
+    private:
+        std::vector<unsigned> _factors;
+        std::vector<double> _smearing;
+};
+
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_MODULES_DDTR_DOWNSAMPLINGPLAN_H
@@ -27,6 +27,7 @@
 #include "cheetah/modules/ddtr/cpu/DedispersionPlan.h"
 #include "cheetah/data/FrequencyTime.h"
 #include "cheetah/data/DmTrials.h"
+#include "cheetah/modules/ddtr/DownsamplingPlan.h"
 #include <vector>
 
 namespace ska {
@@ -39,6 +40,9 @@ namespace cpu {
  * @brief Processing object where each dm_range is dedispersed
  * @details This object must have a ++ operator to process the FT block.
  * This fills the Dm_trials object with the dedispersed data.
+ * The input data is left untouched: each distinct downsampling factor in the plan
+ * gets its own level of a pyramid built on construction, so that each range reads
+ * directly from its own level, independently of the ranges before it.
  */
 
 template<typename DdtrTraits>
@@ -79,16 +83,35 @@ class DdtrProcessor
         data::DimensionIndex<data::Time> const& processed_samples() const;
 
     private:
+        struct Level
+        {
+            unsigned factor;
+            std::size_t offset; // into the _pyramid
+            std::size_t stride; // samples per channel
+        };
+
         /**
-         * @details Downsample the TimeFrequency data by a factor of 2
-         *
+         * @details generate the downsampled level for each dm range from the level of the previous range
+         */
+        void build_pyramid();
+
+        /**
+         * @details average each factor samples of the source into one sample of the destination
+         */
+        void downsample_data(NumericalRep const* source, NumericalRep* destination, std::size_t number_of_samples, unsigned factor) const;
+
+        /**
+         * @return the start of the channel data in the level
          */
-        void downsample_data();
+        NumericalRep const* level_data(Level const& level, std::size_t channel) const;
 
     private:
         std::shared_ptr<DedispersionPlanType>  _plan;
         BufferType& _ft_data;
         std::shared_ptr<DmTrialsType> _dm_trials_ptr;
+        std::shared_ptr<DownsamplingPlan const> _downsampling;
+        std::vector<Level> _levels;
+        std::vector<NumericalRep> _pyramid;
         std::size_t _current_dm_range;
         std::size_t _current_dm_idx;
 };
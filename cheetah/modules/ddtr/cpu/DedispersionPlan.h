@@ -28,6 +28,7 @@
 #include "cheetah/data/TimeFrequency.h"
 #include "cheetah/modules/ddtr/detail/AggregationBuffer.h"
 #include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/modules/ddtr/DownsamplingPlan.h"
 #include "cheetah/modules/ddtr/cpu/Config.h"
 
 namespace ska {
@@ -102,6 +103,11 @@ class DedispersionPlan
          */
         std::vector<double> const& dm_factors() const;
 
+        /**
+         * @brief return the downsampling factors for each dm range, consistent with the current dm_trials_metadata
+         */
+        std::shared_ptr<DownsamplingPlan const> const& downsampling_plan() const;
+
         /**
          * @brief return a DmTrialsMetadata block consistent with the plan and the incoming data parameters
          */
@@ -113,13 +119,16 @@ class DedispersionPlan
         ConfigType const& algo_config() const;
 
     protected:
-        std::shared_ptr<data::DmTrialsMetadata> generate_dmtrials_metadata(TimeType sample_interval, data::DimensionSize<data::Time> nspectra, std::size_t nsamples) const;
+        std::shared_ptr<data::DmTrialsMetadata> generate_dmtrials_metadata(TimeType sample_interval, data::DimensionSize<data::Time> nspectra, std::size_t nsamples);
 
     private:
         std::shared_ptr<DedispersionStrategyType> _strategy;
         ConfigType const& _algo_config;
         std::size_t _memory;
         std::shared_ptr<data::DmTrialsMetadata> _dm_trial_metadata;
+        std::shared_ptr<DownsamplingPlan const> _downsampling_plan;
+        std::pair<FrequencyType, FrequencyType> _low_high_frequencies;
+        std::size_t _number_of_channels;
 };
 
 } // namespace cpu
@@ -39,9 +39,11 @@ DdtrProcessor<DdtrTraits>::DdtrProcessor(std::shared_ptr<DedispersionPlanType> p
     : _plan(plan)
     , _ft_data(data)
     , _dm_trials_ptr(dm_trials_ptr)
+    , _downsampling(plan->downsampling_plan())
     , _current_dm_range(0)
     , _current_dm_idx(0)
 {
+    build_pyramid();
 }
 
 template<typename DdtrTraits>
@@ -57,50 +59,83 @@ std::size_t const& DdtrProcessor<DdtrTraits>::current_dm_range() const
 }
 
 template<typename DdtrTraits>
-void DdtrProcessor<DdtrTraits>::downsample_data()
+void DdtrProcessor<DdtrTraits>::build_pyramid()
 {
-    NumericalRep* ft_data = &*_ft_data.begin();
+    std::size_t const number_of_channels = _ft_data.number_of_channels();
+    std::size_t const number_of_spectra = _ft_data.number_of_spectra();
 
-    for(unsigned channel=0; channel<_ft_data.number_of_channels(); ++channel)
+    // the input data itself is the top level
+    Level level{1, 0, number_of_spectra};
+    std::size_t pyramid_size = 0;
+    for(std::size_t range = 0; range < _downsampling->size(); ++range)
     {
-        for(unsigned sample=0; sample<_ft_data.number_of_spectra()/2; ++sample)
+        unsigned factor = _downsampling->factor(range);
+        if(factor != level.factor) {
+            level = Level{factor, pyramid_size, number_of_spectra/factor};
+            pyramid_size += level.stride * number_of_channels;
+        }
+        _levels.push_back(level);
+    }
+
+    _pyramid.resize(pyramid_size);
+    for(std::size_t range = 0; range < _levels.size(); ++range)
+    {
+        Level const& current = _levels[range];
+        if(current.factor == 1 || (range != 0 && current.factor == _levels[range - 1].factor)) continue;
+        Level const source = (range == 0) ? Level{1, 0, number_of_spectra} : _levels[range - 1];
+        for(std::size_t channel = 0; channel < number_of_channels; ++channel)
         {
-            unsigned element_idx = channel*_ft_data.number_of_spectra()+2*sample;
-            double temp = (double)(ft_data[element_idx]) + (double)(ft_data[element_idx+1]);
-            temp /= 2;
-            ft_data[channel*_ft_data.number_of_spectra()+sample] = (NumericalRep)temp;
+            downsample_data(level_data(source, channel)
+                           , _pyramid.data() + current.offset + channel * current.stride
+                           , current.stride
+                           , current.factor/source.factor);
         }
     }
 }
 
 template<typename DdtrTraits>
-DdtrProcessor<DdtrTraits>& DdtrProcessor<DdtrTraits>::operator++()
+void DdtrProcessor<DdtrTraits>::downsample_data(NumericalRep const* source, NumericalRep* destination, std::size_t number_of_samples, unsigned factor) const
 {
-    if(_current_dm_range!=0)
+    for(std::size_t sample=0; sample < number_of_samples; ++sample)
     {
-        downsample_data();
+        double temp = 0.0;
+        for(unsigned i=0; i < factor; ++i)
+        {
+            temp += (double)(*source++);
+        }
+        temp /= factor;
+        destination[sample] = (NumericalRep)temp;
     }
+}
 
+template<typename DdtrTraits>
+typename DdtrProcessor<DdtrTraits>::NumericalRep const* DdtrProcessor<DdtrTraits>::level_data(Level const& level, std::size_t channel) const
+{
+    if(level.factor == 1) return &*_ft_data.cbegin(channel);
+    return _pyramid.data() + level.offset + channel * level.stride;
+}
+
+template<typename DdtrTraits>
+DdtrProcessor<DdtrTraits>& DdtrProcessor<DdtrTraits>::operator++()
+{
     DmTrialsType& dmtrials = *(_dm_trials_ptr);
 
     auto const& plan_dm_trials = _plan->algo_config().dm_trials();
     auto const& plan_dm_factors = _plan->dm_factors();
+    Level const& level = _levels[_current_dm_range];
 
     for (std::size_t dm_idx = _current_dm_idx; dm_idx < _current_dm_idx+_plan->algo_config().number_of_dms()[_current_dm_range]; ++dm_idx)
     {
         auto& current_trial = dmtrials[dm_idx];
         std::fill(current_trial.begin(), current_trial.end(), 0);
         auto const& plan_dm_trial = plan_dm_trials[dm_idx].first.value();
-        auto const& downsampling_factor = plan_dm_trials[dm_idx].second;
         for (std::size_t chan_idx=0; chan_idx < _ft_data.number_of_channels(); ++chan_idx)
         {
-            std::size_t delay = static_cast<std::size_t>(plan_dm_factors[chan_idx] * plan_dm_trial/downsampling_factor);
-            std::size_t shift = chan_idx*_ft_data.number_of_spectra();
+            std::size_t delay = static_cast<std::size_t>(plan_dm_factors[chan_idx] * plan_dm_trial/level.factor);
             std::transform (current_trial.begin(), current_trial.end()
-                           , _ft_data.begin()+shift+delay, current_trial.begin(), [&](float x, NumericalRep y){return ((float)x+y);});
+                           , level_data(level, chan_idx) + delay, current_trial.begin(), [&](float x, NumericalRep y){return ((float)x+y);});
         }
         std::transform(current_trial.begin(), current_trial.end(), current_trial.begin(), [&](float x){return x/_ft_data.number_of_channels();});
-        //std::cout<<"max_value "<<(int)(*std::max_element(current_trial.begin(), current_trial.end()))<<"\n";
     }
     _current_dm_idx += _plan->algo_config().number_of_dms()[_current_dm_range];
     ++_current_dm_range;
@@ -33,6 +33,7 @@ template <typename DdtrTraits>
 DedispersionPlan<DdtrTraits>::DedispersionPlan(BeamConfigType const& , ConfigType const& config, std::size_t memory)
     : _algo_config(config)
     , _memory(memory)
+    , _number_of_channels(0)
 {
     if(config.dm_trials().size()==0)
     {
@@ -50,6 +51,9 @@ template <typename DataType>
 data::DimensionSize<data::Time> DedispersionPlan<DdtrTraits>::reset(DataType const& data)
 {
     _strategy = std::make_shared<DedispersionStrategy<DdtrTraits>>(data, _algo_config, _memory);
+    // the adaptive downsampling plan depends on the band of the incoming data
+    _low_high_frequencies = data.low_high_frequencies();
+    _number_of_channels = data.number_of_channels();
     _dm_trial_metadata = this->generate_dmtrials_metadata(data.sample_interval(), _strategy->number_of_spectra(), _strategy->buffer_overlap());
 
     return _strategy->number_of_spectra();
@@ -86,9 +90,24 @@ data::DimensionSize<data::Time> DedispersionPlan<DdtrTraits>::number_of_spectra(
 }
 
 template <typename DdtrTraits>
-std::shared_ptr<data::DmTrialsMetadata> DedispersionPlan<DdtrTraits>::generate_dmtrials_metadata(typename DedispersionPlan<DdtrTraits>::TimeType sample_interval, data::DimensionSize<data::Time> nspectra, std::size_t nsamples) const
+std::shared_ptr<DownsamplingPlan const> const& DedispersionPlan<DdtrTraits>::downsampling_plan() const
 {
-    return _algo_config.generate_dmtrials_metadata(sample_interval, nspectra, nsamples);
+    return _downsampling_plan;
+}
+
+template <typename DdtrTraits>
+std::shared_ptr<data::DmTrialsMetadata> DedispersionPlan<DdtrTraits>::generate_dmtrials_metadata(typename DedispersionPlan<DdtrTraits>::TimeType sample_interval, data::DimensionSize<data::Time> nspectra, std::size_t nsamples)
+{
+    // the factors must divide the number of dedispersed samples exactly
+    std::size_t const spectra = nspectra;
+    std::size_t const output_samples = (spectra > nsamples) ? spectra - nsamples : 0;
+    _downsampling_plan = std::make_shared<DownsamplingPlan const>(
+                            _algo_config.downsampling_plan(sample_interval
+                                                          , _low_high_frequencies.first
+                                                          , _low_high_frequencies.second
+                                                          , _number_of_channels
+                                                          , output_samples));
+    return _algo_config.generate_dmtrials_metadata(sample_interval, nspectra, nsamples, *_downsampling_plan);
 }
 
 template <typename DdtrTraits>
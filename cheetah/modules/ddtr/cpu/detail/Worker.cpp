@@ -47,6 +47,15 @@ std::shared_ptr<typename Worker<DdtrTraits>::DmTrialsType> Worker<DdtrTraits>::o
     //auto const& data = buffer.buffer();
     //FrequencyTimeType data_copy(data);
     //std::size_t nchans = data.number_of_channels();
+    if(data->deferred_corner_turn())
+    {
+        // we read the buffer by channel, so it must be corner turned first
+        auto contiguous = std::make_shared<BufferType>(data->number_of_spectra(), data->number_of_channels());
+        contiguous->metadata(data->metadata());
+        contiguous->corner_turn_pool(data->corner_turn_pool());
+        data->transfer(data->number_of_spectra(), *contiguous);
+        data = std::move(contiguous);
+    }
     plan->reset(*data);
     auto dm_trial_metadata = plan->dm_trials_metadata(data->metadata(), pss::astrotypes::DimensionSize<pss::astrotypes::units::Time>(data->number_of_spectra()-plan->buffer_overlap()));
     std::shared_ptr<DmTrialsType> dmtrials_ptr = DmTrialsType::make_shared(dm_trial_metadata, data->start_time());
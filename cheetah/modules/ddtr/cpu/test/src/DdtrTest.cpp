@@ -46,6 +46,18 @@ struct DdtrCpuTraits : public ddtr::test::DdtrTesterTraits<ddtr::cpu::Ddtr, Nume
         std::vector<std::unique_ptr<ddtr::DedispersionConfig>> _configs; // keep configs in scope
 };
 
+/**
+ * @brief run the generic tests with the downsampling of each dm range matched to its smearing
+ */
+template <typename NumericalT>
+struct DdtrCpuAdaptiveDownsamplingTraits : public DdtrCpuTraits<NumericalT>
+{
+    void configure(ddtr::Config& config) override {
+        DdtrCpuTraits<NumericalT>::configure(config);
+        config.adaptive_downsampling(true);
+    }
+};
+
 } // namespace test
 } // namespace cpu
 } // namespace ddtr
@@ -59,7 +71,7 @@ namespace modules {
 namespace ddtr {
 namespace test {
 
-typedef ::testing::Types<ddtr::cpu::test::DdtrCpuTraits<uint8_t>> DdtrCpuTraitsTypes;
+typedef ::testing::Types<ddtr::cpu::test::DdtrCpuTraits<uint8_t>, ddtr::cpu::test::DdtrCpuAdaptiveDownsamplingTraits<uint8_t>> DdtrCpuTraitsTypes;
 INSTANTIATE_TYPED_TEST_SUITE_P(Cpu, DdtrTester, DdtrCpuTraitsTypes);
 
 } // namespace test
@@ -0,0 +1,136 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/cpu/test/DedispersionPlanTest.h"
+#include "cheetah/modules/ddtr/cpu/DedispersionPlan.h"
+#include "cheetah/modules/ddtr/detail/CommonTypes.h"
+#include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/data/TimeFrequency.h"
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+namespace cpu {
+namespace test {
+
+
+DedispersionPlanTest::DedispersionPlanTest()
+    : ::testing::Test()
+{
+}
+
+DedispersionPlanTest::~DedispersionPlanTest()
+{
+}
+
+void DedispersionPlanTest::SetUp()
+{
+}
+
+void DedispersionPlanTest::TearDown()
+{
+}
+
+namespace {
+
+typedef ddtr::CommonTypes<ddtr::Config, uint8_t> DdtrTraits;
+typedef DedispersionPlan<DdtrTraits> DedispersionPlanType;
+typedef DdtrTraits::TimeFrequencyType TimeFrequencyType;
+typedef ddtr::Config::Dm Dm;
+
+void add_dm_ranges(ddtr::Config& config)
+{
+    config.add_dm_range(Dm(0.0 * data::parsecs_per_cube_cm), Dm(100.0 * data::parsecs_per_cube_cm), Dm(1.0 * data::parsecs_per_cube_cm));
+    config.add_dm_range(Dm(100.0 * data::parsecs_per_cube_cm), Dm(500.0 * data::parsecs_per_cube_cm), Dm(5.0 * data::parsecs_per_cube_cm));
+    config.add_dm_range(Dm(500.0 * data::parsecs_per_cube_cm), Dm(2000.0 * data::parsecs_per_cube_cm), Dm(10.0 * data::parsecs_per_cube_cm));
+    config.dedispersion_samples(1<<17);
+}
+
+TimeFrequencyType test_data()
+{
+    TimeFrequencyType data(data::DimensionSize<data::Time>(1), data::DimensionSize<data::Frequency>(1024));
+    data.sample_interval(TimeFrequencyType::TimeType(64.0 * boost::units::si::micro * boost::units::si::seconds));
+    data.set_channel_frequencies_const_width(data::FrequencyType(1700.0 * data::megahertz), data::FrequencyType(-300.0/1024.0 * data::megahertz));
+    return data;
+}
+
+// the index of the configured range containing the trial dm
+std::size_t range_index(double dm)
+{
+    if(dm < 100.0) return 0;
+    if(dm < 500.0) return 1;
+    return 2;
+}
+
+} // namespace
+
+TEST_F(DedispersionPlanTest, test_adaptive_downsampling_plan)
+{
+    ddtr::Config config;
+    add_dm_ranges(config);
+    config.adaptive_downsampling(true);
+    DdtrTraits::BeamConfigType beam_config;
+    DedispersionPlanType plan(beam_config, config, 1<<30);
+
+    TimeFrequencyType const data = test_data();
+    data::DimensionSize<data::Time> const spectra = plan.reset(data);
+    std::size_t const output_samples = spectra - plan.buffer_overlap();
+
+    // the plan must be built from the band of the incoming data
+    auto const low_high = data.low_high_frequencies();
+    DownsamplingPlan const expected = config.downsampling_plan(data.sample_interval(), low_high.first, low_high.second
+                                                              , data.number_of_channels(), output_samples);
+    ASSERT_GT(expected.factor(2), 1U); // make sure this is a meaningful test
+    ASSERT_TRUE(plan.downsampling_plan());
+    ASSERT_EQ(expected.factors(), plan.downsampling_plan()->factors());
+
+    // each trial carries the factor of its range
+    auto const metadata = plan.dm_trials_metadata(data.metadata(), spectra);
+    ASSERT_EQ(config.dm_trials().size(), metadata->size());
+    for(std::size_t trial = 0; trial < metadata->size(); ++trial) {
+        auto const& trial_metadata = (*metadata)[trial];
+        ASSERT_EQ(expected.factor(range_index(trial_metadata.dm().value())), trial_metadata.downsampling_factor()) << "trial " << trial;
+        ASSERT_EQ(0U, output_samples % trial_metadata.downsampling_factor());
+    }
+}
+
+TEST_F(DedispersionPlanTest, test_fixed_downsampling_plan)
+{
+    ddtr::Config config;
+    add_dm_ranges(config);
+    DdtrTraits::BeamConfigType beam_config;
+    DedispersionPlanType plan(beam_config, config, 1<<30);
+
+    plan.reset(test_data());
+    ASSERT_TRUE(plan.downsampling_plan());
+    std::vector<unsigned> const expected = { 1, 2, 4 };
+    ASSERT_EQ(expected, plan.downsampling_plan()->factors());
+}
+
+} // namespace test
+} // namespace cpu
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
@@ -23,6 +23,8 @@
  */
 
 //#include "panda/AggregationBuffer.h"
+#include "cheetah/corner_turn/CornerTurn.h"
+#include "panda/Error.h"
 #include "panda/Log.h"
 #include "panda/Copy.h"
 #include <cstring>
@@ -37,41 +39,84 @@ namespace ddtr {
 
 template<typename NumericalRep>
 AggregationBuffer<NumericalRep>::AggregationBuffer()
-    : _buffer(std::make_unique<std::vector<NumericalRep>>(0))
+    : _buffer(std::make_shared<StorageType>(0))
+    , _offset(0)
     , _time_stride(1)
     , _frequency_stride(0)
     , _number_of_spectra(0)
     , _number_of_channels(0)
     , _current_time(0)
+    , _corner_turn_pool(std::make_shared<utils::WorkerPool>())
+    , _deferred(false)
 {
 }
 
 template<typename NumericalRep>
-AggregationBuffer<NumericalRep>::AggregationBuffer(std::size_t number_of_spectra, std::size_t number_of_channels)
-    : _buffer(std::make_unique<std::vector<NumericalRep>>(number_of_channels*number_of_spectra))
+AggregationBuffer<NumericalRep>::AggregationBuffer(std::size_t number_of_spectra, std::size_t number_of_channels, AllocatorType const& allocator)
+    : _buffer(std::make_shared<StorageType>(number_of_channels*number_of_spectra, NumericalRep(), allocator))
+    , _offset(0)
     , _time_stride(1)
     , _frequency_stride(number_of_spectra)
     , _number_of_spectra(number_of_spectra)
     , _number_of_channels(number_of_channels)
     , _current_time(0)
+    , _corner_turn_pool(std::make_shared<utils::WorkerPool>())
+    , _deferred(false)
 {
 }
 
+template<typename NumericalRep>
+AggregationBuffer<NumericalRep>::AggregationBuffer(BufferType const& storage, std::size_t offset, std::size_t frequency_stride
+                                                  , std::size_t number_of_spectra, std::size_t number_of_channels)
+    : _buffer(storage)
+    , _offset(offset)
+    , _time_stride(1)
+    , _frequency_stride(frequency_stride)
+    , _number_of_spectra(number_of_spectra)
+    , _number_of_channels(number_of_channels)
+    , _current_time(0)
+    , _corner_turn_pool(std::make_shared<utils::WorkerPool>())
+    , _deferred(false)
+{
+    if(number_of_channels != 0 && (number_of_channels - 1) * frequency_stride + offset + number_of_spectra > storage->size())
+    {
+        throw panda::Error("AggregationBuffer: window extends beyond the end of the storage");
+    }
+}
+
 template<typename NumericalRep>
 AggregationBuffer<NumericalRep>::AggregationBuffer(AggregationBuffer<NumericalRep>&& b)
     : _buffer(std::move(b._buffer))
+    , _offset(b._offset)
     , _time_stride(std::move(b._time_stride))
     , _frequency_stride(std::move(b._frequency_stride))
     , _number_of_spectra(std::move(b._number_of_spectra))
     , _number_of_channels(std::move(b._number_of_channels))
     , _current_time(std::move(b._current_time))
+    , _corner_turn_pool(std::move(b._corner_turn_pool))
+    , _deferred(b._deferred)
+    , _deferred_blocks(std::move(b._deferred_blocks))
 {
 }
 
 template<typename NumericalRep>
 void AggregationBuffer<NumericalRep>::resize(std::size_t number_of_spectra, std::size_t number_of_channels)
 {
-    _buffer->resize(number_of_channels*number_of_spectra);
+    if(_deferred)
+    {
+        // no storage of our own, just references to the inserted data
+        _deferred_blocks.clear();
+    }
+    else if(_buffer.use_count() > 1 || _offset != 0)
+    {
+        // a window onto shared storage, so detach rather than resize the storage under the other windows
+        _buffer = std::make_shared<StorageType>(number_of_channels*number_of_spectra, NumericalRep(), _buffer->get_allocator());
+        _offset = 0;
+    }
+    else
+    {
+        _buffer->resize(number_of_channels*number_of_spectra);
+    }
     _time_stride= 1;
     _frequency_stride = number_of_spectra;
     _number_of_spectra = number_of_spectra;
@@ -83,14 +128,51 @@ template<typename NumericalRep>
 void AggregationBuffer<NumericalRep>::swap(AggregationBuffer& b)
 {
     std::swap(_buffer, b._buffer);
+    std::swap(b._offset, _offset);
     std::swap(b._time_stride, _time_stride);
     std::swap(b._frequency_stride, _frequency_stride);
     std::swap(b._number_of_spectra, _number_of_spectra);
     std::swap(b._number_of_channels, _number_of_channels);
     std::swap(b._current_time, _current_time);
+    std::swap(b._deferred, _deferred);
+    std::swap(b._deferred_blocks, _deferred_blocks);
     b.metadata(_metadata);
 }
 
+template<typename NumericalRep>
+typename AggregationBuffer<NumericalRep>::AllocatorType AggregationBuffer<NumericalRep>::allocator() const
+{
+    return _buffer->get_allocator();
+}
+
+template<typename NumericalRep>
+void AggregationBuffer<NumericalRep>::allocator(AllocatorType const& allocator)
+{
+    _buffer = std::make_shared<StorageType>(_deferred ? 0 : _number_of_channels*_number_of_spectra, NumericalRep(), allocator);
+    _offset = 0;
+    _frequency_stride = _number_of_spectra;
+    _current_time = 0;
+    _deferred_blocks.clear();
+}
+
+template<typename NumericalRep>
+std::size_t AggregationBuffer<NumericalRep>::time_stride() const
+{
+    return _time_stride;
+}
+
+template<typename NumericalRep>
+std::size_t AggregationBuffer<NumericalRep>::frequency_stride() const
+{
+    return _frequency_stride;
+}
+
+template<typename NumericalRep>
+std::size_t AggregationBuffer<NumericalRep>::offset() const
+{
+    return _offset;
+}
+
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::BufferType& AggregationBuffer<NumericalRep>::buffer()
 {
@@ -111,85 +193,85 @@ AggregationBuffer<NumericalRep>::~AggregationBuffer()
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::iterator AggregationBuffer<NumericalRep>::data(unsigned offset)
 {
-    return _buffer->begin() + offset;
+    return begin() + offset;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::data(unsigned offset) const
 {
-    return _buffer->cbegin() + offset;
+    return cbegin() + offset;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::iterator AggregationBuffer<NumericalRep>::begin()
 {
-    return _buffer->begin();
+    return _buffer->begin() + _offset;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::begin() const
 {
-    return _buffer->cbegin();
+    return _buffer->cbegin() + _offset;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::cbegin() const
 {
-    return _buffer->cbegin();
+    return _buffer->cbegin() + _offset;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::iterator AggregationBuffer<NumericalRep>::begin(unsigned frequency_channel)
 {
-    return _buffer->begin() + frequency_channel*_frequency_stride;
+    return begin() + frequency_channel*_frequency_stride;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::begin(unsigned frequency_channel) const
 {
-    return _buffer->cbegin() + frequency_channel*_frequency_stride;
+    return cbegin() + frequency_channel*_frequency_stride;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::cbegin(unsigned frequency_channel) const
 {
-    return _buffer->cbegin() + frequency_channel*_frequency_stride;
+    return cbegin() + frequency_channel*_frequency_stride;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::iterator AggregationBuffer<NumericalRep>::end()
 {
-    return  _buffer->end();
+    return (_number_of_channels == 0) ? begin() : end(_number_of_channels - 1);
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::end() const
 {
-    return _buffer->cend();
+    return cend();
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::cend() const
 {
-    return _buffer->cend();
+    return (_number_of_channels == 0) ? cbegin() : cend(_number_of_channels - 1);
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::iterator AggregationBuffer<NumericalRep>::end(unsigned frequency_channel)
 {
-    return  _buffer->end() + frequency_channel*_frequency_stride;
+    return begin(frequency_channel) + _number_of_spectra;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::end(unsigned frequency_channel) const
 {
-    return _buffer->cend() + frequency_channel*_frequency_stride;
+    return cbegin(frequency_channel) + _number_of_spectra;
 }
 
 template<typename NumericalRep>
 typename AggregationBuffer<NumericalRep>::const_iterator AggregationBuffer<NumericalRep>::cend(unsigned frequency_channel) const
 {
-    return _buffer->cend() + frequency_channel*_frequency_stride;
+    return cbegin(frequency_channel) + _number_of_spectra;
 }
 
 template<typename NumericalRep>
@@ -219,6 +301,11 @@ std::size_t AggregationBuffer<NumericalRep>::number_of_channels() const
 template<typename NumericalRep>
 void AggregationBuffer<NumericalRep>::insert(FrequencyTimeType const& object )
 {
+    if(_deferred)
+    {
+        throw panda::Error("AggregationBuffer: FrequencyTime data cannot be inserted when the corner turn is deferred");
+    }
+
     //std::cout<<(unsigned)(*std::max_element(object.begin(), object.end()))<<"\n";
     if(_current_time==0)
     {
@@ -252,15 +339,43 @@ void AggregationBuffer<NumericalRep>::insert(FrequencyTimeType const& object )
 template<typename NumericalRep>
 void AggregationBuffer<NumericalRep>::insert(TimeFrequencyType const& object)
 {
-    FrequencyTimeType temp(object);
-    insert(temp);
+    if(_current_time==0)
+    {
+        this->metadata(object.metadata());
+    }
+
+    // corner turn straight into the buffer, each channel row being _frequency_stride long
+    std::size_t const number_of_spectra = std::min(remaining_capacity(), static_cast<std::size_t>(object.number_of_spectra()));
+    if(number_of_spectra == 0) return;
+
+    if(_deferred)
+    {
+        std::shared_ptr<TimeFrequencyType const> data;
+        try {
+            data = object.shared_from_this();
+        }
+        catch(std::bad_weak_ptr const&) {
+            // not shared, so we cannot hold on to it
+            data = std::make_shared<TimeFrequencyType>(object);
+        }
+        _deferred_blocks.push_back(DeferredBlock{std::move(data), 0, number_of_spectra});
+        _current_time += number_of_spectra;
+        return;
+    }
+
+    corner_turn::parallel_corner_turn(&*object.cbegin()
+                                    , &*(this->begin() + _current_time)
+                                    , object.number_of_channels()
+                                    , number_of_spectra
+                                    , _frequency_stride
+                                    , corner_turn_workers());
+    _current_time += number_of_spectra;
 }
 
 template<typename NumericalRep>
 void AggregationBuffer<NumericalRep>::insert(std::shared_ptr<TimeFrequencyType> const& object)
 {
-    FrequencyTimeType temp(*object);
-    insert(temp);
+    insert(*object);
 }
 
 template<typename NumericalRep>
@@ -278,16 +393,74 @@ void AggregationBuffer<NumericalRep>::transfer(std::size_t size, AggregationBuff
     }
     dest.start_time(this->start_time(this->capacity()-size));
 
-    for(unsigned int channel=0; channel<dest.number_of_channels(); ++channel)
+    if(_deferred)
+    {
+        std::size_t const begin_spectrum = this->capacity() - size;
+        if(dest._deferred)
+        {
+            // pass on references to the blocks covering the overlap, no data is copied
+            std::size_t block_start = 0;
+            for(DeferredBlock const& block : _deferred_blocks)
+            {
+                std::size_t const block_end = block_start + block.number_of_spectra;
+                if(block_end > begin_spectrum)
+                {
+                    std::size_t const skip = (block_start < begin_spectrum) ? begin_spectrum - block_start : 0;
+                    dest._deferred_blocks.push_back(DeferredBlock{block.data, block.first_spectrum + skip, block.number_of_spectra - skip});
+                    dest._current_time += block.number_of_spectra - skip;
+                }
+                block_start = block_end;
+            }
+        }
+        else
+        {
+            corner_turn_deferred(begin_spectrum, this->capacity(), &*(dest.begin() + dest._current_time), dest._frequency_stride);
+            dest._current_time += size;
+        }
+        return;
+    }
+
+    // consecutive windows onto a ring already share the overlap
+    bool const in_place = (_buffer == dest._buffer) && (_frequency_stride == dest._frequency_stride)
+                          && (_offset + this->capacity() - size == dest._offset + dest._current_time);
+    if(!in_place)
     {
-        panda::copy( this->begin(channel)+this->capacity()-size
-                   , this->begin(channel)+this->capacity()
-                   , dest.begin(channel)
-                   );
+        for(unsigned int channel=0; channel<dest.number_of_channels(); ++channel)
+        {
+            panda::copy( this->begin(channel)+this->capacity()-size
+                       , this->begin(channel)+this->capacity()
+                       , dest.begin(channel)+dest._current_time
+                       );
+        }
     }
     dest._current_time += size;
 }
 
+template<typename NumericalRep>
+template<typename IteratorT>
+void AggregationBuffer<NumericalRep>::copy_to(IteratorT destination) const
+{
+    if(_deferred)
+    {
+        auto* const out = &*destination;
+        std::size_t const written = corner_turn_deferred(0, _number_of_spectra, out, _number_of_spectra);
+        if(written < _number_of_spectra)
+        {
+            for(unsigned int channel=0; channel<_number_of_channels; ++channel)
+            {
+                std::fill(out + channel * _number_of_spectra + written, out + (channel + 1) * _number_of_spectra, 0);
+            }
+        }
+        return;
+    }
+
+    for(unsigned int channel=0; channel<_number_of_channels; ++channel)
+    {
+        panda::copy(this->cbegin(channel), this->cend(channel), destination);
+        std::advance(destination, _number_of_spectra);
+    }
+}
+
 template<typename NumericalRep>
 std::size_t AggregationBuffer<NumericalRep>::remaining_capacity() const
 {
@@ -350,6 +523,83 @@ void AggregationBuffer<NumericalRep>::set_channel_frequencies(InputIterator begi
     this->_metadata.channel_frequencies(begin, end);
 }
 
+template<typename NumericalRep>
+unsigned AggregationBuffer<NumericalRep>::corner_turn_threads() const
+{
+    return _corner_turn_pool ? _corner_turn_pool->number_of_threads() : 1U;
+}
+
+template<typename NumericalRep>
+void AggregationBuffer<NumericalRep>::corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus)
+{
+    number_of_threads = std::max(1U, number_of_threads);
+    if(!_corner_turn_pool || number_of_threads != corner_turn_threads() || cpus != _corner_turn_pool->cpus()) {
+        _corner_turn_pool = std::make_shared<utils::WorkerPool>(number_of_threads, cpus);
+    }
+}
+
+template<typename NumericalRep>
+std::shared_ptr<utils::WorkerPool> const& AggregationBuffer<NumericalRep>::corner_turn_pool() const
+{
+    return _corner_turn_pool;
+}
+
+template<typename NumericalRep>
+void AggregationBuffer<NumericalRep>::corner_turn_pool(std::shared_ptr<utils::WorkerPool> pool)
+{
+    _corner_turn_pool = pool ? std::move(pool) : std::make_shared<utils::WorkerPool>();
+}
+
+template<typename NumericalRep>
+bool AggregationBuffer<NumericalRep>::deferred_corner_turn() const
+{
+    return _deferred;
+}
+
+template<typename NumericalRep>
+void AggregationBuffer<NumericalRep>::deferred_corner_turn(bool defer)
+{
+    _deferred = defer;
+    _deferred_blocks.clear();
+    _buffer = std::make_shared<StorageType>(_deferred ? 0 : _number_of_channels*_number_of_spectra, NumericalRep(), _buffer->get_allocator());
+    _offset = 0;
+    _frequency_stride = _number_of_spectra;
+    _current_time = 0;
+}
+
+template<typename NumericalRep>
+template<typename DstT>
+std::size_t AggregationBuffer<NumericalRep>::corner_turn_deferred(std::size_t begin_spectrum, std::size_t end_spectrum, DstT* destination, std::size_t output_stride) const
+{
+    std::size_t written = 0;
+    std::size_t block_start = 0;
+    for(DeferredBlock const& block : _deferred_blocks)
+    {
+        std::size_t const block_end = block_start + block.number_of_spectra;
+        std::size_t const first = std::max(block_start, begin_spectrum);
+        std::size_t const last = std::min(block_end, end_spectrum);
+        if(first < last)
+        {
+            std::size_t const number_of_channels = block.data->number_of_channels();
+            corner_turn::parallel_corner_turn(&*block.data->cbegin() + (block.first_spectrum + first - block_start) * number_of_channels
+                                            , destination + (first - begin_spectrum)
+                                            , number_of_channels
+                                            , last - first
+                                            , output_stride
+                                            , corner_turn_workers());
+            written = last - begin_spectrum;
+        }
+        block_start = block_end;
+    }
+    return written;
+}
+
+template<typename NumericalRep>
+utils::WorkerPool& AggregationBuffer<NumericalRep>::corner_turn_workers() const
+{
+    return *_corner_turn_pool;
+}
+
 template<typename NumericalRep>
 typename data::TimeFrequencyMetadata const& AggregationBuffer<NumericalRep>::metadata() const
 {
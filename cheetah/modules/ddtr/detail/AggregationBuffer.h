@@ -27,6 +27,9 @@
 #include "panda/Buffer.h"
 #include "cheetah/data/FrequencyTime.h"
 #include "cheetah/data/TimeFrequencyCommon.h"
+#include "cheetah/utils/HugePageAllocator.h"
+#include "cheetah/utils/WorkerPool.h"
+#include <memory>
 #include <vector>
 #include <type_traits>
 
@@ -69,17 +72,29 @@ template<typename NumericalRep>
 class AggregationBuffer
 {
     public:
-        typedef typename std::vector<NumericalRep>::iterator iterator;
-        typedef typename std::vector<NumericalRep>::const_iterator const_iterator;
+        typedef utils::HugePageAllocator<NumericalRep> AllocatorType;
+        typedef std::vector<NumericalRep, AllocatorType> StorageType;
+        typedef typename StorageType::iterator iterator;
+        typedef typename StorageType::const_iterator const_iterator;
         typedef typename data::FrequencyTime<cheetah::Cpu, NumericalRep> FrequencyTimeType;
         typedef typename data::TimeFrequency<cheetah::Cpu, NumericalRep> TimeFrequencyType;
         typedef typename FrequencyTimeType::FrequencyType FrequencyType;
-        typedef typename std::unique_ptr<std::vector<NumericalRep>> BufferType;
+        typedef typename std::shared_ptr<StorageType> BufferType;
         typedef boost::units::quantity<boost::units::si::time, double> TimeType;
         typedef cheetah::utils::ModifiedJulianClock::time_point TimePointType;
 
     public:
-        AggregationBuffer(std::size_t number_of_spectra, std::size_t number_of_channels);
+        AggregationBuffer(std::size_t number_of_spectra, std::size_t number_of_channels, AllocatorType const& allocator = AllocatorType());
+
+        /**
+         * @brief a buffer that is a window onto (a part of) some shared storage
+         * @param offset the number of samples from the start of each channel row to the start of this buffer
+         * @param frequency_stride the distance (in samples) between consecutive channel rows in the storage
+         * @details used for the ring buffer mode of the AggregationBufferFiller, where consecutive buffers
+         *          share the overlapping samples in place
+         */
+        AggregationBuffer(BufferType const& storage, std::size_t offset, std::size_t frequency_stride
+                         , std::size_t number_of_spectra, std::size_t number_of_channels);
         AggregationBuffer();
         AggregationBuffer(AggregationBuffer&&);
         AggregationBuffer(AggregationBuffer const&) = delete;
@@ -98,9 +113,20 @@ class AggregationBuffer
         /**
          * @brief transfers size bytes of data, and assosiated composition information from the end of the
          *        buffer to the destination_buffer
+         * @details if the destination already shares these samples in place (consecutive windows onto the
+         *          same storage) no data is copied
          */
         void transfer(std::size_t size, AggregationBuffer<NumericalRep>& destination_buffer) const;
 
+        /**
+         * @brief copy the data channel by channel into a contiguous destination (number_of_spectra() samples per channel)
+         * @details the destination may have a different (e.g. wider) numerical type.
+         *          If the corner turn is deferred the inserted TimeFrequency data is corner turned straight into
+         *          the destination, and any spectra not yet inserted are zeroed.
+         */
+        template<typename IteratorT>
+        void copy_to(IteratorT destination) const;
+
         /**
          * @brief return a pointer to the  position of the underlying data buffer
          * @param offset from the position
@@ -110,6 +136,8 @@ class AggregationBuffer
 
         /**
          * @brief iterators for beginning to end of the data
+         * @details the channel rows are frequency_stride() apart. Only when this is equal to number_of_spectra()
+         *          (i.e. the buffer is not a window onto a ring) is the data contiguous between begin() and end()
          */
         iterator begin();
         const_iterator begin() const;
@@ -124,6 +152,11 @@ class AggregationBuffer
         const_iterator end(unsigned frequency_channel) const;
         const_iterator cend(unsigned frequency_channel) const;
 
+        /**
+         * @brief the offset (in samples) of this buffer from the start of each channel row in the storage
+         */
+        std::size_t offset() const;
+
         /**
          * @brief return a pointer to the  buffer object
          */
@@ -134,6 +167,8 @@ class AggregationBuffer
         /**
          * @brief copy the data into the current buffer at the current insertion location
          *        The insertion pointer is then updated to point to the end of this data.
+         * @details if the corner turn is deferred TimeFrequency data is not copied, a reference to it is kept instead.
+         *          FrequencyTime data cannot be inserted into a deferred buffer.
          */
         void insert(std::shared_ptr<TimeFrequencyType> const& object );
         void insert(std::shared_ptr<FrequencyTimeType> const& object );
@@ -161,6 +196,16 @@ class AggregationBuffer
 
         void swap(AggregationBuffer& b);
 
+        /**
+         * @brief the allocator (and so the page size policy) used for the data
+         */
+        AllocatorType allocator() const;
+
+        /**
+         * @brief set the allocator used for the data. The current contents are discarded.
+         */
+        void allocator(AllocatorType const& allocator);
+
         /**
          * @returns the absolute time the first time sample corresponds to.
          */
@@ -225,15 +270,79 @@ class AggregationBuffer
 
         void resize(std::size_t number_of_spectra, std::size_t number_of_channels);
 
+        /**
+         * @brief the maximum number of threads used to corner turn TimeFrequency data on insert
+         */
+        unsigned corner_turn_threads() const;
+
+        /**
+         * @brief set the maximum number of threads used to corner turn TimeFrequency data on insert (default 1)
+         * @details starts a new pool of worker threads that persists for the lifetime of the buffer
+         * @param cpus the cores to bind the threads to (empty => inherit the affinity of the calling thread)
+         */
+        void corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus = {});
+
+        /**
+         * @brief the threads used to corner turn TimeFrequency data on insert
+         * @details a single threaded pool (the calling thread only) unless corner_turn_threads() > 1 was requested
+         */
+        std::shared_ptr<utils::WorkerPool> const& corner_turn_pool() const;
+
+        /**
+         * @brief use an existing pool of threads for the corner turn (e.g. one shared between consecutive buffers)
+         */
+        void corner_turn_pool(std::shared_ptr<utils::WorkerPool> pool);
+
+        /**
+         * @brief true if the inserted data is only corner turned when it is read (see deferred_corner_turn(bool))
+         */
+        bool deferred_corner_turn() const;
+
+        /**
+         * @brief keep references to the inserted TimeFrequency data rather than corner turning it into the buffer
+         * @details the data is then corner turned when it is read with copy_to() or transfer(), straight into the
+         *          reader's destination, and the buffer has no storage of its own (begin(), data() etc. are not
+         *          available). The overlap with the next buffer is passed on as references too.
+         *          The current contents are discarded.
+         */
+        void deferred_corner_turn(bool defer);
+
+    private:
+        /**
+         * @brief a range of spectra of an inserted TimeFrequency block, pending its corner turn
+         */
+        struct DeferredBlock
+        {
+            std::shared_ptr<TimeFrequencyType const> data;
+            std::size_t first_spectrum;
+            std::size_t number_of_spectra;
+        };
+
+        /**
+         * @brief corner turn the deferred spectra [begin_spectrum, end_spectrum) into destination
+         * @param output_stride the distance between the channel rows of the destination
+         * @return the number of spectra written
+         */
+        template<typename DstT>
+        std::size_t corner_turn_deferred(std::size_t begin_spectrum, std::size_t end_spectrum, DstT* destination, std::size_t output_stride) const;
+
+        /**
+         * @brief the threads to corner turn with
+         */
+        utils::WorkerPool& corner_turn_workers() const;
 
 
     private:
         BufferType _buffer;
+        std::size_t _offset;
         std::size_t _time_stride;
         std::size_t _frequency_stride;
         std::size_t _number_of_spectra;
         std::size_t _number_of_channels;
         std::size_t _current_time;
+        std::shared_ptr<utils::WorkerPool> _corner_turn_pool;
+        bool _deferred;
+        std::vector<DeferredBlock> _deferred_blocks;
         typename data::TimeFrequencyMetadata _metadata;
 };
 
@@ -24,6 +24,8 @@
 
 #include "panda/AggregationBufferFiller.h"
 #include "panda/Error.h"
+#include "panda/Log.h"
+#include <algorithm>
 #include <iterator>
 
 namespace ska {
@@ -37,6 +39,7 @@ AggregationBufferFiller<NumericalRep>::AggregationBufferFiller(FullBufferHandler
     : _fn(listener)
     , _overlap(0)
     , _current(std::make_shared<AggregationBuffer<NumericalRep>>(std::forward<Args>(args)...))
+    , _ring_depth(0)
 {
     clock_gettime(CLOCK_MONOTONIC, &_t0);
 }
@@ -52,8 +55,8 @@ bool AggregationBufferFiller<NumericalRep>::flush()
 {
     // prepare a new buffer
     unsigned long dedisp_samples_ns = (_current->number_of_spectra()-_overlap)*_current->sample_interval().value()*1e9;
-    auto tmp(std::make_shared<AggregationBufferType>(_current->number_of_spectra(), _current->number_of_channels()));
-    _current->swap(*tmp);
+    auto tmp = std::move(_current);
+    _current = next_buffer(*tmp);
 
     if( _overlap != 0 )
         tmp->transfer(_overlap, *_current);
@@ -68,6 +71,86 @@ bool AggregationBufferFiller<NumericalRep>::flush()
     return false;
 }
 
+template<typename NumericalRep>
+std::shared_ptr<typename AggregationBufferFiller<NumericalRep>::AggregationBufferType> AggregationBufferFiller<NumericalRep>::next_buffer(AggregationBufferType const& previous)
+{
+    std::shared_ptr<AggregationBufferType> buffer;
+    if(previous.deferred_corner_turn()) {
+        // no storage to allocate, the buffer only refers to the inserted data
+        buffer = std::make_shared<AggregationBufferType>(0, 0, previous.allocator());
+        buffer->deferred_corner_turn(true);
+        buffer->resize(previous.number_of_spectra(), previous.number_of_channels());
+    }
+    else if(_ring_depth != 0) {
+        buffer = next_ring_buffer(previous);
+    }
+    if(!buffer) {
+        buffer = std::make_shared<AggregationBufferType>(previous.number_of_spectra(), previous.number_of_channels(), previous.allocator());
+    }
+    buffer->metadata(previous.metadata());
+    buffer->corner_turn_pool(previous.corner_turn_pool()); // the worker threads are shared, not restarted per buffer
+    return buffer;
+}
+
+template<typename NumericalRep>
+std::shared_ptr<typename AggregationBufferFiller<NumericalRep>::AggregationBufferType> AggregationBufferFiller<NumericalRep>::next_ring_buffer(AggregationBufferType const& previous)
+{
+    std::size_t const number_of_spectra = previous.number_of_spectra();
+    std::size_t const number_of_channels = previous.number_of_channels();
+    if(number_of_spectra <= _overlap || number_of_channels == 0) return nullptr;
+
+    if(!_ring || _ring->number_of_spectra != number_of_spectra || _ring->number_of_channels != number_of_channels || _ring->overlap != _overlap)
+    {
+        // any buffers still in flight keep hold of the old ring
+        auto ring = std::make_shared<Ring>();
+        ring->number_of_spectra = number_of_spectra;
+        ring->number_of_channels = number_of_channels;
+        ring->overlap = _overlap;
+        ring->step = number_of_spectra - _overlap;
+        // the first buffer after a wrap must not overlap the last buffer before it
+        std::size_t const depth = std::max(_ring_depth, (number_of_spectra + ring->step - 1)/ring->step + 1);
+        ring->stride = (depth - 1) * ring->step + number_of_spectra;
+        ring->next = 0;
+        ring->storage = std::make_shared<typename AggregationBufferType::StorageType>(ring->stride * number_of_channels, NumericalRep(), previous.allocator());
+        PANDA_LOG << "ddtr: aggregation ring of " << depth << " buffers (" << ring->stride << " spectra per channel)";
+        _ring = std::move(ring);
+    }
+
+    std::shared_ptr<Ring> ring = _ring;
+    std::size_t offset = ring->next;
+    if(offset + number_of_spectra > ring->stride) offset = 0; // wrap
+    bool const in_place = previous.buffer() == ring->storage && previous.offset() + ring->step == offset;
+
+    // the overlap is already in place, so only the region beyond it will be written
+    std::size_t const write_begin = offset + (in_place ? _overlap : 0);
+    std::size_t const write_end = offset + number_of_spectra;
+
+    std::lock_guard<std::mutex> lock(ring->mutex);
+    for(std::size_t const live_offset : ring->live)
+    {
+        if(live_offset < write_end && write_begin < live_offset + number_of_spectra)
+        {
+            if(ring->overflow_count++ == 0) {
+                PANDA_LOG_WARN << "ddtr: aggregation ring buffers still in use, allocating (consider increasing aggregation_ring_depth)";
+            }
+            return nullptr;
+        }
+    }
+    ring->live.push_back(offset);
+    ring->next = offset + ring->step;
+
+    return std::shared_ptr<AggregationBufferType>(new AggregationBufferType(ring->storage, offset, ring->stride, number_of_spectra, number_of_channels)
+                                                 , [ring, offset](AggregationBufferType* p)
+                                                   {
+                                                       {
+                                                           std::lock_guard<std::mutex> lock(ring->mutex);
+                                                           ring->live.erase(std::find(ring->live.begin(), ring->live.end(), offset));
+                                                       }
+                                                       delete p;
+                                                   }
+                                                 , ring->control_block_allocator);
+}
+
 template<typename NumericalRep>
 void AggregationBufferFiller<NumericalRep>::full_buffer_handler(FullBufferHandlerT const& handler)
 {
@@ -139,6 +222,44 @@ void AggregationBufferFiller<NumericalRep>::metadata(typename data::TimeFrequenc
     _current->metadata(metadata);
 }
 
+template<typename NumericalRep>
+void AggregationBufferFiller<NumericalRep>::allocator(typename AggregationBufferType::AllocatorType const& allocator)
+{
+    _current->allocator(allocator);
+    _ring.reset();
+}
+
+template<typename NumericalRep>
+void AggregationBufferFiller<NumericalRep>::corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus)
+{
+    _current->corner_turn_threads(number_of_threads, cpus);
+}
+
+template<typename NumericalRep>
+bool AggregationBufferFiller<NumericalRep>::defer_corner_turn() const
+{
+    return _current->deferred_corner_turn();
+}
+
+template<typename NumericalRep>
+void AggregationBufferFiller<NumericalRep>::defer_corner_turn(bool defer)
+{
+    _current->deferred_corner_turn(defer);
+}
+
+template<typename NumericalRep>
+std::size_t AggregationBufferFiller<NumericalRep>::ring_depth() const
+{
+    return _ring_depth;
+}
+
+template<typename NumericalRep>
+void AggregationBufferFiller<NumericalRep>::ring_depth(std::size_t depth)
+{
+    _ring_depth = depth;
+    _ring.reset();
+}
+
 } // namespace ddtr
 } // namespace modules
 } // namespace cheetah
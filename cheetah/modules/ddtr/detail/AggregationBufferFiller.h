@@ -26,9 +26,12 @@
 #define SKA_CHEETAH_MODULES_DDTR_AGGREGATIONBUFFERFILLER_H
 
 #include "AggregationBuffer.h"
+#include "cheetah/utils/FixedBlockAllocator.h"
 #include <functional>
 #include <type_traits>
 #include <chrono>
+#include <mutex>
+#include <vector>
 namespace ska {
 namespace cheetah {
 namespace modules {
@@ -129,6 +132,51 @@ class AggregationBufferFiller
 
         void metadata(typename data::TimeFrequencyMetadata const& metadata);
 
+        /**
+         * @brief set the allocator for the buffers (e.g. to use huge pages)
+         */
+        void allocator(typename AggregationBufferType::AllocatorType const& allocator);
+
+        /**
+         * @brief set the number of threads used to corner turn TimeFrequency data into the buffer
+         * @details the threads are started once and shared by all the subsequent buffers
+         * @param cpus the cores to bind the threads to (empty => inherit the affinity of the calling thread)
+         */
+        void corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus = {});
+
+        /**
+         * @brief the minimum number of buffers laid out along the ring before it wraps (0 = ring mode off)
+         */
+        std::size_t ring_depth() const;
+
+        /**
+         * @brief set the minimum number of buffers laid out along the ring before it wraps (0 = ring mode off)
+         * @details In ring mode the buffers passed to the handler are windows onto a single ring of storage,
+         *          each channel row being long enough to hold several consecutive buffers. Each buffer
+         *          starts overlap() samples before the end of the previous one so the overlap is shared
+         *          in place rather than copied. Only when the ring wraps is the overlap copied back to
+         *          the start. Buffers are not reused whilst the handler (or anything downstream) still
+         *          holds them. If the region needed is still in use a separate buffer is allocated instead.
+         *          Note that the buffers in ring mode are not contiguous (see AggregationBuffer::frequency_stride())
+         *          and must not be modified by the handler.
+         */
+        void ring_depth(std::size_t depth);
+
+        /**
+         * @brief true if the corner turn of the inserted data is deferred until the buffers are read
+         */
+        bool defer_corner_turn() const;
+
+        /**
+         * @brief keep references to the inserted TimeFrequency data rather than corner turning it into the buffers
+         * @details The handler then corner turns each buffer straight into its own destination with
+         *          AggregationBuffer::copy_to() (or transfer()), so the data is copied once rather than
+         *          once into the buffer and again out of it. Only references to the overlap are passed on
+         *          to the next buffer. The inserted chunks are held until the buffers referring to them are
+         *          released. Ring mode is not used while the corner turn is deferred.
+         */
+        void defer_corner_turn(bool defer);
+
         void add_nsec(struct timespec& temp, long nsec) {
             temp.tv_nsec += nsec;
             if (temp.tv_nsec >= 1000000000) {
@@ -144,11 +192,39 @@ class AggregationBufferFiller
             }
         }
 
+    private:
+        struct Ring
+        {
+            typename AggregationBufferType::BufferType storage;
+            std::size_t number_of_spectra;
+            std::size_t number_of_channels;
+            std::size_t overlap;
+            std::size_t step;   // offset between consecutive buffers
+            std::size_t stride; // length of each channel row in the storage
+            std::size_t next;   // offset of the next buffer
+            std::vector<std::size_t> live; // offsets of the buffers still in use
+            std::size_t overflow_count = 0;
+            std::mutex mutex;
+            utils::FixedBlockAllocator<AggregationBufferType> control_block_allocator;
+        };
+
+        /**
+         * @brief generate the buffer to follow previous
+         */
+        std::shared_ptr<AggregationBufferType> next_buffer(AggregationBufferType const& previous);
+
+        /**
+         * @brief the next window on the ring, or nullptr if that region is still in use
+         */
+        std::shared_ptr<AggregationBufferType> next_ring_buffer(AggregationBufferType const& previous);
+
     private:
         FullBufferHandlerT _fn;
         std::size_t _overlap;
         std::shared_ptr<AggregationBufferType> _current;
         struct timespec _t0;
+        std::size_t _ring_depth;
+        std::shared_ptr<Ring> _ring;
 };
 
 } // namespace ddtr
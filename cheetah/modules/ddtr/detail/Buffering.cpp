@@ -121,6 +121,30 @@ std::size_t Buffering<DdtrTraits, PlanType>::remaining_capacity()
     return _agg_buf_filler.remaining_capacity();
 }
 
+template<typename DdtrTraits, typename PlanType>
+void Buffering<DdtrTraits, PlanType>::allocator(typename DdtrTraits::BufferType::AllocatorType const& allocator)
+{
+    _agg_buf_filler.allocator(allocator);
+}
+
+template<typename DdtrTraits, typename PlanType>
+void Buffering<DdtrTraits, PlanType>::ring_depth(std::size_t depth)
+{
+    _agg_buf_filler.ring_depth(depth);
+}
+
+template<typename DdtrTraits, typename PlanType>
+void Buffering<DdtrTraits, PlanType>::corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus)
+{
+    _agg_buf_filler.corner_turn_threads(number_of_threads, cpus);
+}
+
+template<typename DdtrTraits, typename PlanType>
+void Buffering<DdtrTraits, PlanType>::defer_corner_turn(bool defer)
+{
+    _agg_buf_filler.defer_corner_turn(defer);
+}
+
 } // namespace ddtr
 } // namespace modules
 } // namespace cheetah
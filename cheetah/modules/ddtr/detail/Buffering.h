@@ -65,6 +65,29 @@ class Buffering
 
         std::size_t remaining_capacity();
 
+        /**
+         * @brief set the allocator for the aggregation buffers
+         */
+        void allocator(typename DdtrTraits::BufferType::AllocatorType const& allocator);
+
+        /**
+         * @brief set the ring mode depth of the aggregation buffers (0 = off)
+         * @details see AggregationBufferFiller::ring_depth
+         */
+        void ring_depth(std::size_t depth);
+
+        /**
+         * @brief set the number of threads used to corner turn incoming data into the aggregation buffers
+         * @details see AggregationBufferFiller::corner_turn_threads
+         */
+        void corner_turn_threads(unsigned number_of_threads, std::vector<unsigned> const& cpus = {});
+
+        /**
+         * @brief defer the corner turn of the incoming data until the buffers are read
+         * @details see AggregationBufferFiller::defer_corner_turn
+         */
+        void defer_corner_turn(bool defer);
+
     private:
         void agg_buffer_init(TimeFrequencyType const&);
 
@@ -159,6 +159,10 @@ DdtrModule<DdtrTraits, DdtrAlgorithms...>::DdtrModule(BeamConfigType const& beam
               , std::forward<AggBufferArgs>(agg_buffer_args)...
               )
 {
+    _buffer.allocator(typename DdtrTraits::BufferType::AllocatorType(config.aggregation_buffer_pages(), "AggregationBuffer"));
+    _buffer.ring_depth(config.aggregation_ring_depth());
+    _buffer.corner_turn_threads(config.corner_turn_threads(), beam_config.affinities());
+    _buffer.defer_corner_turn(config.defer_corner_turn());
     FactoryWrap<AlgoFactoryType> wrap_factory(beam_config, config, factory, _buffer, _task);
     utils::TaskConfigurationSetter<DdtrAlgorithms<DdtrTraits>...>::configure(_task, wrap_factory);
 }
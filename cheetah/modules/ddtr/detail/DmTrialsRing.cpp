@@ -0,0 +1,129 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "panda/Error.h"
+#include "panda/Log.h"
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+
+template<typename DmTrialsT>
+DmTrialsRing<DmTrialsT>::DmTrialsRing()
+    : _slots(std::make_shared<Slots>())
+    , _acquire_timeout(std::chrono::seconds(10))
+{
+}
+
+template<typename DmTrialsT>
+DmTrialsRing<DmTrialsT>::~DmTrialsRing()
+{
+}
+
+template<typename DmTrialsT>
+void DmTrialsRing<DmTrialsT>::reset(std::size_t depth, std::shared_ptr<data::DmTrialsMetadata> const& metadata, TimePointType const& start_time)
+{
+    // in flight objects keep hold of the old slots
+    auto slots = std::make_shared<Slots>();
+    slots->metadata = metadata;
+    slots->storage.reserve(depth);
+    slots->free_list.reserve(depth);
+    for(std::size_t i=0; i < depth; ++i) {
+        slots->storage.emplace_back(new DmTrialsType(metadata, start_time));
+        slots->free_list.push_back(slots->storage.back().get());
+    }
+    _slots = std::move(slots);
+}
+
+template<typename DmTrialsT>
+std::shared_ptr<DmTrialsT> DmTrialsRing<DmTrialsT>::acquire()
+{
+    std::shared_ptr<Slots> slots = _slots;
+    std::unique_lock<std::mutex> lock(slots->mutex);
+    if(!slots->metadata) {
+        throw panda::Error("DmTrialsRing: acquire() called before reset()");
+    }
+    if(slots->free_list.empty()) {
+        if(slots->wait_count++ == 0) {
+            PANDA_LOG_WARN << "ddtr: all " << slots->storage.size() << " DmTrials buffers are in flight,"
+                           << " waiting for one to be released (consider increasing pipeline_depth)";
+        }
+        if(!slots->released.wait_for(lock, _acquire_timeout, [&slots]() { return !slots->free_list.empty(); })) {
+            panda::Error e("DmTrialsRing: all ");
+            e << slots->storage.size() << " DmTrials buffers still in flight after " << _acquire_timeout.count()
+              << " ms (increase pipeline_depth or release the dedispersed data sooner)";
+            throw e;
+        }
+    }
+    DmTrialsType* trials = slots->free_list.back();
+    slots->free_list.pop_back();
+    return std::shared_ptr<DmTrialsType>(trials, [slots](DmTrialsType* p)
+                                                 {
+                                                     {
+                                                         std::lock_guard<std::mutex> lock(slots->mutex);
+                                                         slots->free_list.push_back(p);
+                                                     }
+                                                     slots->released.notify_one();
+                                                 }
+                                       , slots->control_block_allocator);
+}
+
+template<typename DmTrialsT>
+std::chrono::milliseconds DmTrialsRing<DmTrialsT>::acquire_timeout() const
+{
+    return _acquire_timeout;
+}
+
+template<typename DmTrialsT>
+void DmTrialsRing<DmTrialsT>::acquire_timeout(std::chrono::milliseconds timeout)
+{
+    _acquire_timeout = timeout;
+}
+
+template<typename DmTrialsT>
+std::size_t DmTrialsRing<DmTrialsT>::depth() const
+{
+    return _slots->storage.size();
+}
+
+template<typename DmTrialsT>
+std::size_t DmTrialsRing<DmTrialsT>::available() const
+{
+    std::shared_ptr<Slots> slots = _slots;
+    std::lock_guard<std::mutex> lock(slots->mutex);
+    return slots->free_list.size();
+}
+
+template<typename DmTrialsT>
+std::size_t DmTrialsRing<DmTrialsT>::wait_count() const
+{
+    std::shared_ptr<Slots> slots = _slots;
+    std::lock_guard<std::mutex> lock(slots->mutex);
+    return slots->wait_count;
+}
+
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
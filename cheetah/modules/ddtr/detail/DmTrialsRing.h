@@ -0,0 +1,129 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_MODULES_DDTR_DMTRIALSRING_H
+#define SKA_CHEETAH_MODULES_DDTR_DMTRIALSRING_H
+
+#include "cheetah/data/DmTrialsMetadata.h"
+#include "cheetah/utils/FixedBlockAllocator.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+
+/**
+ * @brief A fixed set of preallocated DmTrials objects handed out to successive dedispersion calls
+ *
+ * @details Each call to acquire() passes ownership of a free slot to the caller. The slot is
+ *          returned to the ring automatically when the last shared_ptr to it is released (e.g.
+ *          when spdt has finished with the data), so the ddtr of chunk k+1 can proceed whilst
+ *          downstream consumers are still working on chunk k without the two aliasing.
+ *
+ *          The depth sets how many chunks may be in flight. Should all the slots be in use
+ *          acquire() blocks until one is released. The wait is bounded by acquire_timeout():
+ *          if every pool thread is blocked here none may be left to run the consumers that
+ *          free the slots, so rather than deadlock acquire() throws once the timeout expires.
+ *
+ *          Copies of a DmTrialsRing share the same slots.
+ *
+ * @tparam DmTrialsT the DmTrials type to manage
+ */
+template<typename DmTrialsT>
+class DmTrialsRing
+{
+    public:
+        typedef DmTrialsT DmTrialsType;
+        typedef typename DmTrialsType::Mjd TimePointType;
+
+    public:
+        DmTrialsRing();
+        ~DmTrialsRing();
+
+        /**
+         * @brief (re)allocate depth DmTrials objects with the given metadata
+         * @details any slots currently in flight remain valid and are discarded on release
+         */
+        void reset(std::size_t depth, std::shared_ptr<data::DmTrialsMetadata> const& metadata, TimePointType const& start_time);
+
+        /**
+         * @brief take ownership of a free DmTrials object, waiting for one to be released if necessary
+         * @throw panda::Error if no slot is released within acquire_timeout()
+         */
+        std::shared_ptr<DmTrialsType> acquire();
+
+        /**
+         * @brief the longest acquire() will wait for a slot to be released
+         */
+        std::chrono::milliseconds acquire_timeout() const;
+
+        /**
+         * @brief set the longest acquire() will wait for a slot to be released
+         */
+        void acquire_timeout(std::chrono::milliseconds timeout);
+
+        /**
+         * @brief the number of preallocated slots
+         */
+        std::size_t depth() const;
+
+        /**
+         * @brief the number of preallocated slots not currently in flight
+         */
+        std::size_t available() const;
+
+        /**
+         * @brief the number of times acquire() has had to wait because all slots were in flight
+         */
+        std::size_t wait_count() const;
+
+    private:
+        struct Slots
+        {
+            std::shared_ptr<data::DmTrialsMetadata> metadata;
+            std::vector<std::unique_ptr<DmTrialsType>> storage;
+            std::vector<DmTrialsType*> free_list;
+            std::size_t wait_count = 0;
+            mutable std::mutex mutex;
+            std::condition_variable released;
+            utils::FixedBlockAllocator<DmTrialsType> control_block_allocator; // reuse the shared_ptr control blocks
+        };
+
+    private:
+        std::shared_ptr<Slots> _slots;
+        std::chrono::milliseconds _acquire_timeout;
+};
+
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/modules/ddtr/detail/DmTrialsRing.cpp"
+
+#endif // SKA_CHEETAH_MODULES_DDTR_DMTRIALSRING_H
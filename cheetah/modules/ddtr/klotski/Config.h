@@ -25,6 +25,7 @@
 #define SKA_CHEETAH_MODULES_DDTR_KLOTSKI_CONFIG_H
 
 #include "cheetah/utils/Config.h"
+#include "cheetah/utils/HugePageAllocator.h"
 
 namespace ska {
 namespace cheetah {
@@ -93,6 +94,16 @@ class Config : public utils::Config
          */
         void precise(bool);
 
+        /**
+         * @brief the page size policy for the klotski work areas (transformed input and subbanded dm trials)
+         */
+        utils::HugePagePolicy work_area_pages() const;
+
+        /**
+         * @brief set the page size policy for the klotski work areas
+         */
+        void work_area_pages(utils::HugePagePolicy);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
@@ -102,6 +113,7 @@ class Config : public utils::Config
         std::size_t _max_channels_per_klotski;
         std::size_t _max_channels_per_band;
         bool _precise;
+        utils::HugePagePolicy _work_area_pages;
 };
 
 
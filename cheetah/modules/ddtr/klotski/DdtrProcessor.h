@@ -49,15 +49,19 @@ class DdtrProcessor
         typedef typename DdtrTraits::value_type NumericalRep;
         typedef typename DdtrTraits::DmTrialsType DmTrialsType;
         typedef DedispersionPlan<DdtrTraits> DedispersionPlanType;
+        typedef DedispersionStrategy<NumericalRep> DedispersionStrategyType;
+        typedef typename DedispersionStrategyType::WorkArea WorkAreaType;
 
     public:
         /**
          * @brief Contructor for DdtrProcessor
          * @param plan DedispersionPlan object
          * @param dmt DMtrails object resultant DM-Time data
+         * @param work_area the scratch space holding this chunk's input data
          */
         DdtrProcessor( std::shared_ptr<DedispersionPlanType> plan
                      , std::shared_ptr<DmTrialsType> dmt
+                     , std::shared_ptr<WorkAreaType> work_area
                      );
 
         /**
@@ -93,7 +97,7 @@ class DdtrProcessor
          *
          */
         void integrate_reference( DmTrialsType& data_out
-                                , std::vector<std::vector<int>>& data_temp
+                                , std::vector<utils::HugePageVector<int>>& data_temp
                                 , std::vector<std::vector<unsigned int>>& dmshift_per_band
                                 , std::vector<std::vector<unsigned int>> const& dsamps_per_klotski
                                 , unsigned int number_of_channels
@@ -101,11 +105,17 @@ class DdtrProcessor
                                 , unsigned int start_dm_value
                                 );
 
-        static void call_serial_dedispersion(std::shared_ptr<DedispersionPlanType> plan, unsigned start_channel, unsigned band);
+        static void call_serial_dedispersion(DedispersionStrategyType* strategy, WorkAreaType* work_area, unsigned start_channel, unsigned band);
+
+        /**
+         * @brief Average each factor consecutive elements of the data in place
+         */
+        static void downsample(unsigned short* data, std::size_t number_of_elements, unsigned factor);
 
     private:
         std::shared_ptr<DedispersionPlanType> _plan;
         std::shared_ptr<DmTrialsType> _dm_trials_ptr;
+        std::shared_ptr<WorkAreaType> _work_area;
         std::size_t _current_dm_range;
         std::size_t _total_number_of_dms;
         unsigned int _start_dm_value;
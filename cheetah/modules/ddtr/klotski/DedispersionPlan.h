@@ -27,8 +27,10 @@
 #include "cheetah/modules/ddtr/klotski/Config.h"
 #include "cheetah/modules/ddtr/klotski/detail/DedispersionStrategy.h"
 #include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/modules/ddtr/detail/DmTrialsRing.h"
 #include "cheetah/data/TimeFrequency.h"
 #include "cheetah/utils/MultiThread.h"
+#include "cheetah/utils/LatencyMonitor.h"
 
 namespace ska {
 namespace cheetah {
@@ -95,22 +97,18 @@ class DedispersionPlan
         std::shared_ptr<DedispersionStrategyType> const& dedispersion_strategy() const;
 
         /**
-         * @brief returns pointer to the DmTrials
+         * @brief the preallocated DmTrials objects to dedisperse into
          */
-        std::shared_ptr<DmTrialsType> const& dm_trials();
-
-        std::shared_ptr<DmTrialsType> const& spdt_dm_trials();
+        DmTrialsRing<DmTrialsType>& dm_trials_ring();
 
         std::vector<unsigned> const& affinities();
 
-        unsigned current_dm_range() { return _current_dm_range;}
-
-        void current_dm_range(unsigned val)
-        {
-            _current_dm_range = val;
-        }
-
-        static void call_serial_dedispersion(std::shared_ptr<DedispersionPlan> plan, unsigned start_channel, unsigned band);
+        /**
+         * @brief the core to bind the index'th dedispersion thread to
+         * @details wraps around the beam's affinities if there are fewer cores than threads,
+         *          and spreads the threads over the host if the beam has no affinities
+         */
+        unsigned affinity(std::size_t index);
 
         void initialize_threads();
 
@@ -119,6 +117,16 @@ class DedispersionPlan
             return _beam_config.id();
         }
 
+        /**
+         * @brief the latency histogram for the dedispersion of a whole chunk
+         */
+        utils::LatencyHistogram& ddtr_latency();
+
+        /**
+         * @brief the latency histogram for the dedispersion of the specified dm range
+         */
+        utils::LatencyHistogram& dm_range_latency(std::size_t dm_range);
+
     private:
         BeamConfigType const& _beam_config;
         ConfigType const& _config;
@@ -129,9 +137,9 @@ class DedispersionPlan
         std::size_t _dedispersion_samples;
         std::vector<double> _dm_factors;
         std::size_t _number_of_spectra;
-        std::shared_ptr<DmTrialsType> _dm_trials_ptr;
-        std::shared_ptr<DmTrialsType> _spdt_dm_trials_ptr;
-        unsigned _current_dm_range;
+        DmTrialsRing<DmTrialsType> _dm_trials_ring;
+        utils::LatencyHistogram& _ddtr_latency;
+        std::vector<utils::LatencyHistogram*> _dm_range_latency; // one per dm range, looked up on reset
         //utils::MultiThread _ddtr_threads;
 };
 
@@ -0,0 +1,342 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/klotski/detail/DedispersionStrategy.h"
+#include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/benchmark_utils/KernelBenchmark.h"
+#include <pss/astrotypes/units/Units.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * Micro benchmarks for the klotski dedispersion kernels and their C++ equivalents.
+ *
+ * The dedispersion benchmark drives the serial (single band, single thread) klotski kernel
+ * exactly as the DdtrProcessor does for the first dm range, so the reported ops_per_cycle
+ * refers to one (dm, channel, sample) accumulation per op. The integrate benchmark sums the
+ * per band subanded trials into the final dm trials, one (dm, band, sample) addition per op.
+ */
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+namespace klotski {
+
+extern "C" void nasm_integrate(std::size_t *data_out_pointers
+                                , std::size_t *data_sub_pointers
+                                , const std::size_t *dmshift_pointers
+                                , const unsigned int *dsamps_per_band
+                                , std::size_t *stack_variables
+                                , std::size_t total_size_of_stack
+                                );
+
+extern "C" void nasm_downsample(unsigned short *data, unsigned int number_of_elements);
+
+extern "C" void nasm_zeros(int *data, std::size_t bytes);
+
+int serial_dedispersion(utils::HugePageVector<int>& data_out
+                           , utils::HugePageVector<unsigned short>& data_in
+                           , std::vector<unsigned int> dsamps_per_klotski
+                           , int nsamps
+                           , int number_of_dms
+                           , int max_channels_per_klotski
+                           , int nchans
+                           , std::vector<std::vector<unsigned int>> dmindex_shifts
+                           , std::vector<std::vector<unsigned int>> total_base
+                           , std::vector<std::vector<unsigned int>> total_index
+                           , std::vector<std::vector<unsigned int>> total_shift
+                           , std::vector<std::vector<unsigned int>> counts_array
+                           , std::vector<unsigned int> const& start_dm_shifts
+                           , unsigned int channels_offset
+                           );
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief the C++ equivalent of nasm_downsample: average (rounding up) adjacent pairs in place
+ */
+void cpp_downsample(unsigned short* data, unsigned int number_of_elements)
+{
+    for(unsigned int i=0; i < number_of_elements/2; ++i) {
+        data[i] = static_cast<unsigned short>((data[2*i] + data[2*i+1] + 1U)/2U);
+    }
+}
+
+bool avx512_supported()
+{
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+
+} // namespace
+
+static void BM_nasm_downsample(::benchmark::State& state)
+{
+    if(!avx512_supported()) {
+        state.SkipWithError("nasm_downsample requires AVX-512");
+        return;
+    }
+    unsigned int const number_of_elements = static_cast<unsigned int>(state.range(0));
+    std::vector<unsigned short> data(number_of_elements, 100);
+    for(auto _ : state) {
+        nasm_downsample(data.data(), number_of_elements);
+        ::benchmark::ClobberMemory();
+    }
+    utils::benchmark_utils::set_kernel_counters(state, number_of_elements * sizeof(unsigned short) * 3 / 2, number_of_elements);
+}
+
+static void BM_cpp_downsample(::benchmark::State& state)
+{
+    unsigned int const number_of_elements = static_cast<unsigned int>(state.range(0));
+    std::vector<unsigned short> data(number_of_elements, 100);
+    for(auto _ : state) {
+        cpp_downsample(data.data(), number_of_elements);
+        ::benchmark::ClobberMemory();
+    }
+    utils::benchmark_utils::set_kernel_counters(state, number_of_elements * sizeof(unsigned short) * 3 / 2, number_of_elements);
+}
+
+static void BM_nasm_zeros(::benchmark::State& state)
+{
+    std::size_t const bytes = static_cast<std::size_t>(state.range(0));
+    std::vector<int> data(bytes/sizeof(int), 1);
+    for(auto _ : state) {
+        nasm_zeros(data.data(), bytes);
+        ::benchmark::ClobberMemory();
+    }
+    utils::benchmark_utils::set_kernel_counters(state, bytes, bytes);
+}
+
+static void BM_memset_zeros(::benchmark::State& state)
+{
+    std::size_t const bytes = static_cast<std::size_t>(state.range(0));
+    std::vector<int> data(bytes/sizeof(int), 1);
+    for(auto _ : state) {
+        std::memset(data.data(), 0, bytes);
+        ::benchmark::ClobberMemory();
+    }
+    utils::benchmark_utils::set_kernel_counters(state, bytes, bytes);
+}
+
+/**
+ * Arguments: {number of channels, max channels per klotski, number of dms, number of samples}
+ */
+static void BM_klotski_serial_dedispersion(::benchmark::State& state)
+{
+    typedef uint8_t NumericRep;
+    typedef DedispersionStrategy<NumericRep> StrategyType;
+
+    unsigned const number_of_channels = static_cast<unsigned>(state.range(0));
+    unsigned const channels_per_klotski = static_cast<unsigned>(state.range(1));
+    unsigned const number_of_dms = static_cast<unsigned>(state.range(2));
+    unsigned const number_of_samples = static_cast<unsigned>(state.range(3));
+
+    data::TimeFrequency<Cpu, NumericRep> tf{data::DimensionSize<data::Time>(number_of_samples)
+                                          , data::DimensionSize<data::Frequency>(number_of_channels)};
+    tf.set_channel_frequencies_const_width(data::FrequencyType(1670.0 * data::megahertz)
+                                          , data::FrequencyType((-300.0/number_of_channels) * data::megahertz));
+    tf.sample_interval(64e-6 * data::second);
+
+    ddtr::Config config;
+    config.dedispersion_samples(number_of_samples);
+    config.add_dm_range(0 * data::parsecs_per_cube_cm
+                       , 0.1 * number_of_dms * data::parsecs_per_cube_cm
+                       , 0.1 * data::parsecs_per_cube_cm);
+    config.klotski_algo_config().max_channels_per_klotski(channels_per_klotski);
+
+    StrategyType strategy(tf, config, std::size_t(4)*1024*1024*1024);
+    auto work_area = strategy.acquire_work_area();
+
+    auto& data_in = *work_area->temp_work_area();
+    std::size_t i=0;
+    std::generate(data_in.begin(), data_in.end(), [&i]() { return static_cast<unsigned short>(i++ % 127); });
+    auto& data_out = *work_area->subanded_dm_trials();
+
+    // copy the per range tables once, outside the timed region
+    unsigned const dm_range = 0;
+    auto const dmshifts_per_klotski = strategy.dmshifts_per_klotski()[dm_range];
+    auto const total_base = strategy.total_base()[dm_range];
+    auto const total_index = strategy.total_index()[dm_range];
+    auto const total_shift = strategy.total_shift()[dm_range];
+    auto const counts_array = strategy.counts_array()[dm_range];
+    auto const& dsamps_per_klotski = strategy.dsamps_per_klotski()[dm_range];
+    auto const& start_dm_shifts = strategy.start_dm_shifts()[dm_range];
+
+    for(auto _ : state) {
+        unsigned start_channel = 0;
+        for(unsigned band=0; band < strategy.number_of_bands(); ++band) {
+            serial_dedispersion(data_out[band]
+                               , data_in
+                               , dsamps_per_klotski[band]
+                               , strategy.nsamps()
+                               , strategy.ndms()[dm_range]
+                               , strategy.max_channels_per_klotski()
+                               , strategy.channels_per_band()[band]
+                               , dmshifts_per_klotski[band]
+                               , total_base[band]
+                               , total_index[band]
+                               , total_shift[band]
+                               , counts_array[band]
+                               , start_dm_shifts
+                               , start_channel);
+            start_channel += strategy.channels_per_band()[band];
+        }
+        ::benchmark::ClobberMemory();
+    }
+
+    std::size_t const ops = std::size_t(strategy.ndms()[dm_range]) * strategy.nchans() * strategy.nsamps();
+    std::size_t bytes = data_in.size() * sizeof(unsigned short);
+    for(auto const& band_out : data_out) bytes += band_out.size() * sizeof(int);
+    utils::benchmark_utils::set_kernel_counters(state, bytes, ops);
+}
+
+/**
+ * Arguments: {number of channels, max channels per klotski, number of dms, number of samples}
+ */
+static void BM_nasm_integrate(::benchmark::State& state)
+{
+    typedef uint8_t NumericRep;
+    typedef DedispersionStrategy<NumericRep> StrategyType;
+
+    if(!avx512_supported()) {
+        state.SkipWithError("nasm_integrate requires AVX-512");
+        return;
+    }
+
+    unsigned const number_of_channels = static_cast<unsigned>(state.range(0));
+    unsigned const channels_per_klotski = static_cast<unsigned>(state.range(1));
+    unsigned const number_of_dms = static_cast<unsigned>(state.range(2));
+    unsigned const number_of_samples = static_cast<unsigned>(state.range(3));
+
+    data::TimeFrequency<Cpu, NumericRep> tf{data::DimensionSize<data::Time>(number_of_samples)
+                                          , data::DimensionSize<data::Frequency>(number_of_channels)};
+    tf.set_channel_frequencies_const_width(data::FrequencyType(1670.0 * data::megahertz)
+                                          , data::FrequencyType((-300.0/number_of_channels) * data::megahertz));
+    tf.sample_interval(64e-6 * data::second);
+
+    ddtr::Config config;
+    config.dedispersion_samples(number_of_samples);
+    config.add_dm_range(0 * data::parsecs_per_cube_cm
+                       , 0.1 * number_of_dms * data::parsecs_per_cube_cm
+                       , 0.1 * data::parsecs_per_cube_cm);
+    config.klotski_algo_config().max_channels_per_klotski(channels_per_klotski);
+
+    StrategyType strategy(tf, config, std::size_t(4)*1024*1024*1024);
+    auto work_area = strategy.acquire_work_area();
+
+    // the subanded trials as left behind by the dedispersion kernel
+    auto& data_sub = *work_area->subanded_dm_trials();
+    for(auto& band : data_sub) {
+        std::size_t i=0;
+        std::generate(band.begin(), band.end(), [&i]() { return static_cast<int>(i++ % 1021); });
+    }
+
+    // set up the arguments exactly as DdtrProcessor::integrate_reference does for the first dm range
+    unsigned const dm_range = 0;
+    unsigned const ndms = strategy.ndms()[dm_range];
+    auto& dmshift_per_band = strategy.dmshifts_per_band()[dm_range];
+    auto const& dsamps_per_klotski = strategy.dsamps_per_klotski()[dm_range];
+    unsigned const number_of_bands = dsamps_per_klotski.size();
+    std::size_t const output_samples = dsamps_per_klotski[0][0];
+
+    std::vector<std::vector<float>> data_out(ndms, std::vector<float>(output_samples, 0.0f));
+    std::vector<std::size_t> data_out_pointers;
+    for(auto& dm : data_out) data_out_pointers.emplace_back(reinterpret_cast<std::size_t>(dm.data()));
+
+    std::vector<std::size_t*> data_sub_pointers;
+    for(unsigned band=0; band < number_of_bands; ++band) data_sub_pointers.push_back(reinterpret_cast<std::size_t*>(data_sub[band].data()));
+
+    std::vector<std::size_t*> dmshift_pointers;
+    for(unsigned band=0; band < number_of_bands; ++band) dmshift_pointers.push_back(reinterpret_cast<std::size_t*>(dmshift_per_band[band].data()));
+
+    std::vector<unsigned int> dsamps_per_band(number_of_bands);
+    for(unsigned band=0; band < number_of_bands; ++band) dsamps_per_band[band] = dsamps_per_klotski[band][0];
+
+    std::vector<std::size_t> stack_variables(9);
+    for(auto _ : state) {
+        // the kernel uses the stack variables as scratch so they are reset on every call
+        stack_variables[0] = 128; //DATA_OUT_POINTERS
+        stack_variables[1] = stack_variables[0]+ndms*sizeof(std::size_t); //DATA_SUB_POINTERS
+        stack_variables[2] = stack_variables[1]+number_of_bands*sizeof(std::size_t); //DMSHIFTS_LOCATION
+        stack_variables[3] = stack_variables[2]+ ndms*number_of_bands*sizeof(std::size_t); //DSAMPS_PER_BAND_LOCATION
+        stack_variables[4] = strategy.nchans(); //NCHANS
+        stack_variables[5] = number_of_bands; //NBANDS
+        stack_variables[6] = ndms; //NDMS
+        stack_variables[7] = output_samples/16; //NITER
+        stack_variables[8] = stack_variables[3]+number_of_bands*sizeof(unsigned int); //STACK_SIZE
+
+        nasm_integrate(data_out_pointers.data()
+                      , reinterpret_cast<std::size_t*>(data_sub_pointers.data())
+                      , reinterpret_cast<std::size_t*>(dmshift_pointers.data())
+                      , dsamps_per_band.data()
+                      , stack_variables.data()
+                      , stack_variables[8]
+                      );
+        ::benchmark::ClobberMemory();
+    }
+
+    std::size_t const ops = std::size_t(ndms) * number_of_bands * output_samples;
+    utils::benchmark_utils::set_kernel_counters(state, ops * sizeof(int) + std::size_t(ndms) * output_samples * sizeof(float), ops);
+}
+
+static void downsample_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgName("elements")->RangeMultiplier(8)->Range(1<<16, 1<<25)->Unit(::benchmark::kMicrosecond);
+}
+
+static void zeros_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgName("bytes")->RangeMultiplier(8)->Range(1<<16, 1<<28)->Unit(::benchmark::kMicrosecond);
+}
+
+static void dedispersion_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"channels", "channels_per_klotski", "dms", "samples"});
+    for(int64_t channels_per_klotski : {8, 16, 32, 64}) {
+        for(int64_t dms : {256, 1024}) {
+            b->Args({4096, channels_per_klotski, dms, 1<<14});
+        }
+    }
+    b->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_nasm_downsample)->Apply(downsample_sweep);
+BENCHMARK(BM_cpp_downsample)->Apply(downsample_sweep);
+BENCHMARK(BM_nasm_zeros)->Apply(zeros_sweep);
+BENCHMARK(BM_memset_zeros)->Apply(zeros_sweep);
+BENCHMARK(BM_klotski_serial_dedispersion)->Apply(dedispersion_sweep);
+BENCHMARK(BM_nasm_integrate)->Apply(dedispersion_sweep);
+
+} // namespace benchmark
+} // namespace klotski
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+
+CHEETAH_KERNEL_BENCHMARK_MAIN()
@@ -24,6 +24,7 @@
 
 #include "cheetah/modules/ddtr/klotski/DdtrProcessor.h"
 #include "cheetah/data/FrequencyTime.h"
+#include "cheetah/utils/LatencyMonitor.h"
 
 namespace ska {
 namespace cheetah {
@@ -43,8 +44,8 @@ extern "C" void nasm_downsample(unsigned short *data, unsigned int number_of_ele
 
 extern "C" void nasm_zeros(int *data, std::size_t bytes);
 
-int serial_dedispersion(std::vector<int>& data_out
-                           , std::vector<unsigned short>& data_in
+int serial_dedispersion(utils::HugePageVector<int>& data_out
+                           , utils::HugePageVector<unsigned short>& data_in
                            , std::vector<unsigned int> dsamps_per_klotski
                            , int nsamps
                            , int number_of_dms
@@ -62,9 +63,11 @@ int serial_dedispersion(std::vector<int>& data_out
 template<typename DdtrTraits>
 DdtrProcessor<DdtrTraits>::DdtrProcessor(std::shared_ptr<DedispersionPlanType> plan
                                         , std::shared_ptr<DmTrialsType> dm_trials_ptr
+                                        , std::shared_ptr<WorkAreaType> work_area
                             )
     : _plan(plan)
     , _dm_trials_ptr(dm_trials_ptr)
+    , _work_area(std::move(work_area))
     , _current_dm_range(0)
     , _total_number_of_dms(0)
     , _start_dm_value(0)
@@ -92,19 +95,49 @@ std::size_t const& DdtrProcessor<DdtrTraits>::current_dm_range() const
 template<typename DdtrTraits>
 DdtrProcessor<DdtrTraits>& DdtrProcessor<DdtrTraits>::operator++()
 {
-    threaded_dedispersion(_plan);
+    utils::ScopedLatency timer(_plan->dm_range_latency(_current_dm_range));
+
+    // bring the work area down to the resolution of this range (only the rows still in use are touched)
+    auto const& downsampling = _plan->dedispersion_strategy()->downsampling_plan();
+    unsigned const factor = downsampling.relative_factor(_current_dm_range);
+    if(factor != 1)
+    {
+        std::size_t const previous_factor = downsampling.factor(_current_dm_range)/factor;
+        downsample(&*(*_work_area->temp_work_area()).begin()
+                  , (_plan->dedispersion_strategy()->nsamps()/previous_factor)*_plan->dedispersion_strategy()->nchans()
+                  , factor);
+    }
 
-    nasm_downsample(&*(*_plan->dedispersion_strategy()->temp_work_area()).begin()
-                   , _plan->dedispersion_strategy()->nsamps()*_plan->dedispersion_strategy()->nchans());
+    threaded_dedispersion(_plan);
 
     ++_current_dm_range;
 
     return *this;
 }
 
+template<typename DdtrTraits>
+void DdtrProcessor<DdtrTraits>::downsample(unsigned short* data, std::size_t number_of_elements, unsigned factor)
+{
+    if(factor == 2)
+    {
+        nasm_downsample(data, number_of_elements);
+        return;
+    }
+    // rounds up, as the nasm kernel
+    for(std::size_t element=0; element < number_of_elements/factor; ++element)
+    {
+        unsigned long sum = factor - 1;
+        for(unsigned i=0; i < factor; ++i)
+        {
+            sum += data[element*factor + i];
+        }
+        data[element] = (unsigned short)(sum/factor);
+    }
+}
+
 template<typename DdtrTraits>
 void DdtrProcessor<DdtrTraits>::integrate_reference( DmTrialsType& data_out
-                                                    , std::vector<std::vector<int>>& data_temp
+                                                    , std::vector<utils::HugePageVector<int>>& data_temp
                                                     , std::vector<std::vector<unsigned int>>& dmshift_per_band
                                                     , std::vector<std::vector<unsigned int>> const& dsamps_per_klotski
                                                     , unsigned int number_of_channels
@@ -164,21 +197,22 @@ void DdtrProcessor<DdtrTraits>::integrate_reference( DmTrialsType& data_out
 }
 
 template<typename DdtrTraits>
-void DdtrProcessor<DdtrTraits>::call_serial_dedispersion(std::shared_ptr<DedispersionPlanType> plan, unsigned start_channel, unsigned band)
+void DdtrProcessor<DdtrTraits>::call_serial_dedispersion(DedispersionStrategyType* strategy, WorkAreaType* work_area, unsigned start_channel, unsigned band)
 {
-    serial_dedispersion( std::ref((*plan->dedispersion_strategy()->subanded_dm_trials())[band])
-                             , std::ref(*plan->dedispersion_strategy()->temp_work_area())
-                             , plan->dedispersion_strategy()->dsamps_per_klotski()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->nsamps()/std::pow(2,plan->current_dm_range())
-                             , plan->dedispersion_strategy()->ndms()[plan->current_dm_range()]
-                             , plan->dedispersion_strategy()->max_channels_per_klotski()
-                             , plan->dedispersion_strategy()->channels_per_band()[band]
-                             , plan->dedispersion_strategy()->dmshifts_per_klotski()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_base()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_index()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_shift()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->counts_array()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->start_dm_shifts()[plan->current_dm_range()]
+    unsigned const range = work_area->current_dm_range();
+    serial_dedispersion( std::ref((*work_area->subanded_dm_trials())[band])
+                             , std::ref(*work_area->temp_work_area())
+                             , strategy->dsamps_per_klotski()[range][band]
+                             , strategy->nsamps()/strategy->downsampling_plan().factor(range)
+                             , strategy->ndms()[range]
+                             , strategy->max_channels_per_klotski()
+                             , strategy->channels_per_band()[band]
+                             , strategy->dmshifts_per_klotski()[range][band]
+                             , strategy->total_base()[range][band]
+                             , strategy->total_index()[range][band]
+                             , strategy->total_shift()[range][band]
+                             , strategy->counts_array()[range][band]
+                             , strategy->start_dm_shifts()[range]
                              , start_channel
                              );
 }
@@ -188,58 +222,48 @@ void DdtrProcessor<DdtrTraits>::call_serial_dedispersion(std::shared_ptr<Dedispe
 template<typename DdtrTraits>
 void DdtrProcessor<DdtrTraits>::threaded_dedispersion(std::shared_ptr<DedispersionPlanType> plan)
 {
-    auto& data_temp = *plan->dedispersion_strategy()->subanded_dm_trials();
+    auto& data_temp = *_work_area->subanded_dm_trials();
 
-    //auto ddtr_memset_start = std::chrono::high_resolution_clock::now();
     for(unsigned int value=0; value<data_temp.size(); ++value)
     {
         std::memset(&*data_temp[value].begin(), 0, data_temp[value].size()*sizeof(int));
         //std::fill(data_temp[value].begin(), data_temp[value].end(), 0);
         //nasm_zeros(&*data_temp[value].begin(), data_temp[value].size()*sizeof(int));
     }
-    //auto ddtr_memset_stop = std::chrono::high_resolution_clock::now();
-    //auto ddtr_memset_time = std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_memset_stop - ddtr_memset_start).count()/1000000.0;
-    //PANDA_LOG<<" Beam id: "<<plan->beam_id()<<" Ddtr Memset time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_memset_stop - ddtr_memset_start).count()/1000000.0<<" ms";
 
-    _plan->current_dm_range(_current_dm_range);
+    _work_area->current_dm_range(_current_dm_range);
 
-    if(plan->dedispersion_strategy()->ddtr_threads().number_of_jobs()==0)
+    // each work area has its own threads so concurrent chunks do not share scratch space
+    auto& ddtr_threads = _work_area->ddtr_threads();
+    if(ddtr_threads.number_of_jobs()==0)
     {
         unsigned start_channel = 0;
         for(unsigned int band=0; band<plan->dedispersion_strategy()->number_of_bands(); ++band)
         {
-            plan->dedispersion_strategy()->ddtr_threads().add_job(plan->affinities()[band+2]
-                                                            , call_serial_dedispersion
-                                                            , plan
-                                                            , start_channel
-                                                            , band
-                                                            );
+            ddtr_threads.add_job(plan->affinity(band+2)
+                               , call_serial_dedispersion
+                               , plan->dedispersion_strategy().get()
+                               , _work_area.get()
+                               , start_channel
+                               , band
+                               );
             start_channel += plan->dedispersion_strategy()->channels_per_band()[band];
         }
 
     }
 
-    //auto ddtr_ready_start = std::chrono::high_resolution_clock::now();
     for(unsigned int band=0; band<plan->dedispersion_strategy()->number_of_bands(); ++band)
     {
-        plan->dedispersion_strategy()->ddtr_threads().ready(band);
+        ddtr_threads.ready(band);
     }
-    //auto ddtr_ready_stop = std::chrono::high_resolution_clock::now();
-    //auto ddtr_ready_time = std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_ready_stop - ddtr_ready_start).count()/1000000.0;
-    //PANDA_LOG<<" Beam id: "<<plan->beam_id()<<" Ddtr ready time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_ready_stop - ddtr_ready_start).count()/1000000.0<<" ms";
 
-    //auto ddtr_finish_start = std::chrono::high_resolution_clock::now();
     for(unsigned int band=0; band<plan->dedispersion_strategy()->number_of_bands(); ++band)
     {
-        plan->dedispersion_strategy()->ddtr_threads().finish(band);
+        ddtr_threads.finish(band);
     }
-    //auto ddtr_finish_stop = std::chrono::high_resolution_clock::now();
-    //auto ddtr_finish_time = std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_finish_stop - ddtr_finish_start).count()/1000000.0;
-    //PANDA_LOG<<" Beam id: "<<plan->beam_id()<<" Ddtr finish time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_finish_stop - ddtr_finish_start).count()/1000000.0<<" ms";
 
     DmTrialsType& dmtrials = *(_dm_trials_ptr);
 
-    //auto ddtr_integrate_start = std::chrono::high_resolution_clock::now();
     integrate_reference(dmtrials
                     , data_temp
                     , (plan->dedispersion_strategy()->dmshifts_per_band()[_current_dm_range])
@@ -250,10 +274,6 @@ void DdtrProcessor<DdtrTraits>::threaded_dedispersion(std::shared_ptr<Dedispersi
                     );
 
     _start_dm_value += plan->dedispersion_strategy()->ndms()[_current_dm_range];
-    //auto ddtr_integrate_stop = std::chrono::high_resolution_clock::now();
-    //auto ddtr_integrate_time =std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_integrate_stop - ddtr_integrate_start).count()/1000000.0;
-    //PANDA_LOG<<" Beam id: "<<plan->beam_id()<<" Ddtr integrate time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_integrate_stop - ddtr_integrate_start).count()/1000000.0<<" ms";
-    //std::cout<<" Beam id: "<<plan->beam_id()<<" "<<_current_dm_range<<" "<<ddtr_memset_time<<" "<<ddtr_ready_time<<" "<<ddtr_finish_time<<" "<<ddtr_integrate_time<<"\n";
 }
 
 } // namespace klotski
@@ -26,6 +26,7 @@
 #include "cheetah/corner_turn/CornerTurn.h"
 #include "cheetah/data/FrequencyTime.h"
 #include "cheetah/data/TimeSeries.h"
+#include "cheetah/utils/LatencyMonitor.h"
 
 namespace ska {
 namespace cheetah {
@@ -53,29 +54,29 @@ std::shared_ptr<typename DdtrWorker<DdtrTraits>::DmTrialsType> DdtrWorker<DdtrTr
         e << agg_buf->capacity() << "<" << plan->dedispersion_strategy()->maxshift() << ")";
         throw e;
     }
-    auto ddtr_start = std::chrono::high_resolution_clock::now();
-    panda::copy(agg_buf->begin(), agg_buf->end(), plan->dedispersion_strategy()->temp_work_area()->begin());
-    //std::shared_ptr<DmTrialsType> dmtrials_ptr = DmTrialsType::make_shared(plan->dm_trial_metadata(), agg_buf->start_time());
+    std::shared_ptr<DmTrialsType> dmtrials_ptr;
+    {
+        utils::ScopedLatency timer(plan->ddtr_latency());
+        // this chunk's own scratch space, so chunks can be dedispersed concurrently
+        auto work_area = plan->dedispersion_strategy()->acquire_work_area();
+        // widens to the work area type. If the corner turn is deferred this is the only copy, straight from the incoming chunks
+        agg_buf->copy_to(work_area->temp_work_area()->begin());
 
-    auto dmtrials_ptr = plan->dm_trials();
-    auto spdt_dmtrials_ptr = plan->spdt_dm_trials();
-    dmtrials_ptr->start_time(agg_buf->start_time());
-    spdt_dmtrials_ptr->start_time(agg_buf->start_time());
+        // ownership of the slot passes downstream with the returned pointer
+        dmtrials_ptr = plan->dm_trials_ring().acquire();
+        dmtrials_ptr->start_time(agg_buf->start_time());
 
-    DdtrProcessor<DdtrTraits> ddtr(plan, dmtrials_ptr);
+        DdtrProcessor<DdtrTraits> ddtr(plan, dmtrials_ptr, std::move(work_area));
 
-    while(!ddtr.finished())
-    {
-        ++ddtr;
+        while(!ddtr.finished())
+        {
+            ++ddtr;
+        }
     }
-    auto ddtr_stop = std::chrono::high_resolution_clock::now();
-    PANDA_LOG<<" Beam id: "<<plan->beam_id()<<" Ddtr time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_stop - ddtr_start).count()/1000000.0<<" ms";
-    //std::cout<<plan->beam_id()<<" "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_stop - ddtr_start).count()/1000000.0<<"\n";
     DmTrialsType& dmtrials = *(dmtrials_ptr);
     call_back(dmtrials, plan->dedispersion_strategy()->ndms());
 
-    dmtrials_ptr->swap(*spdt_dmtrials_ptr);
-    return spdt_dmtrials_ptr;
+    return dmtrials_ptr;
 }
 
 } // namespace klotski
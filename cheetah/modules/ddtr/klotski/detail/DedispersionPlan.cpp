@@ -22,6 +22,9 @@
  * SOFTWARE.
  */
 #include "cheetah/modules/ddtr/klotski/DedispersionPlan.h"
+#include <algorithm>
+#include <string>
+#include <thread>
 
 namespace ska {
 namespace cheetah {
@@ -37,7 +40,7 @@ DedispersionPlan<DdtrTraits>::DedispersionPlan(BeamConfigType const& beam_config
     , _max_delay(0)
     , _dedispersion_samples(0)
     , _number_of_spectra(0)
-    , _current_dm_range(0)
+    , _ddtr_latency(utils::LatencyMonitor::instance().histogram("ddtr", beam_config.id()))
 {
 }
 
@@ -73,8 +76,12 @@ data::DimensionSize<data::Time> DedispersionPlan<DdtrTraits>::reset(TimeFrequenc
     _dedispersion_samples = _number_of_spectra-_max_delay;
     _dm_trial_metadata = this->generate_dmtrials_metadata(data.sample_interval(), _dedispersion_samples);
 
-    _dm_trials_ptr = DmTrialsType::make_shared(_dm_trial_metadata, data.start_time());
-    _spdt_dm_trials_ptr = DmTrialsType::make_shared(_dm_trial_metadata, data.start_time());
+    _dm_trials_ring.reset(_config.pipeline_depth(), _dm_trial_metadata, data.start_time());
+
+    _dm_range_latency.clear();
+    for(std::size_t range=0; range < _strategy->number_of_dm_ranges(); ++range) {
+        _dm_range_latency.push_back(&utils::LatencyMonitor::instance().histogram("ddtr_dm_range_" + std::to_string(range), _beam_config.id()));
+    }
 
 
     return data::DimensionSize<data::Time>(_number_of_spectra);
@@ -91,11 +98,11 @@ void DedispersionPlan<DdtrTraits>::initialize_threads()
         /*
         for(unsigned int band=0; band<this->dedispersion_strategy()->number_of_bands(); ++band)
         {
-            _ddtr_threads->emplace_back(utils::SingleThread(this->affinities()[band+1], serial_dedispersion
+            _ddtr_threads->emplace_back(utils::SingleThread(this->affinity(band+1), serial_dedispersion
                              ,  std::ref((*this->dedispersion_strategy()->subanded_dm_trials())[band])
                              , std::ref(*this->dedispersion_strategy()->temp_work_area())
                              , this->dedispersion_strategy()->dsamps_per_klotski()[this->current_dm_range()][band]
-                             , this->dedispersion_strategy()->nsamps()/std::pow(2,this->current_dm_range())
+                             , this->dedispersion_strategy()->nsamps()/this->dedispersion_strategy()->downsampling_plan().factor(this->current_dm_range())
                              , this->dedispersion_strategy()->ndms()[this->current_dm_range()]
                              , this->dedispersion_strategy()->max_channels_per_klotski()
                              , this->dedispersion_strategy()->channels_per_band()[band]
@@ -128,32 +135,12 @@ std::shared_ptr<data::DmTrialsMetadata> DedispersionPlan<DdtrTraits>::generate_d
         for (unsigned int dmindx=0; dmindx < _strategy->ndms()[index]; ++dmindx)
         {
             auto dm = _strategy->dm_low()[index].value() + dmindx*_strategy->dm_step()[index].value();
-            meta_data->emplace_back(Dm(dm* data::parsecs_per_cube_cm), std::pow(2,index));
+            meta_data->emplace_back(Dm(dm* data::parsecs_per_cube_cm), _strategy->downsampling_plan().factor(index));
         }
     }
     return meta_data;
 }
 
-template<typename DdtrTraits>
-void DedispersionPlan<DdtrTraits>::call_serial_dedispersion(std::shared_ptr<DedispersionPlan<DdtrTraits>> plan, unsigned start_channel, unsigned band)
-{
-    serial_dedispersion( std::ref((*plan->dedispersion_strategy()->subanded_dm_trials())[band])
-                             , std::ref(*plan->dedispersion_strategy()->temp_work_area())
-                             , plan->dedispersion_strategy()->dsamps_per_klotski()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->nsamps()/std::pow(2,plan->current_dm_range())
-                             , plan->dedispersion_strategy()->ndms()[plan->current_dm_range()]
-                             , plan->dedispersion_strategy()->max_channels_per_klotski()
-                             , plan->dedispersion_strategy()->channels_per_band()[band]
-                             , plan->dedispersion_strategy()->dmshifts_per_klotski()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_base()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_index()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->total_shift()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->counts_array()[plan->current_dm_range()][band]
-                             , plan->dedispersion_strategy()->start_dm_shifts()[plan->current_dm_range()]
-                             , start_channel
-                             );
-}
-
 template <typename DdtrTraits>
 data::DimensionSize<data::Time> DedispersionPlan<DdtrTraits>::buffer_overlap() const
 {
@@ -185,15 +172,21 @@ std::shared_ptr<DedispersionStrategy<typename DedispersionPlan<DdtrTraits>::Nume
 }
 
 template <typename DdtrTraits>
-std::shared_ptr<typename DdtrTraits::DmTrialsType> const& DedispersionPlan<DdtrTraits>::dm_trials()
+DmTrialsRing<typename DdtrTraits::DmTrialsType>& DedispersionPlan<DdtrTraits>::dm_trials_ring()
 {
-    return _dm_trials_ptr;
+    return _dm_trials_ring;
 }
 
 template <typename DdtrTraits>
-std::shared_ptr<typename DdtrTraits::DmTrialsType> const& DedispersionPlan<DdtrTraits>::spdt_dm_trials()
+utils::LatencyHistogram& DedispersionPlan<DdtrTraits>::ddtr_latency()
 {
-    return _spdt_dm_trials_ptr;
+    return _ddtr_latency;
+}
+
+template <typename DdtrTraits>
+utils::LatencyHistogram& DedispersionPlan<DdtrTraits>::dm_range_latency(std::size_t dm_range)
+{
+    return *_dm_range_latency[dm_range];
 }
 
 template <typename DdtrTraits>
@@ -202,6 +195,16 @@ std::vector<unsigned> const& DedispersionPlan<DdtrTraits>::affinities()
     return _beam_config.affinities();
 }
 
+template <typename DdtrTraits>
+unsigned DedispersionPlan<DdtrTraits>::affinity(std::size_t index)
+{
+    std::vector<unsigned> const& cores = affinities();
+    if(cores.empty()) {
+        return static_cast<unsigned>(index % std::max(1U, std::thread::hardware_concurrency()));
+    }
+    return cores[index % cores.size()];
+}
+
 
 } // namespace klotski
 } // namespace ddtr
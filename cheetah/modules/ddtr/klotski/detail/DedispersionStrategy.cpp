@@ -30,6 +30,7 @@
 #include <memory>
 #include <algorithm>
 #include <limits>
+#include <numeric>
 
 namespace ska {
 namespace cheetah {
@@ -128,6 +129,7 @@ template<typename NumericalRep>
 DedispersionStrategy<NumericalRep>::DedispersionStrategy(const data::TimeFrequency<Cpu,NumericalRep>& chunk
                                                               , const ddtr::Config& config
                                                               , std::size_t cpu_memory)
+    : _downsampling_plan(0)
 {
     _nsamps = config.dedispersion_samples();
     _max_channels_per_band = config.klotski_algo_config().max_channels_per_band();
@@ -139,7 +141,11 @@ DedispersionStrategy<NumericalRep>::DedispersionStrategy(const data::TimeFrequen
     _dm_constant = config.dm_constant();
     _max_channels_per_klotski = config.klotski_algo_config().max_channels_per_klotski();
     _cache_size = config.klotski_algo_config().cache_size();
+    _work_area_pages = config.klotski_algo_config().work_area_pages();
     _number_of_dmtrials_samples = _nsamps;
+    _sample_interval = chunk.sample_interval().value()*data::seconds;
+    _adaptive_downsampling = config.adaptive_downsampling();
+    _downsampling_tolerance = config.downsampling_tolerance();
 
     for(auto it = config.begin_range(); it!=config.end_range(); ++it)
     {
@@ -153,11 +159,6 @@ DedispersionStrategy<NumericalRep>::DedispersionStrategy(const data::TimeFrequen
 
 
     _tsamp.resize(_number_of_dm_ranges);
-    for(unsigned int range=0; range<_number_of_dm_ranges; ++range)
-    {
-        unsigned int downsampling_factor = std::pow(2,range);
-        _tsamp[range] = (chunk.sample_interval().value()*downsampling_factor*data::seconds);
-    }
 
     _total_base.resize(_number_of_dm_ranges);
     _total_index.resize(_number_of_dm_ranges);
@@ -200,6 +201,41 @@ void DedispersionStrategy<NumericalRep>::make_strategy(size_t const cpu_memory)
     _number_of_bands = _nchans/_max_channels_per_band;
     if(_nchans%_max_channels_per_band!=0) _number_of_bands+=1;
 
+    float temp_shift = _dm_constant.value()*(1.0/((_fch1.value()-_foff.value()*_nchans)*(_fch1.value()-_foff.value()*_nchans))-1.0/(_fch1.value()*_fch1.value()))/_sample_interval.value();
+    _maxshift = temp_shift*_dm_high[_number_of_dm_ranges-1].value();
+    _maxshift = (std::ceil((double)_maxshift/(double)(KlotskiConstraints::minimum_overlap))+1)*KlotskiConstraints::minimum_overlap;
+    if(_maxshift==0) _maxshift = KlotskiConstraints::minimum_overlap;
+    if(_nsamps<2*_maxshift)
+    throw panda::Error("Memory is less than required to perform DDTR");
+
+    _nsamps = std::ceil((double)_nsamps/(double)(KlotskiConstraints::minimum_overlap))*KlotskiConstraints::minimum_overlap;
+    _dedispersed_samples = _nsamps - _maxshift;
+
+    // each level is downsampled in place from the one before, so the factors must divide
+    // both the rows of the work area and the dedispersed output exactly
+    if(_adaptive_downsampling) {
+        std::vector<DownsamplingPlan::Range> ranges;
+        for(unsigned int range=0; range<_number_of_dm_ranges; ++range)
+        {
+            ranges.push_back(DownsamplingPlan::Range{_dm_low[range].value(), _dm_high[range].value(), _dm_step[range].value()});
+        }
+        _downsampling_plan = DownsamplingPlan(_sample_interval.value()
+                                             , _fch1.value() - _foff.value()*(_nchans-1)
+                                             , _fch1.value()
+                                             , _nchans
+                                             , ranges
+                                             , _dm_constant.value()
+                                             , _downsampling_tolerance
+                                             , std::gcd<std::size_t, std::size_t>(_nsamps, _dedispersed_samples));
+    }
+    else {
+        _downsampling_plan = DownsamplingPlan(_number_of_dm_ranges);
+    }
+    for(unsigned int range=0; range<_number_of_dm_ranges; ++range)
+    {
+        _tsamp[range] = _sample_interval*(double)_downsampling_plan.factor(range);
+    }
+
     _ndms.resize(_number_of_dm_ranges,0);
     _klotskis_per_band.resize(_number_of_bands);
     _channels_per_band.resize(_number_of_bands);
@@ -327,24 +363,14 @@ void DedispersionStrategy<NumericalRep>::make_strategy(size_t const cpu_memory)
         }
     }
 
-    float temp_shift = _dm_constant.value()*(1.0/((_fch1.value()-_foff.value()*_nchans)*(_fch1.value()-_foff.value()*_nchans))-1.0/(_fch1.value()*_fch1.value()))/_tsamp[0].value();
-    _maxshift = temp_shift*_dm_high[_number_of_dm_ranges-1].value();
-    _maxshift = (std::ceil((double)_maxshift/(double)(KlotskiConstraints::minimum_overlap))+1)*KlotskiConstraints::minimum_overlap;
-    if(_maxshift==0) _maxshift = KlotskiConstraints::minimum_overlap;
-    if(_nsamps<2*_maxshift)
-    throw panda::Error("Memory is less than required to perform DDTR");
-
-    _nsamps = std::ceil((double)_nsamps/(double)(KlotskiConstraints::minimum_overlap))*KlotskiConstraints::minimum_overlap;
-    _dedispersed_samples = _nsamps - _maxshift;
-
     for(unsigned int range=0; range<_number_of_dm_ranges; ++range)
     {
         for(unsigned int band=0; band<_number_of_bands; ++band)
         {
             int dshift = _dmshifts_per_band[range][band][_ndms[range]-1];
             dshift = KlotskiConstraints::minimum_overlap*(dshift/KlotskiConstraints::minimum_overlap+1);
-            unsigned int temp_samps = _dedispersed_samples/std::pow(2,range) + dshift;
-            if(band==0) temp_samps = _dedispersed_samples/std::pow(2,range);
+            unsigned int temp_samps = _dedispersed_samples/_downsampling_plan.factor(range) + dshift;
+            if(band==0) temp_samps = _dedispersed_samples/_downsampling_plan.factor(range);
             for(unsigned int klotski=0; klotski<_klotskis_per_band[band]; ++klotski)
             {
                 int shift = _dmshifts_per_klotski[range][band][klotski][_ndms[range]-1];
@@ -365,9 +391,10 @@ void DedispersionStrategy<NumericalRep>::make_strategy(size_t const cpu_memory)
     }
 
     _number_of_dmtrials_samples = _dsamps_per_klotski[0][_number_of_bands-1][_klotskis_per_band[_number_of_bands-1]-1];
-    _temp_work_area = std::make_shared<std::vector<unsigned short>>(_nsamps*_nchans);
 
-    _subanded_dm_trials = std::make_shared<std::vector<std::vector<int>>>(_number_of_bands, std::vector<int>(_number_of_dmtrials_samples*_ndms[0]));
+    // areas sized for the previous strategy are discarded as they are released
+    _work_areas = utils::ObjectPool<WorkArea>();
+    _work_areas.reserve(1, std::size_t(_nsamps)*_nchans, std::size_t(_number_of_bands), std::size_t(_number_of_dmtrials_samples)*_ndms[0], _work_area_pages);
 }
 
 template <typename NumericalRep>
@@ -420,17 +447,52 @@ std::vector<std::vector<std::vector<unsigned int>>> const& DedispersionStrategy<
 }
 
 template <typename NumericalRep>
-std::shared_ptr<std::vector<unsigned short>> DedispersionStrategy<NumericalRep>::temp_work_area()
+std::shared_ptr<typename DedispersionStrategy<NumericalRep>::WorkArea> DedispersionStrategy<NumericalRep>::acquire_work_area()
+{
+    return _work_areas.acquire(std::size_t(_nsamps)*_nchans, std::size_t(_number_of_bands), std::size_t(_number_of_dmtrials_samples)*_ndms[0], _work_area_pages);
+}
+
+template <typename NumericalRep>
+DedispersionStrategy<NumericalRep>::WorkArea::WorkArea(std::size_t work_area_size
+                                                      , std::size_t number_of_bands
+                                                      , std::size_t subanded_dm_trials_size
+                                                      , utils::HugePagePolicy pages)
+    : _temp_work_area(std::make_shared<utils::HugePageVector<unsigned short>>(work_area_size, 0, utils::HugePageAllocator<unsigned short>(pages, "klotski work area")))
+    , _subanded_dm_trials(std::make_shared<std::vector<utils::HugePageVector<int>>>(number_of_bands, utils::HugePageVector<int>(subanded_dm_trials_size, 0, utils::HugePageAllocator<int>(pages, "klotski subbanded dm trials"))))
+    , _current_dm_range(0)
+{
+}
+
+template <typename NumericalRep>
+std::shared_ptr<utils::HugePageVector<unsigned short>> const& DedispersionStrategy<NumericalRep>::WorkArea::temp_work_area() const
 {
     return _temp_work_area;
 }
 
 template <typename NumericalRep>
-std::shared_ptr<std::vector<std::vector<int>>> DedispersionStrategy<NumericalRep>::subanded_dm_trials()
+std::shared_ptr<std::vector<utils::HugePageVector<int>>> const& DedispersionStrategy<NumericalRep>::WorkArea::subanded_dm_trials() const
 {
     return _subanded_dm_trials;
 }
 
+template <typename NumericalRep>
+utils::MultiThread& DedispersionStrategy<NumericalRep>::WorkArea::ddtr_threads()
+{
+    return _ddtr_threads;
+}
+
+template <typename NumericalRep>
+unsigned DedispersionStrategy<NumericalRep>::WorkArea::current_dm_range() const
+{
+    return _current_dm_range;
+}
+
+template <typename NumericalRep>
+void DedispersionStrategy<NumericalRep>::WorkArea::current_dm_range(unsigned range)
+{
+    _current_dm_range = range;
+}
+
 template <typename NumericalRep>
 typename DedispersionStrategy<NumericalRep>::IntArrayType DedispersionStrategy<NumericalRep>::total_base() const
 {
@@ -521,6 +583,12 @@ std::vector<typename DedispersionStrategy<NumericalRep>::TimeType> DedispersionS
     return _tsamp;
 }
 
+template <typename NumericalRep>
+DownsamplingPlan const& DedispersionStrategy<NumericalRep>::downsampling_plan() const
+{
+    return _downsampling_plan;
+}
+
 template <typename NumericalRep>
 std::size_t DedispersionStrategy<NumericalRep>::cache_size() const
 {
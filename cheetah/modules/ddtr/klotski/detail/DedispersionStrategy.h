@@ -29,7 +29,10 @@
 #include "cheetah/modules/ddtr/DedispersionTrialPlan.h"
 #include "cheetah/data/Units.h"
 #include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/HugePageAllocator.h"
 #include "cheetah/utils/MultiThread.h"
+#include "cheetah/utils/ObjectPool.h"
+#include <memory>
 
 namespace ska {
 namespace cheetah {
@@ -54,6 +57,49 @@ class DedispersionStrategy
         typedef std::vector<std::vector<std::vector<std::vector<unsigned int>>>> IntArrayType;
         typedef std::vector<std::vector<std::vector<std::vector<float>>>> FloatArrayType;
 
+    public:
+        /**
+         * @brief the scratch space and dedispersion threads needed to dedisperse a single chunk
+         * @details each chunk in flight holds its own WorkArea so successive chunks can be
+         *          dedispersed concurrently without overwriting each other's intermediate data
+         */
+        class WorkArea
+        {
+            public:
+                WorkArea(std::size_t work_area_size
+                        , std::size_t number_of_bands
+                        , std::size_t subanded_dm_trials_size
+                        , utils::HugePagePolicy pages);
+                WorkArea(WorkArea const&) = delete;
+
+                /**
+                 * @brief the transformed input data (FT ordered and widened)
+                 */
+                std::shared_ptr<utils::HugePageVector<unsigned short>> const& temp_work_area() const;
+
+                /**
+                 * @brief the subbanded dedispersed data, one vector per band
+                 */
+                std::shared_ptr<std::vector<utils::HugePageVector<int>>> const& subanded_dm_trials() const;
+
+                /**
+                 * @brief the per band dedispersion threads working on this area
+                 */
+                utils::MultiThread& ddtr_threads();
+
+                /**
+                 * @brief the dm range currently being dedispersed in this area
+                 */
+                unsigned current_dm_range() const;
+                void current_dm_range(unsigned range);
+
+            private:
+                std::shared_ptr<utils::HugePageVector<unsigned short>> _temp_work_area; // tempory work area which contains the tranformed input data
+                std::shared_ptr<std::vector<utils::HugePageVector<int>>> _subanded_dm_trials; // output area containg the subbanded DMtrial data
+                unsigned _current_dm_range;
+                utils::MultiThread _ddtr_threads; // last so the threads are stopped before the data they use is released
+        };
+
     public:
         DedispersionStrategy(data::TimeFrequency<Cpu, NumericalRep> const& chunk
                             , ddtr::Config const& config
@@ -97,14 +143,11 @@ class DedispersionStrategy
         std::vector<std::vector<std::vector<unsigned int>>> const& dsamps_per_klotski() const;
 
         /**
-         * @brief return pointer to temp_work_area which hold the intermediate results mostly the FT data
-         */
-        std::shared_ptr<std::vector<unsigned short>> temp_work_area();
-
-        /**
-         * @brief returns pointer to subanded_dm_trials which holds the subbanded dedispersed data
+         * @brief take a work area for the dedispersion of one chunk
+         * @details the area returns to the strategy when released. One area is preallocated,
+         *          further ones are only allocated when chunks are dedispersed concurrently.
          */
-        std::shared_ptr<std::vector<std::vector<int>>> subanded_dm_trials();
+        std::shared_ptr<WorkArea> acquire_work_area();
 
         /**
          * @brief returns 4D arry containing the information about the base dm index for the corresponding iteration
@@ -186,6 +229,11 @@ class DedispersionStrategy
          */
         std::vector<TimeType> tsamp() const;
 
+        /**
+         * @brief The downsampling factor of each dm range relative to the input data
+         */
+        DownsamplingPlan const& downsampling_plan() const;
+
         /**
          * @brief return L1 cache size
          */
@@ -226,20 +274,6 @@ class DedispersionStrategy
          */
         void resize(size_t const number_of_samples, size_t const cpu_memory);
 
-        static void test (unsigned )
-        {
-            std::cout<<"called the function\n";
-        }
-        void initialize_threads()
-        {
-            _ddtr_threads.add_job(1,test,3);
-        }
-
-        utils::MultiThread& ddtr_threads()
-        {
-            return _ddtr_threads;
-        }
-
     private:
         /**
          * @brief Computes the dedispersion strategy
@@ -284,8 +318,6 @@ class DedispersionStrategy
         std::vector<std::vector<std::vector<unsigned int>>> _dmshifts_per_band; //  2D array containg the dmshift per dmindex per band
         IntArrayType _dmshifts_per_klotski; //  3D array containg the dmshift per dmindex per klotski per band
         std::vector<std::vector<std::vector<unsigned int>>> _dsamps_per_klotski; // 2D array containing the information about the dedispersion samples per klotski per band
-        std::shared_ptr<std::vector<unsigned short>> _temp_work_area; // tempory work area which contains the tranformed input data
-        std::shared_ptr<std::vector<std::vector<int>>> _subanded_dm_trials; // output area containg the subbanded DMtrial data
         IntArrayType _total_base; // base DM indices for each iteration
         IntArrayType _total_index; // DM indices for each iteration
         IntArrayType _total_shift; // shift for each DM indices for each iteration
@@ -302,6 +334,10 @@ class DedispersionStrategy
         unsigned int _total_ndms; // total number of DMs
         Dm _max_dm; // maximum DM in the ranges
         std::vector<TimeType> _tsamp; // sampling time
+        TimeType _sample_interval; // sampling time of the input data
+        bool _adaptive_downsampling; // match the downsampling factors to the smearing per range
+        double _downsampling_tolerance; // fraction of the smearing the sampling time may reach
+        DownsamplingPlan _downsampling_plan; // downsampling factor per range
         std::size_t _cache_size; // L1 cache size in bytes
         unsigned int _nsamps; // number of samples
         unsigned int _nchans; // number of channels
@@ -312,7 +348,8 @@ class DedispersionStrategy
         DmConstantType _dm_constant; // _dm_constant
         FloatArrayType _dmshifts_per_klotski_excess;
         bool _precise;
-        utils::MultiThread _ddtr_threads;
+        utils::HugePagePolicy _work_area_pages;
+        utils::ObjectPool<WorkArea> _work_areas; // one per chunk being dedispersed
 };
 
 } // namespace klotski
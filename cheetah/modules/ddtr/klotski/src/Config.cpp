@@ -39,6 +39,7 @@ Config::Config()
     , _max_channels_per_klotski(32)
     , _max_channels_per_band(1024)
     , _precise(false)
+    , _work_area_pages(utils::HugePagePolicy::None)
 {
 }
 
@@ -63,7 +64,10 @@ void Config::add_options(OptionsDescriptionEasyInit& add_options)
     , "upper limit on number of channels to use per band")
     ("precise"
     , boost::program_options::value<bool>(&_precise)->default_value(_precise)
-    , "if precise==false the dedispersion algorithm will be less accurate but will be fast.");
+    , "if precise==false the dedispersion algorithm will be less accurate but will be fast.")
+    ("work_area_pages"
+    , boost::program_options::value<std::string>()->default_value(utils::to_string(_work_area_pages))->notifier([this](std::string const& v) { _work_area_pages = utils::huge_page_policy(v); })
+    , "the pages to back the dedispersion work areas with (none, transparent, 2MB, 1GB). Falls back to smaller pages if unavailable");
 }
 
 bool Config::active() const
@@ -116,6 +120,16 @@ void Config::precise(bool state)
     _precise = state;
 }
 
+utils::HugePagePolicy Config::work_area_pages() const
+{
+    return _work_area_pages;
+}
+
+void Config::work_area_pages(utils::HugePagePolicy policy)
+{
+    _work_area_pages = policy;
+}
+
 } // namespace klotski
 } // namespace ddtr
 } // namespace modules
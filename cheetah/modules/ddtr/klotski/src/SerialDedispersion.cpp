@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#include "cheetah/utils/HugePageAllocator.h"
 #include <vector>
 #include <array>
 #include <thread>
@@ -186,8 +187,8 @@ void dedisperse_klotski( std::size_t nchans
  * @param channels_offset start channel for the subband
  */
 
-int serial_dedispersion(std::vector<int>& data_out
-                           , std::vector<unsigned short>& data_in
+int serial_dedispersion(utils::HugePageVector<int>& data_out
+                           , utils::HugePageVector<unsigned short>& data_in
                            , std::vector<unsigned int> dsamps_per_klotski
                            , int nsamps
                            , int number_of_dms
@@ -25,6 +25,7 @@
 #define SKA_CHEETAH_MODULES_DDTR_KLOTSKI_BRUTEFORCE_CONFIG_H
 
 #include "cheetah/utils/Config.h"
+#include "cheetah/utils/HugePageAllocator.h"
 
 namespace ska {
 namespace cheetah {
@@ -73,6 +74,16 @@ class Config : public utils::Config
          */
         void cache_size(unsigned int value);
 
+        /**
+         * @brief the page size policy for the klotski work areas (transformed input and subbanded dm trials)
+         */
+        utils::HugePagePolicy work_area_pages() const;
+
+        /**
+         * @brief set the page size policy for the klotski work areas
+         */
+        void work_area_pages(utils::HugePagePolicy);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
@@ -80,6 +91,7 @@ class Config : public utils::Config
         bool _active;
         std::size_t _cache_size; // in bytes
         std::size_t _max_channels_per_klotski_bruteforce;
+        utils::HugePagePolicy _work_area_pages;
 };
 
 
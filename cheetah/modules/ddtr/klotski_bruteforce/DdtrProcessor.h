@@ -48,15 +48,18 @@ class DdtrProcessor
         typedef typename DdtrTraits::value_type NumericalRep;
         typedef typename DdtrTraits::DmTrialsType DmTrialsType;
         typedef DedispersionPlan<DdtrTraits> DedispersionPlanType;
+        typedef typename DedispersionStrategy<NumericalRep>::WorkArea WorkAreaType;
 
     public:
         /**
          * @brief Contructor for DdtrProcessor
          * @param plan DedispersionPlan object
          * @param dmt DMtrails object resultant DM-Time data
+         * @param work_area the scratch space holding this chunk's input data
          */
         DdtrProcessor( std::shared_ptr<DedispersionPlanType> plan
                      , std::shared_ptr<DmTrialsType> dmt
+                     , std::shared_ptr<WorkAreaType> work_area
                      );
 
         /**
@@ -84,6 +87,7 @@ class DdtrProcessor
     private:
         std::shared_ptr<DedispersionPlanType> _plan;
         std::shared_ptr<DmTrialsType> _dm_trials_ptr;
+        std::shared_ptr<WorkAreaType> _work_area;
         std::size_t _current_dm_range;
         std::size_t _total_number_of_dms;
 };
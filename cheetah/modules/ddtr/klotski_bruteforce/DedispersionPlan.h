@@ -27,7 +27,9 @@
 #include "cheetah/modules/ddtr/klotski_bruteforce/Config.h"
 #include "cheetah/modules/ddtr/klotski_bruteforce/detail/DedispersionStrategy.h"
 #include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/modules/ddtr/detail/DmTrialsRing.h"
 #include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/LatencyMonitor.h"
 
 namespace ska {
 namespace cheetah {
@@ -94,9 +96,22 @@ class DedispersionPlan
         std::shared_ptr<DedispersionStrategyType> const& dedispersion_strategy() const;
 
         /**
-         * @brief returns pointer to the DmTrials object
+         * @brief the preallocated DmTrials objects to dedisperse into
          */
-        std::shared_ptr<DmTrialsType> const& dm_trials();
+        DmTrialsRing<DmTrialsType>& dm_trials_ring();
+
+        /**
+         * @brief the id of the beam this plan was created for
+         */
+        std::string const& beam_id() const
+        {
+            return _beam_config.id();
+        }
+
+        /**
+         * @brief the latency histogram for the dedispersion of a whole chunk
+         */
+        utils::LatencyHistogram& ddtr_latency();
 
     private:
         BeamConfigType const& _beam_config;
@@ -108,7 +123,8 @@ class DedispersionPlan
         std::size_t _dedispersion_samples;
         std::vector<double> _dm_factors;
         std::size_t _number_of_spectra;
-        std::shared_ptr<DmTrialsType> _dm_trials_ptr;
+        DmTrialsRing<DmTrialsType> _dm_trials_ring;
+        utils::LatencyHistogram& _ddtr_latency;
 };
 
 } // namespace klotski_bruteforce
@@ -0,0 +1,238 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/klotski_bruteforce/detail/DedispersionStrategy.h"
+#include "cheetah/modules/ddtr/Config.h"
+#include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/benchmark_utils/KernelBenchmark.h"
+#include <pss/astrotypes/units/Units.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * Micro benchmarks for the klotski_bruteforce dedispersion kernels.
+ *
+ * The dedispersion benchmark drives a single klotski of the first band for the first dm range
+ * exactly as subanded_dedisperse does, either replacing (flag 0, the first klotski of a subband)
+ * or accumulating into (flag 1, every later klotski) the subanded dm trials. The reported
+ * ops_per_cycle refers to one (dm, channel, sample) accumulation per op. The integrate benchmark
+ * sums the subanded trials of every band into the final dm trials, one (dm, band, sample)
+ * addition per op.
+ */
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+namespace klotski_bruteforce {
+
+void dedisperse_klotski_bruteforce( std::size_t nchans
+                       , std::size_t ksamps
+                       , std::size_t tsamps
+                       , std::size_t dsamps
+                       , std::size_t ndms
+                       , const float* dm_shifts
+                       , const unsigned int* start_dm_shifts
+                       , unsigned short* data_in
+                       , int* data_temp
+                       , std::size_t flag
+                       );
+
+void integrate_klotski_bruteforce( float* data_out
+                      , std::vector<utils::HugePageVector<int>>& data_temp
+                      , std::size_t number_of_channels
+                      , std::size_t number_of_elements
+                      , std::size_t dm_index
+                      );
+
+namespace benchmark {
+
+namespace {
+
+typedef uint8_t NumericRep;
+typedef DedispersionStrategy<NumericRep> StrategyType;
+
+bool avx512_supported()
+{
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+
+/**
+ * @brief a strategy for a synthetic chunk of the requested size with a single dm range
+ */
+std::unique_ptr<StrategyType> make_strategy(unsigned number_of_channels
+                                          , unsigned channels_per_klotski
+                                          , unsigned number_of_dms
+                                          , unsigned number_of_samples)
+{
+    data::TimeFrequency<Cpu, NumericRep> tf{data::DimensionSize<data::Time>(number_of_samples)
+                                          , data::DimensionSize<data::Frequency>(number_of_channels)};
+    tf.set_channel_frequencies_const_width(data::FrequencyType(1670.0 * data::megahertz)
+                                          , data::FrequencyType((-300.0/number_of_channels) * data::megahertz));
+    tf.sample_interval(64e-6 * data::second);
+
+    ddtr::Config config;
+    config.dedispersion_samples(number_of_samples);
+    config.add_dm_range(0 * data::parsecs_per_cube_cm
+                       , 0.1 * number_of_dms * data::parsecs_per_cube_cm
+                       , 0.1 * data::parsecs_per_cube_cm);
+    config.klotski_bruteforce_algo_config().max_channels_per_klotski_bruteforce(channels_per_klotski);
+
+    return std::unique_ptr<StrategyType>(new StrategyType(tf, config, std::size_t(4)*1024*1024*1024));
+}
+
+} // namespace
+
+/**
+ * Arguments: {number of channels, max channels per klotski, number of dms, number of samples, flag}
+ */
+static void BM_nasm_klotski_bruteforce(::benchmark::State& state)
+{
+    if(!avx512_supported()) {
+        state.SkipWithError("nasm_dedisperse_klotski_bruteforce requires AVX-512");
+        return;
+    }
+
+    unsigned const number_of_dms = static_cast<unsigned>(state.range(2));
+    std::size_t const flag = static_cast<std::size_t>(state.range(4));
+    auto strategy = make_strategy(static_cast<unsigned>(state.range(0))
+                                , static_cast<unsigned>(state.range(1))
+                                , number_of_dms
+                                , static_cast<unsigned>(state.range(3)));
+
+    auto work_area = strategy->acquire_work_area();
+    auto& data_in = *work_area->temp_work_area();
+    std::size_t i=0;
+    std::generate(data_in.begin(), data_in.end(), [&i]() { return static_cast<unsigned short>(i++ % 127); });
+    auto& data_temp = (*work_area->subanded_dm_trials())[0];
+
+    // the first dm range shifts, as DdtrProcessor::operator++ computes them
+    unsigned const dm_range = 0;
+    std::vector<float> dm_shifts(strategy->nchans());
+    for(unsigned int c=0; c < strategy->nchans(); ++c) {
+        dm_shifts[c] = strategy->dmshifts()[c] * strategy->dm_step()[dm_range].value();
+    }
+    auto const& start_dm_shifts = strategy->start_dmshifts()[dm_range];
+    unsigned const channels = strategy->kloskis_per_band()[dm_range][0][0];
+    std::size_t const tsamps = strategy->nsamps();
+    std::size_t const dsamps = strategy->dedispersed_samples();
+    std::size_t const ndms = strategy->ndms()[dm_range];
+
+    // ksamps as subanded_dedisperse chooses it for the first klotski
+    std::size_t ksamps = std::ceil(dm_shifts[channels-1]*ndms/1024.0)*1024;
+    if(ksamps%32!=0) ksamps += 32-ksamps%32;
+
+    for(auto _ : state) {
+        dedisperse_klotski_bruteforce(channels
+                                     , ksamps
+                                     , tsamps
+                                     , dsamps
+                                     , ndms
+                                     , dm_shifts.data()
+                                     , start_dm_shifts.data()
+                                     , &*data_in.begin()
+                                     , &*data_temp.begin()
+                                     , flag);
+        ::benchmark::ClobberMemory();
+    }
+
+    std::size_t const ops = ndms * channels * dsamps;
+    utils::benchmark_utils::set_kernel_counters(state
+                                              , channels * tsamps * sizeof(unsigned short) + (flag + 1) * ndms * dsamps * sizeof(int)
+                                              , ops);
+}
+
+/**
+ * Arguments: {number of channels, max channels per klotski, number of dms, number of samples}
+ */
+static void BM_nasm_integrate_klotski_bruteforce(::benchmark::State& state)
+{
+    if(!avx512_supported()) {
+        state.SkipWithError("nasm_integrate_klotski_bruteforce requires AVX-512");
+        return;
+    }
+
+    auto strategy = make_strategy(static_cast<unsigned>(state.range(0))
+                                , static_cast<unsigned>(state.range(1))
+                                , static_cast<unsigned>(state.range(2))
+                                , static_cast<unsigned>(state.range(3)));
+
+    auto work_area = strategy->acquire_work_area();
+    auto& data_temp = *work_area->subanded_dm_trials();
+    for(auto& band : data_temp) {
+        std::size_t i=0;
+        std::generate(band.begin(), band.end(), [&i]() { return static_cast<int>(i++ % 1021); });
+    }
+
+    unsigned const dm_range = 0;
+    std::size_t const ndms = strategy->ndms()[dm_range];
+    std::size_t const dsamps = strategy->dedispersed_samples();
+    std::vector<std::vector<float>> data_out(ndms, std::vector<float>(dsamps, 0.0f));
+
+    for(auto _ : state) {
+        for(std::size_t dmidx=0; dmidx < ndms; ++dmidx) {
+            integrate_klotski_bruteforce(data_out[dmidx].data(), data_temp, strategy->nchans(), dsamps, dmidx);
+        }
+        ::benchmark::ClobberMemory();
+    }
+
+    std::size_t const ops = ndms * data_temp.size() * dsamps;
+    utils::benchmark_utils::set_kernel_counters(state, ops * sizeof(int) + ndms * dsamps * sizeof(float), ops);
+}
+
+static void dedispersion_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"channels", "channels_per_klotski", "dms", "samples", "accumulate"});
+    for(int64_t flag : {0, 1}) {
+        for(int64_t channels_per_klotski : {16, 32, 64}) {
+            for(int64_t dms : {256, 1024}) {
+                b->Args({4096, channels_per_klotski, dms, 1<<14, flag});
+            }
+        }
+    }
+    b->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+
+static void integrate_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"channels", "channels_per_klotski", "dms", "samples"});
+    for(int64_t dms : {256, 1024}) {
+        b->Args({4096, 64, dms, 1<<14});
+    }
+    b->Unit(::benchmark::kMillisecond)->UseRealTime();
+}
+
+BENCHMARK(BM_nasm_klotski_bruteforce)->Apply(dedispersion_sweep);
+BENCHMARK(BM_nasm_integrate_klotski_bruteforce)->Apply(integrate_sweep);
+
+} // namespace benchmark
+} // namespace klotski_bruteforce
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+
+CHEETAH_KERNEL_BENCHMARK_MAIN()
@@ -48,8 +48,13 @@ template<typename DdtrTraits>
 template<typename CallBackT>
 std::shared_ptr<typename Ddtr<DdtrTraits>::DmTrialsType> Ddtr<DdtrTraits>::operator()(panda::PoolResource<cheetah::Cpu>&, std::shared_ptr<BufferType> data, CallBackT const& call_back)
 {
-    std::lock_guard<std::mutex> lk(_mutex);
-    return _worker(data, _plan, call_back);
+    std::shared_ptr<DedispersionPlan> plan;
+    {
+        std::lock_guard<std::mutex> lk(_mutex);
+        plan = _plan;
+    }
+    // each call has its own work area and DmTrials slot so successive chunks may be dedispersed concurrently
+    return _worker(data, plan, call_back);
 }
 
 template<typename DdtrTraits>
@@ -61,7 +66,9 @@ std::shared_ptr<typename Ddtr<DdtrTraits>::DmTrialsType> Ddtr<DdtrTraits>::opera
 template<typename DdtrTraits>
 void Ddtr<DdtrTraits>::plan(DedispersionPlan const& plan)
 {
-    _plan = std::make_shared<DedispersionPlan>(plan);
+    auto new_plan = std::make_shared<DedispersionPlan>(plan);
+    std::lock_guard<std::mutex> lk(_mutex);
+    _plan = std::move(new_plan);
 }
 
 } // namespace klotski_bruteforce
@@ -37,12 +37,12 @@ void threaded_dedispersion(std::vector<std::vector<unsigned int>> const& channel
                        , std::size_t NDMS
                        , std::vector<float> const& dm_shifts
                        , std::vector<unsigned int> const& start_dm_shifts
-                       , std::vector<unsigned short>& data_in
-                       , std::vector<std::vector<int>>& data_temp
+                       , utils::HugePageVector<unsigned short>& data_in
+                       , std::vector<utils::HugePageVector<int>>& data_temp
                        );
 
 void integrate_klotski_bruteforce( float* data_out
-                      , std::vector<std::vector<int>>& data_temp
+                      , std::vector<utils::HugePageVector<int>>& data_temp
                       , std::size_t number_of_channels
                       , std::size_t number_of_elements
                       , std::size_t offset
@@ -51,9 +51,11 @@ void integrate_klotski_bruteforce( float* data_out
 template<typename DdtrTraits>
 DdtrProcessor<DdtrTraits>::DdtrProcessor(std::shared_ptr<DedispersionPlanType> plan
                                         , std::shared_ptr<DmTrialsType> dm_trials_ptr
+                                        , std::shared_ptr<WorkAreaType> work_area
                             )
     : _plan(plan)
     , _dm_trials_ptr(dm_trials_ptr)
+    , _work_area(std::move(work_area))
     , _current_dm_range(0)
     , _total_number_of_dms(0)
 {
@@ -95,13 +97,13 @@ DdtrProcessor<DdtrTraits>& DdtrProcessor<DdtrTraits>::operator++()
                        , _plan->dedispersion_strategy()->ndms()[_current_dm_range]
                        , dm_shifts
                        , _plan->dedispersion_strategy()->start_dmshifts()[_current_dm_range]
-                       , *_plan->dedispersion_strategy()->temp_work_area()
-                       , *_plan->dedispersion_strategy()->subanded_dm_trials()
+                       , *_work_area->temp_work_area()
+                       , *_work_area->subanded_dm_trials()
                        );
 
     for(std::size_t dmidx=0; dmidx<_plan->dedispersion_strategy()->ndms()[_current_dm_range]; ++dmidx)
     integrate_klotski_bruteforce((&*((*_dm_trials_ptr)[dmidx+_total_number_of_dms].begin()))
-                     , *_plan->dedispersion_strategy()->subanded_dm_trials()
+                     , *_work_area->subanded_dm_trials()
                      , _plan->dedispersion_strategy()->nchans()
                      , ((*_dm_trials_ptr)[dmidx+_total_number_of_dms].size())
                      , dmidx
@@ -26,6 +26,7 @@
 #include "cheetah/corner_turn/CornerTurn.h"
 #include "cheetah/data/FrequencyTime.h"
 #include "cheetah/data/TimeSeries.h"
+#include "cheetah/utils/LatencyMonitor.h"
 #include <iostream>
 namespace ska {
 namespace cheetah {
@@ -47,7 +48,7 @@ std::shared_ptr<typename DdtrWorker<DdtrTraits>::DmTrialsType> DdtrWorker<DdtrTr
                                                                     , std::shared_ptr<DedispersionPlan<DdtrTraits>> plan
                                                                     , CallBackT const& call_back)
 {
-    auto ddtr_start = std::chrono::high_resolution_clock::now();
+    utils::ScopedLatency timer(plan->ddtr_latency());
 
     if (agg_buf->capacity() < (std::size_t) plan->dedispersion_strategy()->maxshift())
     {
@@ -57,23 +58,26 @@ std::shared_ptr<typename DdtrWorker<DdtrTraits>::DmTrialsType> DdtrWorker<DdtrTr
     }
 
 
-    plan->dm_trials()->start_time(agg_buf->start_time());
+    // ownership of the slot passes downstream with the returned pointer
+    auto dmtrials_ptr = plan->dm_trials_ring().acquire();
+    dmtrials_ptr->start_time(agg_buf->start_time());
 
-    panda::copy(agg_buf->begin(), agg_buf->end(), plan->dedispersion_strategy()->temp_work_area()->begin());
-    std::fill(plan->dedispersion_strategy()->temp_work_area()->begin(), plan->dedispersion_strategy()->temp_work_area()->end(), 0);
-    DdtrProcessor<DdtrTraits> ddtr(plan, plan->dm_trials());
+    // this chunk's own scratch space, so chunks can be dedispersed concurrently
+    auto work_area = plan->dedispersion_strategy()->acquire_work_area();
+    // widens to the work area type. If the corner turn is deferred this is the only copy, straight from the incoming chunks
+    agg_buf->copy_to(work_area->temp_work_area()->begin());
+    std::fill(work_area->temp_work_area()->begin(), work_area->temp_work_area()->end(), 0);
+    DdtrProcessor<DdtrTraits> ddtr(plan, dmtrials_ptr, std::move(work_area));
 
     while(!ddtr.finished())
     {
         ++ddtr;
     }
 
-    DmTrialsType& dmtrials = *(plan->dm_trials());
+    DmTrialsType& dmtrials = *dmtrials_ptr;
     call_back(dmtrials, plan->dedispersion_strategy()->ndms());
-    auto ddtr_stop = std::chrono::high_resolution_clock::now();
-    PANDA_LOG<<" Ddtr time: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(ddtr_stop - ddtr_start).count()/1000000.0<<" ms";
 
-    return plan->dm_trials();
+    return dmtrials_ptr;
 }
 
 } // namespace klotski_bruteforce
@@ -37,6 +37,7 @@ DedispersionPlan<DdtrTraits>::DedispersionPlan(BeamConfigType const& beam_config
     , _max_delay(0)
     , _dedispersion_samples(0)
     , _number_of_spectra(0)
+    , _ddtr_latency(utils::LatencyMonitor::instance().histogram("ddtr", beam_config.id()))
 {
 }
 
@@ -72,7 +73,7 @@ data::DimensionSize<data::Time> DedispersionPlan<DdtrTraits>::reset(TimeFrequenc
     _dedispersion_samples = _number_of_spectra-_max_delay;
     _dm_trial_metadata = this->generate_dmtrials_metadata(data.sample_interval(), _dedispersion_samples);
 
-    _dm_trials_ptr = DmTrialsType::make_shared(_dm_trial_metadata, data.start_time());
+    _dm_trials_ring.reset(_config.pipeline_depth(), _dm_trial_metadata, data.start_time());
 
     return data::DimensionSize<data::Time>(_number_of_spectra);
 }
@@ -128,9 +129,15 @@ std::shared_ptr<DedispersionStrategy<typename DedispersionPlan<DdtrTraits>::Nume
 }
 
 template <typename DdtrTraits>
-std::shared_ptr<typename DdtrTraits::DmTrialsType> const& DedispersionPlan<DdtrTraits>::dm_trials()
+DmTrialsRing<typename DdtrTraits::DmTrialsType>& DedispersionPlan<DdtrTraits>::dm_trials_ring()
 {
-    return _dm_trials_ptr;
+    return _dm_trials_ring;
+}
+
+template <typename DdtrTraits>
+utils::LatencyHistogram& DedispersionPlan<DdtrTraits>::ddtr_latency()
+{
+    return _ddtr_latency;
 }
 
 } // namespace klotski_bruteforce
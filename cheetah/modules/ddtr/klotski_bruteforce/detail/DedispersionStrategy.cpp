@@ -51,6 +51,7 @@ DedispersionStrategy<NumericalRep>::DedispersionStrategy(const data::TimeFrequen
     _dm_constant = config.dm_constant();
     _kchans = config.klotski_bruteforce_algo_config().max_channels_per_klotski_bruteforce();
     _cache_size = config.klotski_bruteforce_algo_config().cache_size();
+    _work_area_pages = config.klotski_bruteforce_algo_config().work_area_pages();
     unsigned int bin=0;
     for(auto it = config.begin_range(); it!=config.end_range(); ++it)
     {
@@ -269,10 +270,9 @@ void DedispersionStrategy<NumericalRep>::make_strategy(size_t const cpu_memory)
         throw panda::Error("Cpu is not compatible for the selected dedispersion plan");
     }
 
-    _temp_work_area = std::make_shared<std::vector<unsigned short>>(_nsamps*_nchans);
-
-    _subanded_dm_trials = std::make_shared<std::vector<std::vector<int>>>(_kloskis_per_band[0].size());
-    for(unsigned int i=0; i<_kloskis_per_band[0].size(); ++i) (*_subanded_dm_trials)[i].resize(_dedispersed_time_samples*(*std::max_element(_ndms.begin(), _ndms.end())));
+    // areas sized for the previous strategy are discarded as they are released
+    _work_areas = utils::ObjectPool<WorkArea>();
+    _work_areas.reserve(1, std::size_t(_nsamps)*_nchans, _kloskis_per_band[0].size(), _dedispersed_time_samples*(*std::max_element(_ndms.begin(), _ndms.end())), _work_area_pages);
 }
 
 template<typename NumericalRep>
@@ -282,17 +282,33 @@ data::DimensionSize<data::Time> DedispersionStrategy<NumericalRep>::dedispersed_
 }
 
 template <typename NumericalRep>
-std::shared_ptr<std::vector<std::vector<int>>> DedispersionStrategy<NumericalRep>::subanded_dm_trials()
+std::shared_ptr<typename DedispersionStrategy<NumericalRep>::WorkArea> DedispersionStrategy<NumericalRep>::acquire_work_area()
+{
+    return _work_areas.acquire(std::size_t(_nsamps)*_nchans, _kloskis_per_band[0].size(), _dedispersed_time_samples*(*std::max_element(_ndms.begin(), _ndms.end())), _work_area_pages);
+}
+
+template <typename NumericalRep>
+DedispersionStrategy<NumericalRep>::WorkArea::WorkArea(std::size_t work_area_size
+                                                      , std::size_t number_of_subbands
+                                                      , std::size_t subanded_dm_trials_size
+                                                      , utils::HugePagePolicy pages)
+    : _temp_work_area(std::make_shared<utils::HugePageVector<unsigned short>>(work_area_size, 0, utils::HugePageAllocator<unsigned short>(pages, "klotski_bruteforce work area")))
+    , _subanded_dm_trials(std::make_shared<std::vector<utils::HugePageVector<int>>>(number_of_subbands, utils::HugePageVector<int>(subanded_dm_trials_size, 0, utils::HugePageAllocator<int>(pages, "klotski_bruteforce subbanded dm trials"))))
 {
-    return _subanded_dm_trials;
 }
 
 template <typename NumericalRep>
-std::shared_ptr<std::vector<unsigned short>> DedispersionStrategy<NumericalRep>::temp_work_area()
+std::shared_ptr<utils::HugePageVector<unsigned short>> const& DedispersionStrategy<NumericalRep>::WorkArea::temp_work_area() const
 {
     return _temp_work_area;
 }
 
+template <typename NumericalRep>
+std::shared_ptr<std::vector<utils::HugePageVector<int>>> const& DedispersionStrategy<NumericalRep>::WorkArea::subanded_dm_trials() const
+{
+    return _subanded_dm_trials;
+}
+
 } // namespace klotski_bruteforce
 } // namespace ddtr
 } // namespace modules
@@ -29,6 +29,9 @@
 #include "cheetah/modules/ddtr/DedispersionTrialPlan.h"
 #include "cheetah/data/Units.h"
 #include "cheetah/data/TimeFrequency.h"
+#include "cheetah/utils/HugePageAllocator.h"
+#include "cheetah/utils/ObjectPool.h"
+#include <memory>
 
 namespace ska {
 namespace cheetah {
@@ -51,6 +54,36 @@ class DedispersionStrategy
         typedef boost::units::quantity<boost::units::si::time, double> TimeType;
         typedef std::vector<std::vector<std::vector<unsigned int>>> ArrayType;
 
+    public:
+        /**
+         * @brief the scratch space needed to dedisperse a single chunk
+         * @details each chunk in flight holds its own WorkArea so successive chunks can be
+         *          dedispersed concurrently without overwriting each other's intermediate data
+         */
+        class WorkArea
+        {
+            public:
+                WorkArea(std::size_t work_area_size
+                        , std::size_t number_of_subbands
+                        , std::size_t subanded_dm_trials_size
+                        , utils::HugePagePolicy pages);
+                WorkArea(WorkArea const&) = delete;
+
+                /**
+                 * @brief the transformed input data (FT ordered and widened)
+                 */
+                std::shared_ptr<utils::HugePageVector<unsigned short>> const& temp_work_area() const;
+
+                /**
+                 * @brief the subbanded dedispersed data
+                 */
+                std::shared_ptr<std::vector<utils::HugePageVector<int>>> const& subanded_dm_trials() const;
+
+            private:
+                std::shared_ptr<utils::HugePageVector<unsigned short>> _temp_work_area;
+                std::shared_ptr<std::vector<utils::HugePageVector<int>>> _subanded_dm_trials;
+        };
+
     public:
         DedispersionStrategy(data::TimeFrequency<Cpu, NumericalRep> const& chunk
                             , ddtr::Config const& config
@@ -156,14 +189,11 @@ class DedispersionStrategy
         void resize(size_t const number_of_samples, size_t const cpu_memory);
 
         /**
-         * @brief return pointer to temp_work_area which hold the intermediate results mostly the FT data
-         */
-        std::shared_ptr<std::vector<unsigned short>> temp_work_area();
-
-        /**
-         * @brief returns pointer to subanded_dm_trials shich holds the subbanded dedispersed data
+         * @brief take a work area for the dedispersion of one chunk
+         * @details the area returns to the strategy when released. One area is preallocated,
+         *          further ones are only allocated when chunks are dedispersed concurrently.
          */
-        std::shared_ptr<std::vector<std::vector<int>>> subanded_dm_trials();
+        std::shared_ptr<WorkArea> acquire_work_area();
 
     private:
         /**
@@ -174,8 +204,7 @@ class DedispersionStrategy
     private:
         std::size_t _cpu_memory;
         ArrayType _kloskis_per_band;
-        std::shared_ptr<std::vector<unsigned short>> _temp_work_area;
-        std::shared_ptr<std::vector<std::vector<int>>> _subanded_dm_trials;
+        utils::ObjectPool<WorkArea> _work_areas; // one per chunk being dedispersed
         unsigned int _number_of_dm_ranges;
         std::vector<Dm> _dm_low;
         std::vector<Dm> _dm_high;
@@ -189,6 +218,7 @@ class DedispersionStrategy
         Dm _max_dm;
         TimeType _tsamp;
         unsigned int _cache_size;
+        utils::HugePagePolicy _work_area_pages;
         unsigned int _nsamps;
         unsigned int _nchans;
         unsigned int _kchans;
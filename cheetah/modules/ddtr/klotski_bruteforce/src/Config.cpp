@@ -36,6 +36,7 @@ Config::Config()
     , _active(false)
     , _cache_size(1024*1024)
     , _max_channels_per_klotski_bruteforce(512)
+    , _work_area_pages(utils::HugePagePolicy::None)
 {
 }
 
@@ -54,7 +55,10 @@ void Config::add_options(OptionsDescriptionEasyInit& add_options)
     , "cache size per core available for the klotski_bruteforce")
     ("max_channels_per_klotski_bruteforce"
     , boost::program_options::value<std::size_t>(&_max_channels_per_klotski_bruteforce)->default_value(_max_channels_per_klotski_bruteforce)
-    , "upper limit on number of channels to use per klotski_bruteforce");
+    , "upper limit on number of channels to use per klotski_bruteforce")
+    ("work_area_pages"
+    , boost::program_options::value<std::string>()->default_value(utils::to_string(_work_area_pages))->notifier([this](std::string const& v) { _work_area_pages = utils::huge_page_policy(v); })
+    , "the pages to back the dedispersion work areas with (none, transparent, 2MB, 1GB). Falls back to smaller pages if unavailable");
 }
 
 bool Config::active() const
@@ -87,6 +91,16 @@ void Config::cache_size(unsigned int value)
     _cache_size = value;
 }
 
+utils::HugePagePolicy Config::work_area_pages() const
+{
+    return _work_area_pages;
+}
+
+void Config::work_area_pages(utils::HugePagePolicy policy)
+{
+    _work_area_pages = policy;
+}
+
 } // namespace klotski_bruteforce
 } // namespace ddtr
 } // namespace modules
@@ -1,3 +1,4 @@
+#include "cheetah/utils/HugePageAllocator.h"
 #include <iostream>
 #include <vector>
 #include <array>
@@ -62,7 +63,7 @@ extern "C" void nasm_downsample_klotski_bruteforce(unsigned short *data
  */
 
 void integrate_klotski_bruteforce( float* data_out
-                      , std::vector<std::vector<int>>& data_temp
+                      , std::vector<utils::HugePageVector<int>>& data_temp
                       , std::size_t number_of_channels
                       , std::size_t number_of_elements
                       , std::size_t dm_index
@@ -230,8 +231,8 @@ void threaded_dedispersion(std::vector<std::vector<unsigned int>> const& channel
                        , std::size_t ndms
                        , std::vector<float> const& dm_shifts
                        , std::vector<unsigned int> const& start_dm_shifts
-                       , std::vector<unsigned short>& data_in
-                       , std::vector<std::vector<int>>& data_temp
+                       , utils::HugePageVector<unsigned short>& data_in
+                       , std::vector<utils::HugePageVector<int>>& data_temp
                        )
 {
     std::vector<std::thread> ddtr_threads;
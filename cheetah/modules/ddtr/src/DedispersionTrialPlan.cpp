@@ -40,6 +40,13 @@ DedispersionTrialPlan::DedispersionTrialPlan(std::string const& tag_name)
     , _dm_constant(data::dm_constant::s_mhz::dm_constant)
     , _max_dm(0.0 * data::parsecs_per_cube_cm)
     , _dedispersion_samples(0) // should be set in the config
+    , _pipeline_depth(2)
+    , _aggregation_buffer_pages(utils::HugePagePolicy::None)
+    , _aggregation_ring_depth(0)
+    , _corner_turn_threads(1)
+    , _defer_corner_turn(false)
+    , _adaptive_downsampling(false)
+    , _downsampling_tolerance(1.0)
 {
     add_factory(dedispersion_tag(), []()
     {
@@ -56,6 +63,20 @@ void DedispersionTrialPlan::add_options(OptionsDescriptionEasyInit& add_options)
     add_options
     ("dedispersion_samples", boost::program_options::value<std::size_t>(&_dedispersion_samples)->
         default_value(_dedispersion_samples), "the maximum number of samples to process in each call to the dedisperser (may be less depending on chosen algorithm constraints)")
+    ("pipeline_depth", boost::program_options::value<std::size_t>(&_pipeline_depth)->
+        default_value(_pipeline_depth), "the number of dedispersed chunks that can be in flight downstream before the dedispersion of the next chunk has to wait for one to be released")
+    ("aggregation_buffer_pages", boost::program_options::value<std::string>()->default_value(utils::to_string(_aggregation_buffer_pages))->notifier([this](std::string const& v) { _aggregation_buffer_pages = utils::huge_page_policy(v); })
+        , "the pages to back the dedispersion input buffers with (none, transparent, 2MB, 1GB). Falls back to smaller pages if unavailable")
+    ("aggregation_ring_depth", boost::program_options::value<std::size_t>(&_aggregation_ring_depth)->
+        default_value(_aggregation_ring_depth), "if non zero the dedispersion input buffers are windows onto a ring long enough for at least this many buffers, sharing the overlap between consecutive buffers in place rather than copying it")
+    ("corner_turn_threads", boost::program_options::value<unsigned>(&_corner_turn_threads)->
+        default_value(_corner_turn_threads), "the number of threads used to corner turn the incoming data into the dedispersion input buffers. The threads are started once and reused for each chunk")
+    ("defer_corner_turn", boost::program_options::value<bool>(&_defer_corner_turn)->
+        default_value(_defer_corner_turn), "keep references to the incoming chunks rather than corner turning them into the dedispersion input buffers. The klotski algorithms then corner turn (and widen) the data straight into their work areas")
+    ("adaptive_downsampling", boost::program_options::value<bool>(&_adaptive_downsampling)->
+        default_value(_adaptive_downsampling), "match the downsampling factor of each dm range to the smearing expected in that range rather than doubling it for each consecutive range")
+    ("downsampling_tolerance", boost::program_options::value<double>(&_downsampling_tolerance)->
+        default_value(_downsampling_tolerance), "with adaptive_downsampling, the fraction of the expected smearing the downsampled sample interval may reach")
     ("dm_constant", boost::program_options::value<double>()->default_value(_dm_constant.value())->notifier([this](double v) { _dm_constant = v * data::dm_constant::s_mhz_squared_cm_cubed_per_pc; }), "the dedispersion constant to use (in MHz^2 sec cm^3 per parsec");
 }
 
@@ -75,7 +96,7 @@ std::vector<std::pair<DedispersionTrialPlan::Dm, unsigned>> const& DedispersionT
                count++;
             }
             _number_of_dms.push_back(count);
-            df = 1<<df;
+            df <<= 1;
             ++it;
         }
     }
@@ -112,6 +133,71 @@ std::shared_ptr<data::DmTrialsMetadata> DedispersionTrialPlan::generate_dmtrials
     return meta_data;
 }
 
+std::shared_ptr<data::DmTrialsMetadata> DedispersionTrialPlan::generate_dmtrials_metadata(TimeType sample_interval, std::size_t nspectra, std::size_t overlap, DownsamplingPlan const& downsampling) const
+{
+    if (nspectra < overlap) {
+        panda::Error e("Overlap exceeds number of spectra: ");
+        e << overlap << " > " << nspectra;
+        throw e;
+    }
+    auto const& trials = dm_trials();
+    if (downsampling.size() != _number_of_dms.size()) {
+        panda::Error e("DownsamplingPlan does not match the number of dm ranges: ");
+        e << downsampling.size() << " != " << _number_of_dms.size();
+        throw e;
+    }
+    std::shared_ptr<data::DmTrialsMetadata> meta_data(new data::DmTrialsMetadata(sample_interval, nspectra - overlap));
+    std::size_t dm_idx = 0;
+    for (std::size_t range = 0; range < _number_of_dms.size(); ++range)
+    {
+        for (std::size_t i = 0; i < _number_of_dms[range]; ++i, ++dm_idx)
+        {
+            meta_data->emplace_back(trials[dm_idx].first, downsampling.factor(range));
+        }
+    }
+    return meta_data;
+}
+
+DownsamplingPlan DedispersionTrialPlan::downsampling_plan(TimeType sample_interval, FrequencyType freq_low, FrequencyType freq_high, std::size_t number_of_channels, std::size_t number_of_samples) const
+{
+    dm_trials();
+    if (!_adaptive_downsampling) return DownsamplingPlan(_number_of_dms.size());
+
+    std::vector<DownsamplingPlan::Range> ranges;
+    for (auto it = begin_range(); it != end_range(); ++it)
+    {
+        ranges.push_back(DownsamplingPlan::Range{it->dm_start().value(), it->dm_end().value(), it->dm_step().value()});
+    }
+    return DownsamplingPlan(sample_interval.value()
+                           , freq_low.value()
+                           , freq_high.value()
+                           , number_of_channels
+                           , ranges
+                           , _dm_constant.value()
+                           , _downsampling_tolerance
+                           , number_of_samples);
+}
+
+bool DedispersionTrialPlan::adaptive_downsampling() const
+{
+    return _adaptive_downsampling;
+}
+
+void DedispersionTrialPlan::adaptive_downsampling(bool enable)
+{
+    _adaptive_downsampling = enable;
+}
+
+double DedispersionTrialPlan::downsampling_tolerance() const
+{
+    return _downsampling_tolerance;
+}
+
+void DedispersionTrialPlan::downsampling_tolerance(double tolerance)
+{
+    _downsampling_tolerance = tolerance;
+}
+
 DedispersionTrialPlan::DmConstantType DedispersionTrialPlan::dm_constant() const
 {
     return _dm_constant;
@@ -154,6 +240,56 @@ void DedispersionTrialPlan::dedispersion_samples(std::size_t n)
     _dedispersion_samples = n;
 }
 
+std::size_t DedispersionTrialPlan::pipeline_depth() const
+{
+    return _pipeline_depth;
+}
+
+void DedispersionTrialPlan::pipeline_depth(std::size_t n)
+{
+    _pipeline_depth = n;
+}
+
+utils::HugePagePolicy DedispersionTrialPlan::aggregation_buffer_pages() const
+{
+    return _aggregation_buffer_pages;
+}
+
+void DedispersionTrialPlan::aggregation_buffer_pages(utils::HugePagePolicy policy)
+{
+    _aggregation_buffer_pages = policy;
+}
+
+std::size_t DedispersionTrialPlan::aggregation_ring_depth() const
+{
+    return _aggregation_ring_depth;
+}
+
+void DedispersionTrialPlan::aggregation_ring_depth(std::size_t depth)
+{
+    _aggregation_ring_depth = depth;
+}
+
+unsigned DedispersionTrialPlan::corner_turn_threads() const
+{
+    return _corner_turn_threads;
+}
+
+void DedispersionTrialPlan::corner_turn_threads(unsigned number_of_threads)
+{
+    _corner_turn_threads = number_of_threads;
+}
+
+bool DedispersionTrialPlan::defer_corner_turn() const
+{
+    return _defer_corner_turn;
+}
+
+void DedispersionTrialPlan::defer_corner_turn(bool defer)
+{
+    _defer_corner_turn = defer;
+}
+
 std::vector<std::size_t> const& DedispersionTrialPlan::number_of_dms() const
 {
     return _number_of_dms;
@@ -0,0 +1,120 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/DownsamplingPlan.h"
+#include "panda/Error.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+
+DownsamplingPlan::DownsamplingPlan(std::size_t number_of_ranges)
+    : _smearing(number_of_ranges, 0.0)
+{
+    unsigned factor = 1;
+    for(std::size_t range = 0; range < number_of_ranges; ++range)
+    {
+        _factors.push_back(factor);
+        factor <<= 1;
+    }
+}
+
+DownsamplingPlan::DownsamplingPlan(double sample_interval
+                                  , double freq_low
+                                  , double freq_high
+                                  , std::size_t number_of_channels
+                                  , std::vector<Range> const& ranges
+                                  , double dm_constant
+                                  , double tolerance
+                                  , std::size_t number_of_samples
+                                  )
+{
+    if(sample_interval <= 0.0 || number_of_channels == 0 || freq_high <= freq_low) {
+        panda::Error e("DownsamplingPlan: invalid observation parameters (tsamp=");
+        e << sample_interval << ", nchans=" << number_of_channels << ", band=" << freq_low << "-" << freq_high << ")";
+        throw e;
+    }
+
+    double const channel_width = (freq_high - freq_low)/number_of_channels;
+    double const freq_centre = 0.5 * (freq_high + freq_low);
+    double const band_delay = dm_constant * (1.0/(freq_low * freq_low) - 1.0/(freq_high * freq_high));
+
+    unsigned factor = 1;
+    for(auto const& range : ranges)
+    {
+        // dispersion within a single channel, and the worst case error from a trial half a step out
+        double const channel_smearing = 2.0 * dm_constant * range.dm_start * channel_width / (freq_centre * freq_centre * freq_centre);
+        double const step_smearing = 0.5 * range.dm_step * band_delay;
+        double const smearing = std::sqrt(channel_smearing * channel_smearing + step_smearing * step_smearing);
+        _smearing.push_back(smearing);
+
+        double target = std::floor(tolerance * smearing / sample_interval);
+        if(number_of_samples != 0) target = std::min(target, static_cast<double>(number_of_samples));
+        target = std::min(target, static_cast<double>(std::numeric_limits<unsigned>::max()));
+        if(target >= 2.0 * factor) {
+            // largest multiple of the previous factor not exceeding the target
+            unsigned multiple = static_cast<unsigned>(target) / factor;
+            if(number_of_samples != 0) {
+                while(multiple > 1 && number_of_samples % (factor * multiple) != 0) --multiple;
+            }
+            factor *= multiple;
+        }
+        _factors.push_back(factor);
+    }
+}
+
+std::size_t DownsamplingPlan::size() const
+{
+    return _factors.size();
+}
+
+std::vector<unsigned> const& DownsamplingPlan::factors() const
+{
+    return _factors;
+}
+
+unsigned DownsamplingPlan::factor(std::size_t range) const
+{
+    return _factors[range];
+}
+
+unsigned DownsamplingPlan::relative_factor(std::size_t range) const
+{
+    if(range == 0) return _factors[0];
+    return _factors[range]/_factors[range - 1];
+}
+
+double DownsamplingPlan::smearing(std::size_t range) const
+{
+    return _smearing[range];
+}
+
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
@@ -25,6 +25,7 @@
 #define SKA_CHEETAH_MODULES_DDTR_TEST_AGGREGATIONBUFFERTEST_H
 
 #include "cheetah/data/FrequencyTime.h"
+#include "cheetah/data/TimeFrequency.h"
 #include <gtest/gtest.h>
 
 namespace ska {
@@ -51,6 +52,7 @@ class AggregationBufferTest : public ::testing::Test
 
     public:
         typedef data::FrequencyTime<Cpu, float> FrequencyTimeType;
+        typedef data::TimeFrequency<Cpu, float> TimeFrequencyType;
 };
 
 
@@ -23,6 +23,8 @@
  */
 #include "cheetah/modules/ddtr/test/AggregationBufferFillerTest.h"
 #include "cheetah/modules/ddtr/detail/AggregationBufferFiller.h"
+#include "cheetah/data/TimeFrequency.h"
+#include <algorithm>
 
 namespace ska {
 namespace cheetah {
@@ -66,6 +68,175 @@ TEST_F(AggregationBufferFillerTest, test_buffer_handler_call)
     for(unsigned int i=0; i<49; ++i) buffer<<object;
 }
 
+namespace {
+// fill the block with values unique to each sample and channel
+void fill_block(AggregationBufferFillerTest::FrequencyTimeType& block, std::size_t first_sample)
+{
+    for(std::size_t channel=0; channel < block.number_of_channels(); ++channel)
+    {
+        for(std::size_t sample=0; sample < block.number_of_spectra(); ++sample)
+        {
+            *(block.begin() + channel * block.number_of_spectra() + sample) = (float)((first_sample + sample) * 10 + channel);
+        }
+    }
+}
+
+void verify_buffer(AggregationBuffer<float> const& buffer, std::size_t first_sample)
+{
+    for(unsigned channel=0; channel < buffer.number_of_channels(); ++channel)
+    {
+        auto it = buffer.cbegin(channel);
+        for(std::size_t sample=0; sample < buffer.number_of_spectra(); ++sample)
+        {
+            ASSERT_EQ((float)((first_sample + sample) * 10 + channel), *(it + sample)) << "channel=" << channel << " sample=" << sample;
+        }
+    }
+}
+} // namespace
+
+TEST_F(AggregationBufferFillerTest, test_ring_buffer_overlap_in_place)
+{
+    unsigned const number_of_channels = 3;
+    std::size_t const number_of_spectra = 100;
+    std::size_t const overlap = 30;
+    std::size_t const step = number_of_spectra - overlap;
+    std::size_t buffer_count = 0;
+    std::size_t in_place_count = 0;
+    std::shared_ptr<AggregationBuffer<float>> previous;
+    AggregationBufferFiller<float> filler([&](std::shared_ptr<AggregationBuffer<float>> buffer)
+                                          {
+                                              verify_buffer(*buffer, buffer_count * step);
+                                              ASSERT_EQ(number_of_spectra, buffer->data_size());
+                                              if(buffer_count != 0) {
+                                                  // all but the first buffer are windows onto the ring
+                                                  ASSERT_GT(buffer->frequency_stride(), number_of_spectra);
+                                              }
+                                              if(previous && previous->buffer() == buffer->buffer() && previous->offset() + step == buffer->offset()) {
+                                                  ++in_place_count;
+                                              }
+                                              ++buffer_count;
+                                              previous = buffer; // the older buffer is released
+                                          }
+                                          , number_of_spectra, number_of_channels);
+    filler.set_overlap(overlap);
+    filler.ring_depth(4);
+    ASSERT_EQ(4U, filler.ring_depth());
+
+    FrequencyTimeType block(data::DimensionSize<data::Frequency>(number_of_channels), data::DimensionSize<data::Time>(10));
+    std::size_t sample = 0;
+    while(buffer_count < 12)
+    {
+        fill_block(block, sample);
+        filler << block;
+        sample += block.number_of_spectra();
+    }
+
+    // a ring of 4 buffers: the overlap is copied only into the first buffer of each lap
+    ASSERT_EQ(8U, in_place_count);
+}
+
+TEST_F(AggregationBufferFillerTest, test_ring_buffer_in_use)
+{
+    // buffers still held downstream must not be overwritten
+    unsigned const number_of_channels = 2;
+    std::size_t const number_of_spectra = 40;
+    std::size_t const overlap = 10;
+    std::size_t const step = number_of_spectra - overlap;
+    std::vector<std::shared_ptr<AggregationBuffer<float>>> buffers;
+    AggregationBufferFiller<float> filler([&](std::shared_ptr<AggregationBuffer<float>> buffer)
+                                          {
+                                              buffers.push_back(buffer);
+                                          }
+                                          , number_of_spectra, number_of_channels);
+    filler.set_overlap(overlap);
+    filler.ring_depth(3);
+
+    FrequencyTimeType block(data::DimensionSize<data::Frequency>(number_of_channels), data::DimensionSize<data::Time>(10));
+    std::size_t sample = 0;
+    for(unsigned i=0; i < 60; ++i)
+    {
+        fill_block(block, sample);
+        filler << block;
+        sample += block.number_of_spectra();
+        if(i == 30) {
+            for(std::size_t j=0; j < buffers.size(); ++j) {
+                verify_buffer(*buffers[j], j * step);
+            }
+            // release all but the latest, allowing the ring to be reused
+            for(std::size_t j=0; j + 1 < buffers.size(); ++j) {
+                buffers[j].reset();
+            }
+        }
+    }
+    ASSERT_EQ((60U * 10U - overlap) / step, buffers.size());
+    for(std::size_t j=0; j < buffers.size(); ++j) {
+        if(buffers[j]) verify_buffer(*buffers[j], j * step);
+    }
+}
+
+TEST_F(AggregationBufferFillerTest, test_deferred_corner_turn)
+{
+    // the chunks are corner turned (and widened) straight into the reader's destination
+    typedef data::TimeFrequency<Cpu, uint8_t> TimeFrequencyType;
+    unsigned const number_of_channels = 5;
+    std::size_t const number_of_spectra = 40;
+    std::size_t const overlap = 20;
+    std::size_t const step = number_of_spectra - overlap;
+    std::size_t const chunk_spectra = 10;
+    std::size_t buffer_count = 0;
+    std::vector<std::weak_ptr<TimeFrequencyType>> chunks;
+    AggregationBufferFiller<uint8_t> filler([&](std::shared_ptr<AggregationBuffer<uint8_t>> buffer)
+                                            {
+                                                ASSERT_TRUE(buffer->deferred_corner_turn());
+                                                ASSERT_EQ(number_of_spectra, buffer->data_size());
+                                                ASSERT_EQ(0U, buffer->buffer()->size());
+
+                                                std::vector<uint16_t> work_area(number_of_spectra * number_of_channels);
+                                                buffer->copy_to(work_area.begin());
+                                                for(unsigned channel=0; channel < number_of_channels; ++channel)
+                                                {
+                                                    for(std::size_t sample=0; sample < number_of_spectra; ++sample)
+                                                    {
+                                                        std::size_t const spectrum = buffer_count * step + sample;
+                                                        ASSERT_EQ((spectrum * number_of_channels + channel) % 251, work_area[channel * number_of_spectra + sample])
+                                                            << "buffer=" << buffer_count << " channel=" << channel << " sample=" << sample;
+                                                    }
+                                                }
+
+                                                // as the cpu ddtr does when it needs the data laid out by channel
+                                                AggregationBuffer<uint8_t> contiguous(number_of_spectra, number_of_channels);
+                                                buffer->transfer(number_of_spectra, contiguous);
+                                                ASSERT_EQ(number_of_spectra, contiguous.data_size());
+                                                for(unsigned channel=0; channel < number_of_channels; ++channel)
+                                                {
+                                                    for(std::size_t sample=0; sample < number_of_spectra; ++sample)
+                                                    {
+                                                        ASSERT_EQ(work_area[channel * number_of_spectra + sample], *(contiguous.cbegin(channel) + sample));
+                                                    }
+                                                }
+                                                ++buffer_count;
+                                            }
+                                            , number_of_spectra, number_of_channels);
+    filler.set_overlap(overlap);
+    filler.defer_corner_turn(true);
+    ASSERT_TRUE(filler.defer_corner_turn());
+
+    // time major, so each element is numbered spectrum * number_of_channels + channel
+    std::size_t element = 0;
+    while(buffer_count < 6)
+    {
+        auto chunk = std::make_shared<TimeFrequencyType>(data::DimensionSize<data::Time>(chunk_spectra), data::DimensionSize<data::Frequency>(number_of_channels));
+        for(auto& value : *chunk) {
+            value = (element++) % 251;
+        }
+        chunks.push_back(chunk);
+        filler << chunk;
+    }
+
+    // only the chunks covering the overlap passed on to the next buffer are still referenced
+    std::size_t const held = std::count_if(chunks.begin(), chunks.end(), [](std::weak_ptr<TimeFrequencyType> const& c) { return !c.expired(); });
+    ASSERT_EQ(overlap / chunk_spectra, held);
+}
 
 } // namespace test
 } // namespace ddtr
@@ -23,6 +23,7 @@
  */
 #include "cheetah/modules/ddtr/test/AggregationBufferTest.h"
 #include "cheetah/modules/ddtr/detail/AggregationBuffer.h"
+#include <numeric>
 
 namespace ska {
 namespace cheetah {
@@ -66,6 +67,65 @@ TEST_F(AggregationBufferTest, test_buffer_handler_call)
     buffer.swap(buffer_temp);
 }
 
+TEST_F(AggregationBufferTest, test_insert_time_frequency)
+{
+    // spectra and channels deliberately not multiples of the corner turn tile size
+    unsigned const number_of_channels = 77;
+    unsigned const number_of_spectra = 300;
+    for(unsigned number_of_threads : {1U, 3U})
+    {
+        AggregationBuffer<float> buffer(700, number_of_channels);
+        buffer.corner_turn_threads(number_of_threads);
+        ASSERT_EQ(number_of_threads, buffer.corner_turn_threads());
+
+        TimeFrequencyType object{data::DimensionSize<data::Time>(number_of_spectra), data::DimensionSize<data::Frequency>(number_of_channels)};
+        // time major so the value is spectrum * number_of_channels + channel
+        std::iota(object.begin(), object.end(), 0.0f);
+
+        // third insert overflows the buffer and should be truncated
+        for(unsigned i=0; i<3; ++i) buffer.insert(object);
+        ASSERT_EQ(700U, buffer.data_size());
+        ASSERT_EQ(0U, buffer.remaining_capacity());
+
+        for(unsigned channel=0; channel < number_of_channels; ++channel)
+        {
+            auto it = buffer.cbegin(channel);
+            for(unsigned sample=0; sample < 700; ++sample)
+            {
+                ASSERT_EQ((float)((sample % number_of_spectra) * number_of_channels + channel), *(it + sample)) << "channel=" << channel << " sample=" << sample;
+            }
+        }
+    }
+}
+
+
+TEST_F(AggregationBufferTest, test_window_copy_to)
+{
+    // two consecutive windows onto a storage with rows of 10 samples, overlapping by 2 samples
+    unsigned const number_of_channels = 3;
+    auto storage = std::make_shared<AggregationBuffer<uint8_t>::StorageType>(10 * number_of_channels);
+    std::iota(storage->begin(), storage->end(), 0);
+    AggregationBuffer<uint8_t> first(storage, 0, 10, 6, number_of_channels);
+    AggregationBuffer<uint8_t> second(storage, 4, 10, 6, number_of_channels);
+    ASSERT_EQ(10U, second.frequency_stride());
+    ASSERT_EQ(4U, second.offset());
+
+    // the overlap is already in place, so transfer must leave the data untouched
+    first.transfer(2, second);
+    ASSERT_EQ(2U, second.data_size());
+    for(std::size_t i=0; i < storage->size(); ++i) ASSERT_EQ(i, (*storage)[i]);
+
+    // copy_to is contiguous and may widen
+    std::vector<uint16_t> contiguous(6 * number_of_channels);
+    second.copy_to(contiguous.begin());
+    for(unsigned channel=0; channel < number_of_channels; ++channel)
+    {
+        for(unsigned sample=0; sample < 6; ++sample)
+        {
+            ASSERT_EQ(channel * 10 + 4 + sample, contiguous[channel * 6 + sample]);
+        }
+    }
+}
 
 } // namespace test
 } // namespace ddtr
@@ -173,6 +173,51 @@ TEST_F(DedispersionTrialPlanTest, test_generate_dmtrials_metadata_no_exception)
     ASSERT_NO_THROW(plan.generate_dmtrials_metadata(tf.sample_interval(), nspectra, overlap));
 }
 
+TEST_F(DedispersionTrialPlanTest, test_dm_trials_downsampling_factors)
+{
+    DedispersionTrialPlan plan("test");
+    for(unsigned range=0; range < 4; ++range) {
+        plan.add_dm_range(range * 10 * data::parsecs_per_cube_cm, (range + 1) * 10 * data::parsecs_per_cube_cm, 5 * data::parsecs_per_cube_cm);
+    }
+    auto const& trials = plan.dm_trials();
+    ASSERT_EQ(8U, trials.size());
+    for(unsigned range=0; range < 4; ++range) {
+        ASSERT_EQ(1U << range, trials[2 * range].second);
+        ASSERT_EQ(1U << range, trials[2 * range + 1].second);
+    }
+}
+
+TEST_F(DedispersionTrialPlanTest, test_adaptive_downsampling_plan)
+{
+    typedef DedispersionTrialPlan::TimeType TimeType;
+    typedef DedispersionTrialPlan::FrequencyType FrequencyType;
+    DedispersionTrialPlan plan("test");
+    plan.add_dm_range(0 * data::parsecs_per_cube_cm, 100 * data::parsecs_per_cube_cm, 1 * data::parsecs_per_cube_cm);
+    plan.add_dm_range(100 * data::parsecs_per_cube_cm, 2000 * data::parsecs_per_cube_cm, 10 * data::parsecs_per_cube_cm);
+
+    TimeType tsamp(64.0 * boost::units::si::micro * boost::units::si::seconds);
+    FrequencyType low(1050.0 * boost::units::si::mega * boost::units::si::hertz);
+    FrequencyType high(1350.0 * boost::units::si::mega * boost::units::si::hertz);
+    std::size_t const nsamples = 3 * 16384;
+
+    ASSERT_FALSE(plan.adaptive_downsampling());
+    DownsamplingPlan fixed = plan.downsampling_plan(tsamp, low, high, 4096, nsamples);
+    ASSERT_EQ(std::vector<unsigned>({1, 2}), fixed.factors());
+
+    plan.adaptive_downsampling(true);
+    DownsamplingPlan adaptive = plan.downsampling_plan(tsamp, low, high, 4096, nsamples);
+    ASSERT_EQ(2U, adaptive.size());
+    ASSERT_GT(adaptive.factor(1), 2U);
+    ASSERT_EQ(0U, nsamples % adaptive.factor(1));
+
+    auto metadata = plan.generate_dmtrials_metadata(tsamp, nsamples + 1000, 1000, adaptive);
+    ASSERT_EQ(290U, metadata->size());
+    ASSERT_EQ(adaptive.factor(0), (*metadata)[0].downsampling_factor());
+    ASSERT_EQ(adaptive.factor(1), (*metadata)[289].downsampling_factor());
+
+    ASSERT_THROW(plan.generate_dmtrials_metadata(tsamp, nsamples + 1000, 1000, DownsamplingPlan(3)), panda::Error);
+}
+
 } // namespace test
 } // namespace ddtr
 } // namespace modules
@@ -0,0 +1,155 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/test/DmTrialsRingTest.h"
+#include "cheetah/modules/ddtr/detail/DmTrialsRing.h"
+#include "cheetah/data/DmTrials.h"
+#include <chrono>
+#include <thread>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+namespace test {
+
+
+DmTrialsRingTest::DmTrialsRingTest()
+    : ::testing::Test()
+{
+}
+
+DmTrialsRingTest::~DmTrialsRingTest()
+{
+}
+
+void DmTrialsRingTest::SetUp()
+{
+}
+
+void DmTrialsRingTest::TearDown()
+{
+}
+
+namespace {
+    typedef data::DmTrials<Cpu, float> DmTrialsType;
+
+    std::shared_ptr<data::DmTrialsMetadata> test_metadata()
+    {
+        auto metadata = data::DmTrialsMetadata::make_shared(data::DmTrialsMetadata::TimeType(0.000064 * data::seconds), 64);
+        metadata->emplace_back(DmTrialsType::DmType(0.0 * data::parsecs_per_cube_cm), 1);
+        metadata->emplace_back(DmTrialsType::DmType(10.0 * data::parsecs_per_cube_cm), 2);
+        return metadata;
+    }
+} // namespace
+
+TEST_F(DmTrialsRingTest, test_slots_are_distinct_and_recycled)
+{
+    DmTrialsRing<DmTrialsType> ring;
+    ring.reset(2, test_metadata(), utils::ModifiedJulianClock::now());
+    ASSERT_EQ(2U, ring.depth());
+    ASSERT_EQ(2U, ring.available());
+
+    DmTrialsType* first_address = nullptr;
+    {
+        auto first = ring.acquire();
+        auto second = ring.acquire();
+        ASSERT_NE(first.get(), second.get());
+        ASSERT_EQ(0U, ring.available());
+        first_address = first.get();
+    }
+    // both released back to the ring
+    ASSERT_EQ(2U, ring.available());
+    ASSERT_EQ(0U, ring.wait_count());
+
+    auto recycled = ring.acquire();
+    auto other = ring.acquire();
+    ASSERT_TRUE(recycled.get() == first_address || other.get() == first_address);
+}
+
+TEST_F(DmTrialsRingTest, test_exhausted_ring_waits_for_release)
+{
+    DmTrialsRing<DmTrialsType> ring;
+    ring.reset(1, test_metadata(), utils::ModifiedJulianClock::now());
+
+    auto in_flight = ring.acquire();
+    DmTrialsType* const slot_address = in_flight.get();
+    std::thread consumer([&in_flight]()
+                         {
+                             std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                             in_flight.reset();
+                         });
+    auto next = ring.acquire(); // must block until the consumer is done, never alias the in flight slot
+    consumer.join();
+    ASSERT_EQ(slot_address, next.get());
+    ASSERT_EQ(1U, ring.wait_count());
+    ASSERT_EQ(0U, ring.available());
+
+    next.reset();
+    ASSERT_EQ(1U, ring.available());
+}
+
+TEST_F(DmTrialsRingTest, test_exhausted_ring_times_out)
+{
+    DmTrialsRing<DmTrialsType> ring;
+    ring.reset(1, test_metadata(), utils::ModifiedJulianClock::now());
+    ring.acquire_timeout(std::chrono::milliseconds(10));
+    ASSERT_EQ(std::chrono::milliseconds(10), ring.acquire_timeout());
+
+    auto in_flight = ring.acquire();
+    ASSERT_THROW(ring.acquire(), panda::Error);
+    ASSERT_EQ(1U, ring.wait_count());
+
+    // the ring is still usable once the slot is released
+    in_flight.reset();
+    auto recycled = ring.acquire();
+    ASSERT_TRUE(static_cast<bool>(recycled));
+}
+
+TEST_F(DmTrialsRingTest, test_reset_with_slots_in_flight)
+{
+    DmTrialsRing<DmTrialsType> ring;
+    ring.reset(2, test_metadata(), utils::ModifiedJulianClock::now());
+    auto in_flight = ring.acquire();
+    in_flight->start_time(utils::ModifiedJulianClock::now());
+
+    ring.reset(3, test_metadata(), utils::ModifiedJulianClock::now());
+    ASSERT_EQ(3U, ring.depth());
+    ASSERT_EQ(3U, ring.available());
+
+    in_flight.reset(); // returns to the old (discarded) slots
+    ASSERT_EQ(3U, ring.available());
+}
+
+TEST_F(DmTrialsRingTest, test_acquire_before_reset_throws)
+{
+    DmTrialsRing<DmTrialsType> ring;
+    ASSERT_EQ(0U, ring.depth());
+    ASSERT_THROW(ring.acquire(), panda::Error);
+}
+
+} // namespace test
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
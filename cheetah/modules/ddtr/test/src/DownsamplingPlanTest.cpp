@@ -0,0 +1,131 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/ddtr/test/DownsamplingPlanTest.h"
+#include "cheetah/modules/ddtr/DownsamplingPlan.h"
+#include "panda/Error.h"
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace ddtr {
+namespace test {
+
+
+DownsamplingPlanTest::DownsamplingPlanTest()
+    : ::testing::Test()
+{
+}
+
+DownsamplingPlanTest::~DownsamplingPlanTest()
+{
+}
+
+void DownsamplingPlanTest::SetUp()
+{
+}
+
+void DownsamplingPlanTest::TearDown()
+{
+}
+
+static constexpr double dm_constant = 4.15e3;
+
+TEST_F(DownsamplingPlanTest, test_fixed_plan)
+{
+    DownsamplingPlan plan(4);
+    ASSERT_EQ(4U, plan.size());
+    std::vector<unsigned> expected{1, 2, 4, 8};
+    ASSERT_EQ(expected, plan.factors());
+    ASSERT_EQ(1U, plan.relative_factor(0));
+    for(std::size_t range = 1; range < plan.size(); ++range) {
+        ASSERT_EQ(2U, plan.relative_factor(range));
+    }
+}
+
+TEST_F(DownsamplingPlanTest, test_adaptive_plan_follows_smearing)
+{
+    // 64us sampling, 4096 channels over 300MHz
+    std::vector<DownsamplingPlan::Range> ranges{ {0.0, 100.0, 0.1}
+                                               , {100.0, 500.0, 0.5}
+                                               , {500.0, 1500.0, 1.0}
+                                               , {1500.0, 3000.0, 3.0}
+                                               };
+    DownsamplingPlan plan(64e-6, 1050.0, 1350.0, 4096, ranges, dm_constant);
+    ASSERT_EQ(ranges.size(), plan.size());
+    ASSERT_EQ(1U, plan.factor(0));
+    for(std::size_t range = 1; range < plan.size(); ++range) {
+        // never coarser than the smearing, and each level derivable from the one before
+        ASSERT_LE(plan.factor(range) * 64e-6, plan.smearing(range));
+        ASSERT_GE(plan.factor(range), plan.factor(range - 1));
+        ASSERT_EQ(0U, plan.factor(range) % plan.factor(range - 1));
+        ASSERT_EQ(plan.factor(range), plan.factor(range - 1) * plan.relative_factor(range));
+    }
+    ASSERT_GT(plan.factor(3), plan.factor(1));
+}
+
+TEST_F(DownsamplingPlanTest, test_adaptive_plan_non_power_of_two)
+{
+    // a single coarse range whose smearing is ~3 samples
+    double const tsamp = 1e-3;
+    double const band_delay = dm_constant * (1.0/(1000.0 * 1000.0) - 1.0/(1100.0 * 1100.0));
+    std::vector<DownsamplingPlan::Range> ranges{ {0.0, 10.0, 1.0}, {10.0, 100.0, 2.0 * 3.5 * tsamp / band_delay} };
+    DownsamplingPlan plan(tsamp, 1000.0, 1100.0, 1 << 20, ranges, dm_constant);
+    ASSERT_EQ(3U, plan.factor(1));
+}
+
+TEST_F(DownsamplingPlanTest, test_adaptive_plan_divides_samples)
+{
+    std::vector<DownsamplingPlan::Range> ranges{ {0.0, 100.0, 0.1}
+                                               , {1000.0, 2000.0, 2.0}
+                                               , {2000.0, 4000.0, 10.0}
+                                               };
+    std::size_t const number_of_samples = 3 * 5 * 64;
+    DownsamplingPlan plan(64e-6, 1050.0, 1350.0, 4096, ranges, dm_constant, 1.0, number_of_samples);
+    for(std::size_t range = 0; range < plan.size(); ++range) {
+        ASSERT_EQ(0U, number_of_samples % plan.factor(range));
+    }
+}
+
+TEST_F(DownsamplingPlanTest, test_tolerance)
+{
+    std::vector<DownsamplingPlan::Range> ranges{ {0.0, 100.0, 0.1}, {1000.0, 2000.0, 2.0} };
+    DownsamplingPlan plan(64e-6, 1050.0, 1350.0, 4096, ranges, dm_constant, 1.0);
+    DownsamplingPlan half_plan(64e-6, 1050.0, 1350.0, 4096, ranges, dm_constant, 0.5);
+    ASSERT_LT(half_plan.factor(1), plan.factor(1));
+    ASSERT_LE(half_plan.factor(1) * 64e-6, 0.5 * half_plan.smearing(1));
+}
+
+TEST_F(DownsamplingPlanTest, test_invalid_parameters)
+{
+    std::vector<DownsamplingPlan::Range> ranges{ {0.0, 100.0, 0.1} };
+    ASSERT_THROW(DownsamplingPlan(0.0, 1050.0, 1350.0, 4096, ranges, dm_constant), panda::Error);
+    ASSERT_THROW(DownsamplingPlan(64e-6, 1350.0, 1050.0, 4096, ranges, dm_constant), panda::Error);
+    ASSERT_THROW(DownsamplingPlan(64e-6, 1050.0, 1350.0, 0, ranges, dm_constant), panda::Error);
+}
+
+} // namespace test
+} // namespace ddtr
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
@@ -30,6 +30,7 @@
 #include "cheetah/data/Units.h"
 #include "cheetah/data/DedispersionMeasure.h"
 #include "cheetah/modules/ddtr/DedispersionTrialPlan.h"
+#include "cheetah/utils/ObjectPool.h"
 #include "panda/Resource.h"
 #include "panda/Log.h"
 #include "panda/Error.h"
@@ -78,6 +79,9 @@ class Spdt<SpdtTraits> : private utils::AlgorithmBase<Config, spdt::Config>
         std::size_t _samples_per_iteration;
         std::size_t _number_of_widths;
         float _threshold;
+        // recycled between chunks so the steady state does not allocate (calls may run concurrently)
+        utils::ObjectPool<std::vector<float>> _scratch_pool;
+        utils::ObjectPool<typename SpdtTraits::SpType> _candidate_list_pool;
 };
 
 template<class SpdtTraits>
@@ -87,9 +91,12 @@ std::shared_ptr<typename SpdtTraits::SpType> Spdt<SpdtTraits>::operator()(panda:
 {
     DmTrialsType& dmtrials = *(dm_trials_ptr);
     MsdEstimator<SpdtTraits> msd(dmtrials);
-    std::vector<float> spdt_cands;
+    auto spdt_cands_ptr = _scratch_pool.acquire();
+    std::vector<float>& spdt_cands = *spdt_cands_ptr;
+    spdt_cands.clear();
     perform_search(dmtrials, spdt_cands, msd.mean(), msd.stdev());
-    auto sp_candidate_list = std::make_shared<data::SpCcl<uint8_t>>(dm_trials_ptr);
+    auto sp_candidate_list = _candidate_list_pool.acquire(dm_trials_ptr);
+    sp_candidate_list->reset(dm_trials_ptr);
 
     for (std::size_t idx=0; idx<spdt_cands.size(); idx+=4)
     {
@@ -107,7 +114,9 @@ std::shared_ptr<typename SpdtTraits::SpType> Spdt<SpdtTraits>::operator()(panda:
 template<typename SpdtTraits>
 void Spdt<SpdtTraits>::perform_search(DmTrialsType const& data, std::vector<float>& sp_cands, double mean, double stdev)
 {
-    std::vector<float> temp(data[0].size());
+    auto temp_ptr = _scratch_pool.acquire();
+    std::vector<float>& temp = *temp_ptr;
+    temp.resize(data[0].size());
     for(std::size_t dm_indx=0; dm_indx<data.size(); dm_indx++)
     {
         std::copy(data[dm_indx].begin(), data[dm_indx].end(), temp.begin());
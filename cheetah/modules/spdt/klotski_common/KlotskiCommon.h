@@ -32,6 +32,7 @@
 #include "cheetah/data/DmTrialsMetadata.h"
 #include "cheetah/utils/Architectures.h"
 #include "cheetah/utils/AlgorithmBase.h"
+#include "cheetah/utils/ObjectPool.h"
 #include <mutex>
 #include <memory>
 
@@ -105,6 +106,12 @@ class KlotskiCommon : private utils::AlgorithmBase<ImplConfigType, AlgoConfigTyp
         std::vector<std::vector<std::vector<float>>> _overlap;
         std::vector<std::vector<std::vector<double>>> _sum_array;
         unsigned int _number_of_dms_per_iteration;
+        // per chunk buffers, kept between calls to avoid allocation in the steady state
+        std::vector<float> _spdt_cands;
+        std::vector<std::size_t> _stack_variables;
+        std::vector<const std::size_t*> _data_in_pointers;
+        std::vector<double> _mst_array;
+        utils::ObjectPool<typename SpdtTraits::SpType> _candidate_list_pool;
 };
 
 
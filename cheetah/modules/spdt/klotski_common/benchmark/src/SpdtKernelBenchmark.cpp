@@ -0,0 +1,176 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/benchmark_utils/KernelBenchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * Micro benchmark for the klotski single pulse width search kernel.
+ *
+ * The kernel is driven as KlotskiCommon::call_nasm_filter_spdt does for the first dm range:
+ * one call searches 8 dm trials of gaussian noise over all requested widths, so the reported
+ * ops_per_cycle refers to one (dm, width, sample) boxcar test per op.
+ */
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace spdt {
+namespace klotski_common {
+
+extern "C" void nasm_filter_spdt( std::size_t* stack_variables
+                                , std::size_t total_size
+                                , std::size_t* data_in_pointers
+                                , unsigned int* temp_cands
+                                , unsigned int* widths_array
+                                , double* mst_array
+                                , float* overlap
+                                , double* sum_array
+                                );
+
+namespace benchmark {
+
+namespace {
+
+bool avx512_supported()
+{
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+}
+
+} // namespace
+
+/**
+ * Arguments: {number of samples, number of widths}
+ */
+static void BM_nasm_filter_spdt(::benchmark::State& state)
+{
+    if(!avx512_supported()) {
+        state.SkipWithError("nasm_filter_spdt requires AVX-512");
+        return;
+    }
+
+    std::size_t const number_of_samples = static_cast<std::size_t>(state.range(0));
+    std::size_t const number_of_widths = static_cast<std::size_t>(state.range(1));
+    unsigned const number_of_dms = 8;
+    unsigned const max_width = 16*1024;
+    double const threshold = 6.0;
+
+    // the leading entries of the default klotski_common width list
+    std::vector<unsigned int> const default_widths{1,2,4,5,6,7,8,9,10,11,12,15,16,17,22,23,24,25,28,29,30,31,32,33,34,100, 150, 300, 400, 512, 768, 1024, 1200, 1400, 1600, 2048, 4096};
+    std::vector<unsigned int> widths(default_widths.begin(), default_widths.begin() + std::min(number_of_widths, default_widths.size()));
+
+    std::mt19937 generator(42);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::vector<std::vector<float>> data_in(number_of_dms, std::vector<float>(number_of_samples));
+    for(auto& dm : data_in) std::generate(dm.begin(), dm.end(), [&]() { return noise(generator); });
+
+    std::vector<std::size_t const*> data_in_pointers;
+    for(auto const& dm : data_in) data_in_pointers.push_back(reinterpret_cast<std::size_t const*>(dm.data()));
+
+    std::vector<unsigned int> temp_cands(4*number_of_samples*widths.size());
+    std::vector<float> overlap(max_width*number_of_dms, 0.0f);
+    std::vector<double> sum_array(number_of_dms*widths.size(), 0.0);
+
+    std::vector<double> mst_array((2+widths.size())*8);
+    for(unsigned int t=0; t<8; ++t)
+    {
+        mst_array[t] = 0.0;
+        mst_array[t+8] = threshold;
+    }
+    for(unsigned int i=0; i<widths.size(); ++i)
+    {
+        for(unsigned int t=0; t<8; ++t) mst_array[16+i*8+t] = 1.0/std::sqrt(widths[i]);
+    }
+
+    std::vector<std::size_t> stack_variables(23);
+    std::size_t candidates = 0;
+    for(auto _ : state) {
+        // the kernel returns the number of candidates in the first stack variable so they are reset on every call
+        stack_variables[0] = 64; //DATA_IN_POINTERS_SIZE
+        stack_variables[1] = (max_width+8)*number_of_dms*sizeof(float); //SCRATCH_SIZE
+        stack_variables[2] = 64*sizeof(float); //TEMP_SIZE
+        stack_variables[3] = 64*sizeof(float); //TEMP_CORNERTURNED_SIZE
+        stack_variables[4] = 64*widths.size(); // SUM_ARRAY_SIZE
+        stack_variables[5] = widths.size()*sizeof(int); // WIDTHS_ARRAY_SIZE
+        stack_variables[6] = 64; // MEAN_ARRAY_SIZE
+        stack_variables[7] = 64*widths.size(); // STD_ARRAY_SIZE
+        stack_variables[8] = 64; // THRESHOLD_ARRAY_SIZE
+        stack_variables[9] = 256; //DATA_IN_POINTERS_LOCATION
+        stack_variables[10] = stack_variables[9]+stack_variables[0]; //SCRATCH_LOCATION
+        stack_variables[11] = stack_variables[10]+stack_variables[1]; //TEMP_LOCATION
+        stack_variables[12] = stack_variables[11]+stack_variables[2]; //TEMP_CORNERTURNED_LOCATION
+        stack_variables[13] = stack_variables[12]+stack_variables[3]; //SUM_ARRAY_LOCATION
+        stack_variables[14] = stack_variables[13]+stack_variables[4]; // WIDTHS_ARRAY_LOCATION
+        stack_variables[15] = stack_variables[14]+stack_variables[5]; // MEAN_ARRAY_LOCATION
+        stack_variables[16] = stack_variables[15]+stack_variables[6]; // STD_ARRAY_LOCATION
+        stack_variables[17] = stack_variables[16]+stack_variables[7]; // THRESHOLD_ARRAY_LOCATION
+        stack_variables[18] = widths.size(); // NUMBER_OF_WIDTHS
+        stack_variables[19] = max_width; // MAX_WIDTH
+        stack_variables[20] = 0; // START_DMINDX
+        stack_variables[21] = number_of_samples*sizeof(float); // SAMPLE_SIZE_PER_DMINDX
+        stack_variables[22] = stack_variables[17]+stack_variables[8]; //TOTAL_SIZE
+
+        nasm_filter_spdt( stack_variables.data()
+                        , stack_variables[22]
+                        , reinterpret_cast<std::size_t*>(data_in_pointers.data())
+                        , temp_cands.data()
+                        , widths.data()
+                        , mst_array.data()
+                        , overlap.data()
+                        , sum_array.data()
+                        );
+        candidates = stack_variables[0];
+        ::benchmark::DoNotOptimize(candidates);
+        ::benchmark::ClobberMemory();
+    }
+
+    std::size_t const ops = std::size_t(number_of_dms) * widths.size() * number_of_samples;
+    utils::benchmark_utils::set_kernel_counters(state, std::size_t(number_of_dms) * number_of_samples * sizeof(float), ops);
+    state.counters["candidates"] = static_cast<double>(candidates);
+}
+
+static void filter_sweep(::benchmark::internal::Benchmark* b)
+{
+    b->ArgNames({"samples", "widths"});
+    for(int64_t samples : {1<<15, 1<<16, 1<<18}) {
+        for(int64_t widths : {8, 37}) {
+            b->Args({samples, widths});
+        }
+    }
+    b->Unit(::benchmark::kMicrosecond);
+}
+
+BENCHMARK(BM_nasm_filter_spdt)->Apply(filter_sweep);
+
+} // namespace benchmark
+} // namespace klotski_common
+} // namespace spdt
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+
+CHEETAH_KERNEL_BENCHMARK_MAIN()
@@ -66,13 +66,14 @@ extern "C" void nasm_filter_spdt( std::size_t* stack_variables
 template<class SpdtTraits, typename ImplConfigType, typename AlgoConfigType>
 std::shared_ptr<typename SpdtTraits::SpType> KlotskiCommon<SpdtTraits, ImplConfigType, AlgoConfigType>::operator()(panda::PoolResource<panda::Cpu>& cpu, std::shared_ptr<typename SpdtTraits::DmTrialsType> data)
 {
-    //auto spdt_start = std::chrono::high_resolution_clock::now();
-    std::vector<float> spdt_cands;
+    std::vector<float>& spdt_cands = _spdt_cands;
+    spdt_cands.clear();
     auto& dmtrials = *data;
 
     this->perform_search(dmtrials, spdt_cands, dmtrials.metadata().number_of_ranges());
 
-    auto sp_candidate_list = std::make_shared<data::SpCcl<uint8_t>>(data);
+    auto sp_candidate_list = _candidate_list_pool.acquire(data);
+    sp_candidate_list->reset(data);
 
     for (std::size_t idx=0; idx<spdt_cands.size(); idx+=4)
     {
@@ -84,8 +85,6 @@ std::shared_ptr<typename SpdtTraits::SpType> KlotskiCommon<SpdtTraits, ImplConfi
                         , spdt_cands[idx] // sigma
                         );
     }
-    //auto spdt_stop = std::chrono::high_resolution_clock::now();
-    //std::cout<<"spdt: "<<std::chrono::duration_cast<std::chrono::nanoseconds>(spdt_stop - spdt_start).count()/1000000.0<<"\n";
     return sp_candidate_list;
 }
 
@@ -197,7 +196,7 @@ void KlotskiCommon<SpdtTraits, ImplConfigType, AlgoConfigType>::call_nasm_filter
                 , unsigned int dm_range
                 , unsigned int iteration)
 {
-    std::vector<std::size_t> stack_variables(23);
+    std::vector<std::size_t>& stack_variables = _stack_variables;
 
     stack_variables[0] = 64; //DATA_IN_POINTERS_SIZE
     stack_variables[1] = ((_max_width/std::pow(2,dm_range))+8)*_number_of_dms_per_iteration*sizeof(float); //SCRATCH_SIZE
@@ -223,13 +222,15 @@ void KlotskiCommon<SpdtTraits, ImplConfigType, AlgoConfigType>::call_nasm_filter
     stack_variables[21] = data_in[start_dmindx].size()*sizeof(float); // SAMPLE_SIZE_PER_DMINDX
     stack_variables[22] = stack_variables[17]+stack_variables[8]; //TOTAL_SIZE
 
-    std::vector<const std::size_t*> data_in_pointers(_number_of_dms_per_iteration);
+    std::vector<const std::size_t*>& data_in_pointers = _data_in_pointers;
+    data_in_pointers.resize(_number_of_dms_per_iteration);
     for(std::size_t i=0; i<_number_of_dms_per_iteration; ++i)
     {
         data_in_pointers[i]=reinterpret_cast<const std::size_t*>(&*(data_in[start_dmindx+i].begin()));
     }
 
-    std::vector<double> mst_array((2+_widths_array_per_range[dm_range].size())*8);
+    std::vector<double>& mst_array = _mst_array;
+    mst_array.resize((2+_widths_array_per_range[dm_range].size())*8);
 
     for(unsigned int t=0; t<8; ++t)
     {
@@ -268,6 +269,7 @@ KlotskiCommon<SpdtTraits, ImplConfigType, AlgoConfigType>::KlotskiCommon(ImplCon
     , _overlap(0)
     , _sum_array(0)
     , _number_of_dms_per_iteration(8) //TODO: This value can be 8, 16, 32. However, we fix this 8 asa higher value needs more cache to implement.
+    , _stack_variables(23)
 {
 }
 
@@ -0,0 +1,111 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_MODULES_SPS_CLUSTERING_GRIDFOF_H
+#define SKA_CHEETAH_MODULES_SPS_CLUSTERING_GRIDFOF_H
+
+#include "cheetah/modules/sps_clustering/Config.h"
+#include "cheetah/data/SpCcl.h"
+#include "cheetah/utils/WorkerPool.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace sps_clustering {
+
+/**
+ * @brief Friend Of Friends Clustering Algorithm for SpCandidates using a uniform grid
+ * @details Produces the same groups as the Fof class. The scaled (time, dm, log width) space
+ *          is divided into cubic cells with side equal to the linking length so that
+ *          friends can only be found in the same or adjacent cells. The candidates are sorted
+ *          by cell and each cell is compared only against itself and its 13 "forward"
+ *          neighbours. Friends are merged with a union-find structure.
+ *
+ *          Cells may be processed by several threads (Config::num_threads), each with its own
+ *          union-find which are merged at the end. The threads are started with the clusterer
+ *          and reused for every call.
+ *
+ *          Groups are returned in the order of their lowest candidate index, with the
+ *          candidate indices in each group in ascending order.
+ */
+class GridFof
+{
+    public:
+        static constexpr std::size_t ClusteringParams = 3;
+        typedef std::array<double, ClusteringParams> PointType;
+
+    public:
+        GridFof(Config const& config);
+        GridFof(GridFof&&) = default;
+        ~GridFof();
+
+        void linking_length(double const& l);
+
+        double linking_length() const;
+
+        /**
+         * @brief Group the candidates using the fof algorithm
+         * @return a vector containing the groups of candidates.
+         *         each group is represented as a vector of indices
+         *         for the candidatate in the input data.
+         */
+        template<typename NumRepType>
+        std::vector<std::vector<size_t>> operator()(data::SpCcl<NumRepType> const& cands);
+
+        /**
+         * @brief Group a set of points already scaled to the clustering space
+         */
+        std::vector<std::vector<size_t>> operator()(std::vector<PointType> const& points) const;
+
+    private:
+        typedef std::array<std::int64_t, ClusteringParams> CellType;
+
+        /**
+         * @brief union the friends found in the cells [cell_begin, cell_end) in to parents
+         * @param points the points sorted by cell
+         */
+        void link_cells(std::vector<PointType> const& points
+                      , std::vector<CellType> const& cells
+                      , std::vector<std::size_t> const& cell_offsets
+                      , std::size_t cell_begin
+                      , std::size_t cell_end
+                      , std::vector<std::size_t>& parents) const;
+
+    private:
+        Config const& _config;
+        double _linking_length;
+        double _linking_length_2;
+        std::unique_ptr<utils::WorkerPool> _workers; // reused by every call, held by pointer to keep the clusterer movable
+};
+
+
+} // namespace sps_clustering
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/modules/sps_clustering/detail/GridFof.cpp"
+#endif // SKA_CHEETAH_MODULES_SPS_CLUSTERING_GRIDFOF_H
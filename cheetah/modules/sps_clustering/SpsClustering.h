@@ -25,8 +25,10 @@
 #define SKA_CHEETAH_MODULES_SPS_CLUSTERING_SPSCLUSTERING_H
 
 #include "cheetah/modules/sps_clustering/Config.h"
-#include "cheetah/modules/sps_clustering/Fof.h"
+#include "cheetah/modules/sps_clustering/GridFof.h"
 #include "cheetah/data/SpCcl.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -50,6 +52,14 @@ namespace sps_clustering {
  *
  * where linking_length is also user-defined and ||  || denotes Euclidean distance.
  *
+ * Clusters that reach the end of a chunk (i.e. have a member within linking_length * time_tolerance
+ * of the end of the searched data) are held back and clustered again with the next chunk, so that a
+ * pulse spanning a chunk boundary produces only one representative. A cluster is held back
+ * for one chunk at most. Candidates in the next chunk that precede the point at which clusters were
+ * held back (i.e. are in a region of overlapping data already processed) are ignored.
+ * If a chunk starts before the previous chunk the held back clusters are emitted with it and no
+ * candidates are ignored. At the end of the stream call flush() to emit any clusters still held back.
+ *
  * @todo There is probably a better way of automatically choosing dm_tolerance based on the
  * observing bandwidth (i.e. convert the DM difference between two candidates to a dispersion
  * delay). It would be nice to have a sensible, telescope-independent way of doing clustering
@@ -57,10 +67,11 @@ namespace sps_clustering {
  */
 class SpsClustering
 {
-        typedef Fof ClusteringAlgo;
+        typedef GridFof ClusteringAlgo;
 
     public:
         SpsClustering(Config const& config);
+        SpsClustering(SpsClustering&&) = default;
         ~SpsClustering();
 
         /**
@@ -70,9 +81,25 @@ class SpsClustering
         template<typename NumRepType>
         std::shared_ptr<data::SpCcl<NumRepType>> operator()(std::shared_ptr<data::SpCcl<NumRepType>> const& cands);
 
+        /**
+         * @brief end of stream: return the representatives of the clusters held back from the last chunk
+         * @details the returned list starts at the same time as the last chunk. The next chunk starts a new stream.
+         */
+        template<typename NumRepType>
+        std::shared_ptr<data::SpCcl<NumRepType>> flush();
+
+    private:
+        typedef data::SpCandidate<Cpu, float> CandidateType;
+
     private:
         Config const& _config;
         ClusteringAlgo _clustered_candidates;
+        std::vector<CandidateType> _carry;                          // members of clusters held back from the previous chunk
+        utils::ModifiedJulianClock::time_point _carry_start_time;   // the time the _carry tstart values are relative to
+        CandidateType::MsecTimeType _carry_sample_interval;         // the sample interval of the chunk _carry was held back from
+        CandidateType::Dm _carry_min_dm;                            // the lowest representative dm of the chunk _carry was held back from
+        bool _has_boundary;
+        utils::ModifiedJulianClock::time_point _boundary;           // data before this time has been processed
 
 };
 
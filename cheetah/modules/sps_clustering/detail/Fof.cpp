@@ -115,9 +115,9 @@ std::vector< std::vector<size_t>> Fof::operator()(data::SpCcl<NumRepType> const&
     if (dm_step  == 0 * pss::astrotypes::units::parsecs_per_cube_cm)
         dm_step = (1.0 * pss::astrotypes::units::parsecs_per_cube_cm );
 
-    if(cands.tf_blocks().size() == 0 || cands.size() == 0 ) return groups;
+    if(cands.size() == 0 || cands.sample_interval().value() <= 0.0) return groups;
 
-    auto tsamp = static_cast<boost::units::quantity<data::MilliSeconds,double>>(((*(cands.tf_blocks().begin()))->sample_interval())).value();
+    auto tsamp = cands.sample_interval().value();
     // set up a point in the clustering search space for each candidate
     for(size_t i = 0 ; i < cands.size() ; ++i)
     {
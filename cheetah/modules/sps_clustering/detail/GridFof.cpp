@@ -0,0 +1,56 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <cmath>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace sps_clustering {
+
+template<typename NumRepType>
+std::vector<std::vector<size_t>> GridFof::operator()(data::SpCcl<NumRepType> const& cands)
+{
+    if(cands.size() == 0 || cands.sample_interval().value() <= 0.0) return std::vector<std::vector<size_t>>();
+
+    auto tsamp = cands.sample_interval().value();
+
+    // the same scaling as the Fof algorithm, so that the distances calculated are identical
+    std::vector<PointType> points;
+    points.reserve(cands.size());
+    for(size_t i = 0 ; i < cands.size() ; ++i)
+    {
+        points.push_back(PointType{{
+              static_cast<double>((cands[i].tstart()/tsamp)/(_config.time_tolerance()/tsamp))
+            , static_cast<double>((cands[i].dm()).value())/((_config.dm_tolerance())).value()
+            , static_cast<double>(std::log2(cands[i].width().value()/tsamp)/std::log2(_config.pulse_width_tolerance().value()/tsamp))
+        }});
+    }
+
+    return (*this)(points);
+}
+
+} // namespace sps_clustering
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
@@ -22,6 +22,10 @@
  * SOFTWARE.
  */
 #include "cheetah/modules/sps_clustering/SpsClustering.h"
+#include "panda/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
 
 
 namespace ska {
@@ -32,47 +36,132 @@ namespace sps_clustering {
 template<typename NumRepType>
 std::shared_ptr<data::SpCcl<NumRepType>> SpsClustering::operator()(std::shared_ptr<data::SpCcl<NumRepType>> const& cands)
 {
-    /*
     if (! _config.active())
         return cands;
 
-    data::DimensionIndex<data::Time> offset_samples(0);
-    if(cands->tf_blocks().size() !=0)
+    if(cands->sample_interval().value() <= 0.0)
     {
-        offset_samples = data::DimensionIndex<data::Time>(cands->offset_time().value()/1000.0/(cands->tf_blocks()[0]->sample_interval().value()));
+        PANDA_LOG_WARN << "SpsClustering: sample interval unknown, candidates will not be clustered";
+        return cands;
+    }
+
+    typedef typename data::SpCcl<NumRepType>::MsecTimeType MsecTimeType;
+    auto const to_msec = [&](utils::ModifiedJulianClock::time_point const& t)
+    {
+        return MsecTimeType(std::chrono::duration<double, std::milli>(t - cands->start_time()).count() * data::milliseconds);
+    };
+
+    // a chunk that starts before the previous one (e.g. delivered out of order) cannot be stitched on to it:
+    // flush the held back clusters with this chunk and forget the processed boundary
+    if(_has_boundary && cands->start_time() < _carry_start_time)
+    {
+        PANDA_LOG_WARN << "SpsClustering: chunk starts before the previous chunk, resetting the clustering carried between chunks";
+        _has_boundary = false;
+    }
+
+    // gather the held back candidates (moved to this chunks time frame) and the new candidates
+    data::SpCcl<NumRepType> working;
+    working.sample_interval(cands->sample_interval());
+    working.reserve(_carry.size() + cands->size());
+    MsecTimeType const carry_shift = to_msec(_carry_start_time);
+    for(auto& candidate : _carry)
+    {
+        candidate.tstart(candidate.tstart() + carry_shift);
+        candidate.tend(candidate.tend() + carry_shift);
+        working.push_back(candidate);
     }
+    std::size_t const number_carried = _carry.size();
+    _carry.clear();
 
-    std::shared_ptr<data::SpCcl<NumRepType>> merged_cands = std::make_shared<data::SpCcl<NumRepType>>(cands->tf_blocks(), offset_samples);
-    std::vector<std::vector<size_t>> groups = _clustered_candidates(*cands);
+    MsecTimeType const processed_boundary = _has_boundary ? to_msec(_boundary) : MsecTimeType(-std::numeric_limits<double>::max() * data::milliseconds);
+    for(auto const& candidate : *cands)
+    {
+        if(candidate.tstart() >= processed_boundary) working.push_back(candidate);
+    }
+
+    // clusters with any member after this point may continue in to the next chunk
+    MsecTimeType const hold_boundary = (cands->duration().value() > 0.0)
+                                     ? MsecTimeType(cands->duration() - static_cast<double>(_config.linking_length()) * _config.time_tolerance())
+                                     : MsecTimeType(std::numeric_limits<double>::max() * data::milliseconds);
+
+    std::vector<std::vector<size_t>> groups = _clustered_candidates(working);
 
     PANDA_LOG_DEBUG << "Picking best candidate from  " << groups.size() << " clusters...";
-    std::vector<data::SpCandidate<Cpu, float>> group_cands;
+    CandidateType::Dm const min_dm = working.dm_range().first + (1.0 * pss::astrotypes::units::parsecs_per_cube_cm);
+    cands->clear();
     for ( auto const& group : groups )
     {
-        // use the max sigma candidate as the representative of any group
-        // Filter out all candidates with these indices into a separate vector
-        PANDA_LOG_DEBUG << "Size of each cluster: " << group.size();
+        bool contains_carried = false;
+        bool at_end = false;
         std::size_t max_sigma_index = group[0];
-        typename data::SpCcl<NumRepType>::SpCandidateType::NumericalRep max_sigma = (*cands)[max_sigma_index].sigma();
-        for (std::size_t ii=1; ii < group.size(); ++ii)
+        for (std::size_t index : group)
+        {
+            auto const& candidate = working[index];
+            contains_carried |= (index < number_carried);
+            at_end |= (candidate.tstart() >= hold_boundary);
+            if( candidate.sigma() > working[max_sigma_index].sigma() ) {
+                max_sigma_index = index;
+            }
+        }
+
+        if(at_end && !contains_carried)
         {
-            auto const& candidate = (*cands)[group[ii]];
-            if( candidate.sigma() > max_sigma ) {
-                max_sigma = candidate.sigma();
-                max_sigma_index = group[ii];
+            for (std::size_t index : group)
+            {
+                _carry.push_back(working[index]);
             }
+            continue;
         }
-        PANDA_LOG_DEBUG << "Parameters for max S/N candidate";
-        PANDA_LOG_DEBUG << "DM: " << (*cands)[max_sigma_index].dm();
-        PANDA_LOG_DEBUG << "Width: " << (*cands)[max_sigma_index].width();
-        PANDA_LOG_DEBUG << "S/N: " << (*cands)[max_sigma_index].sigma();
-        if ((*cands)[max_sigma_index].dm() >= (*cands).dm_range().first + (1.0 * pss::astrotypes::units::parsecs_per_cube_cm))
+
+        // use the max sigma candidate as the representative of any group
+        if (working[max_sigma_index].dm() >= min_dm)
+        {
+            cands->push_back(working[max_sigma_index]);
+        }
+    }
+
+    _carry_start_time = cands->start_time();
+    _carry_sample_interval = cands->sample_interval();
+    _carry_min_dm = min_dm;
+    if(cands->duration().value() > 0.0)
+    {
+        _has_boundary = true;
+        _boundary = cands->start_time();
+        _boundary += std::chrono::duration<double, std::milli>(hold_boundary.value());
+    }
+    PANDA_LOG_DEBUG << "SpsClustering: " << cands->size() << " clusters from " << working.size() << " candidates (" << _carry.size() << " held back)";
+    return cands;
+}
+
+template<typename NumRepType>
+std::shared_ptr<data::SpCcl<NumRepType>> SpsClustering::flush()
+{
+    auto cands = std::make_shared<data::SpCcl<NumRepType>>();
+    cands->start_time(_carry_start_time);
+    cands->sample_interval(_carry_sample_interval);
+    _has_boundary = false;
+    if(_carry.empty()) return cands;
+
+    data::SpCcl<NumRepType> working;
+    working.sample_interval(_carry_sample_interval);
+    working.reserve(_carry.size());
+    for(auto const& candidate : _carry)
+    {
+        working.push_back(candidate);
+    }
+    _carry.clear();
+
+    // the held back clusters are complete: emit the brightest member of each, filtered as the chunk they came from
+    for ( auto const& group : _clustered_candidates(working) )
+    {
+        std::size_t const max_sigma_index = *std::max_element(group.begin(), group.end()
+                                                             , [&](std::size_t a, std::size_t b) { return working[a].sigma() < working[b].sigma(); });
+        if (working[max_sigma_index].dm() >= _carry_min_dm)
         {
-            merged_cands->push_back((*cands)[max_sigma_index]);
+            cands->push_back(working[max_sigma_index]);
         }
     }
-    return merged_cands;
-    */
+    PANDA_LOG_DEBUG << "SpsClustering: flushed " << cands->size() << " held back clusters";
     return cands;
 }
 
@@ -36,6 +36,7 @@ Config::Config()
     , _dm_tolerance(1 * pss::astrotypes::units::parsecs_per_cube_cm)
     , _linking_length(1.7)
     , _active(true)
+    , _num_threads(1)
 {
 }
 
@@ -49,7 +50,7 @@ void Config::add_options(OptionsDescriptionEasyInit& add_options )
     ("active", boost::program_options::value<bool>(&_active)->default_value(_active),
         "perform SpsClustering if true"
     )
-    ("number_of_threads", boost::program_options::value<std::size_t>(&_num_threads)->default_value(1),
+    ("number_of_threads", boost::program_options::value<std::size_t>(&_num_threads)->default_value(_num_threads),
         "number of threads to use for clustering"
     )
     ("time_tolerance", boost::program_options::value<float>()->notifier(
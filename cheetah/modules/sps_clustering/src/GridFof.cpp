@@ -0,0 +1,256 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/sps_clustering/GridFof.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace sps_clustering {
+
+namespace {
+
+inline std::size_t find_root(std::vector<std::size_t>& parents, std::size_t i)
+{
+    // path halving
+    while(parents[i] != i)
+    {
+        parents[i] = parents[parents[i]];
+        i = parents[i];
+    }
+    return i;
+}
+
+inline bool join(std::vector<std::size_t>& parents, std::size_t i, std::size_t j)
+{
+    i = find_root(parents, i);
+    j = find_root(parents, j);
+    if(i == j) return false;
+    if(i < j) parents[j] = i;
+    else parents[i] = j;
+    return true;
+}
+
+inline bool is_finite(GridFof::PointType const& point)
+{
+    return std::isfinite(point[0]) && std::isfinite(point[1]) && std::isfinite(point[2]);
+}
+
+} // namespace
+
+GridFof::GridFof(Config const& config)
+    : _config(config)
+    , _workers(new utils::WorkerPool(static_cast<unsigned>(config.num_threads())))
+{
+    linking_length(_config.linking_length());
+}
+
+GridFof::~GridFof()
+{
+}
+
+double GridFof::linking_length() const
+{
+    return _linking_length;
+}
+
+void GridFof::linking_length(double const& l)
+{
+    _linking_length = l;
+    _linking_length_2 = l * l;
+}
+
+std::vector<std::vector<size_t>> GridFof::operator()(std::vector<PointType> const& points) const
+{
+    std::size_t const number_of_points = points.size();
+
+    // points with non finite coordinates can never be friends (as with the Fof algorithm), nor can
+    // anything be if the linking length is not positive
+    std::vector<std::pair<CellType, std::size_t>> keys;
+    if(_linking_length > 0.0)
+    {
+        keys.reserve(number_of_points);
+        for(std::size_t i=0; i < number_of_points; ++i)
+        {
+            if(!is_finite(points[i])) continue;
+            CellType cell;
+            for(std::size_t d=0; d < ClusteringParams; ++d)
+            {
+                cell[d] = static_cast<std::int64_t>(std::floor(points[i][d]/_linking_length));
+            }
+            keys.emplace_back(cell, i);
+        }
+    }
+
+    // sort the points by cell (lexicographically) so each cell is a contiguous range.
+    // From here on points are referred to by their position in this order
+    std::sort(keys.begin(), keys.end());
+
+    std::size_t const number_of_sorted = keys.size();
+    std::vector<PointType> sorted_points(number_of_sorted);
+    std::vector<CellType> cells;
+    std::vector<std::size_t> cell_offsets;
+    for(std::size_t i=0; i < number_of_sorted; ++i)
+    {
+        sorted_points[i] = points[keys[i].second];
+        if(cells.empty() || cells.back() != keys[i].first)
+        {
+            cells.push_back(keys[i].first);
+            cell_offsets.push_back(i);
+        }
+    }
+    cell_offsets.push_back(number_of_sorted);
+
+    std::vector<std::size_t> parents(number_of_sorted);
+    std::iota(parents.begin(), parents.end(), 0);
+
+    std::size_t const number_of_threads = std::max<std::size_t>(1, std::min<std::size_t>(_workers->number_of_threads(), cells.size()/64));
+    if(number_of_threads <= 1)
+    {
+        link_cells(sorted_points, cells, cell_offsets, 0, cells.size(), parents);
+    }
+    else
+    {
+        // each task links a contiguous range of cells in to its own union-find
+        std::vector<std::vector<std::size_t>> thread_parents(number_of_threads - 1, parents);
+        std::size_t const cells_per_thread = cells.size()/number_of_threads;
+        _workers->run(number_of_threads, [&](std::size_t t)
+                      {
+                          std::size_t const cell_begin = t * cells_per_thread;
+                          std::size_t const cell_end = (t + 1 == number_of_threads) ? cells.size() : cell_begin + cells_per_thread;
+                          link_cells(sorted_points, cells, cell_offsets, cell_begin, cell_end, (t == 0) ? parents : thread_parents[t-1]);
+                      });
+
+        for(auto& local_parents : thread_parents)
+        {
+            for(std::size_t i=0; i < number_of_sorted; ++i)
+            {
+                if(local_parents[i] != i) join(parents, i, find_root(local_parents, i));
+            }
+        }
+    }
+
+    // gather the groups in order of their lowest candidate index
+    std::size_t const no_group = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> position(number_of_points, no_group);
+    for(std::size_t i=0; i < number_of_sorted; ++i)
+    {
+        position[keys[i].second] = i;
+    }
+
+    std::vector<std::vector<size_t>> groups;
+    std::vector<std::size_t> group_index(number_of_sorted, no_group);
+    for(std::size_t i=0; i < number_of_points; ++i)
+    {
+        if(position[i] == no_group)
+        {
+            groups.emplace_back(1, i);
+            continue;
+        }
+        std::size_t& index = group_index[find_root(parents, position[i])];
+        if(index == no_group)
+        {
+            index = groups.size();
+            groups.emplace_back();
+        }
+        groups[index].push_back(i);
+    }
+    return groups;
+}
+
+void GridFof::link_cells(std::vector<PointType> const& points
+                       , std::vector<CellType> const& cells
+                       , std::vector<std::size_t> const& cell_offsets
+                       , std::size_t cell_begin
+                       , std::size_t cell_end
+                       , std::vector<std::size_t>& parents) const
+{
+    auto link = [&](std::size_t a, std::size_t b)
+    {
+        if(find_root(parents, a) == find_root(parents, b)) return;
+
+        // squared euclidean distance, summed in the same order as the Fof algorithm
+        double const d2 = 0.0
+                        + (points[a][2] - points[b][2]) * (points[a][2] - points[b][2])
+                        + (points[a][1] - points[b][1]) * (points[a][1] - points[b][1])
+                        + (points[a][0] - points[b][0]) * (points[a][0] - points[b][0]);
+        if(d2 < _linking_length_2) join(parents, a, b);
+    };
+
+    // The 13 neighbouring cells that follow a cell in the sort order lie in 5 (x, y) columns, the z
+    // neighbours in each column being contiguous. As cells are visited in order the start of each
+    // column only moves forward, so we keep a cursor per column.
+    static constexpr std::int64_t columns[5][3] = {{0, 0, 1}, {0, 1, -1}, {1, -1, -1}, {1, 0, -1}, {1, 1, -1}};
+    std::array<std::size_t, 5> cursors;
+    if(cell_begin < cell_end)
+    {
+        for(std::size_t column=0; column < cursors.size(); ++column)
+        {
+            CellType const& c = cells[cell_begin];
+            CellType const first{{c[0] + columns[column][0], c[1] + columns[column][1], c[2] + columns[column][2]}};
+            cursors[column] = std::distance(cells.begin(), std::lower_bound(cells.begin() + cell_begin, cells.end(), first));
+        }
+    }
+
+    for(std::size_t cell = cell_begin; cell < cell_end; ++cell)
+    {
+        CellType const& c = cells[cell];
+
+        // friends within the cell
+        for(std::size_t i = cell_offsets[cell]; i < cell_offsets[cell + 1]; ++i)
+        {
+            for(std::size_t j = i + 1; j < cell_offsets[cell + 1]; ++j)
+            {
+                link(i, j);
+            }
+        }
+
+        for(std::size_t column=0; column < cursors.size(); ++column)
+        {
+            CellType const first{{c[0] + columns[column][0], c[1] + columns[column][1], c[2] + columns[column][2]}};
+            CellType const last{{c[0] + columns[column][0], c[1] + columns[column][1], c[2] + 1}};
+            std::size_t& cursor = cursors[column];
+            while(cursor < cells.size() && cells[cursor] < first) ++cursor;
+
+            for(std::size_t neighbour = cursor; neighbour < cells.size() && !(last < cells[neighbour]); ++neighbour)
+            {
+                for(std::size_t i = cell_offsets[cell]; i < cell_offsets[cell + 1]; ++i)
+                {
+                    for(std::size_t j = cell_offsets[neighbour]; j < cell_offsets[neighbour + 1]; ++j)
+                    {
+                        link(i, j);
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace sps_clustering
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
@@ -32,6 +32,9 @@ SpsClustering::SpsClustering(Config const& config)
     :
     _config(config)
     , _clustered_candidates(config)
+    , _carry_sample_interval(0.0 * data::milliseconds)
+    , _carry_min_dm(0.0 * data::parsecs_per_cube_cm)
+    , _has_boundary(false)
 {
 }
 
@@ -87,13 +87,9 @@ TEST_F(FofTest, test_empty_list)
 TEST_F(FofTest, test_group_one_candidate)
 {
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -131,14 +127,9 @@ TEST_F(FofTest, test_group_one_candidate)
 TEST_F(FofTest, test_group_two_candidates)
 {
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(1000.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -175,14 +166,9 @@ TEST_F(FofTest, test_group_two_candidates)
 TEST_F(FofTest, test_dm_grouping)
 {
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     data::SpCcl<NumericalRep>::SpCandidateType::Dm dm(200.234 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -230,14 +216,9 @@ TEST_F(FofTest, test_dm_grouping)
 TEST_F(FofTest, test_group_multiple_candidates)
 {
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(1000.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -275,13 +256,9 @@ TEST_F(FofTest, test_width_negative_index)
 {
 
     /* Tests that negative width index does not have any issues */
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -319,13 +296,9 @@ TEST_F(FofTest, test_dm_negative_index)
 
     /* Test that negative dm index will not have any issues */
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(0.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -363,13 +336,9 @@ TEST_F(FofTest, test_time_negative_index)
 
     /* Test that negative time index will not have any problems */
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -405,14 +374,9 @@ TEST_F(FofTest, test_time_negative_index)
 TEST_F(FofTest, test_group_multiple_candidates_all_parameters)
 {
 
-    data::SpCcl<NumericalRep>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, NumericalRep> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, NumericalRep>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, NumericalRep>>(tf1));
-
-
     // Generate SpCcl instance
-    data::SpCcl<NumericalRep> cand_list(tf_v, data::DimensionIndex<data::Time>(0));
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(50.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -0,0 +1,150 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/modules/sps_clustering/test/GridFofTest.h"
+#include "cheetah/modules/sps_clustering/Fof.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+
+
+namespace ska {
+namespace cheetah {
+namespace modules {
+namespace sps_clustering {
+namespace test {
+
+
+GridFofTest::GridFofTest()
+    : ::testing::Test()
+{
+}
+
+GridFofTest::~GridFofTest()
+{
+}
+
+void GridFofTest::SetUp()
+{
+}
+
+void GridFofTest::TearDown()
+{
+}
+
+TEST_F(GridFofTest, test_empty_list)
+{
+    Config config;
+    GridFof clusterer(config);
+
+    data::SpCcl<NumericalRep> cand_list;
+    auto groups = clusterer(cand_list);
+    ASSERT_EQ(groups.size(), 0U);
+}
+
+TEST_F(GridFofTest, test_points)
+{
+    Config config;
+    GridFof clusterer(config);
+    clusterer.linking_length(1.0);
+
+    // a chain of friends crossing several cells, a lone point, and a point that cannot be compared
+    std::vector<GridFof::PointType> points = {{{ 0.0, 0.0, 0.0 }}
+                                            , {{ 10.0, 10.0, 10.0 }}
+                                            , {{ 0.9, 0.0, 0.0 }}
+                                            , {{ 1.8, -0.1, 0.0 }}
+                                            , {{ 1.8, -0.1, std::numeric_limits<double>::quiet_NaN() }}
+                                            , {{ 2.5, -0.5, 0.3 }}
+                                            , {{ 3.5, -0.5, 0.3 }} // exactly one linking length away: not a friend
+                                            };
+    auto groups = clusterer(points);
+    ASSERT_EQ(groups.size(), 4U);
+    ASSERT_EQ(groups[0], std::vector<std::size_t>({0, 2, 3, 5}));
+    ASSERT_EQ(groups[1], std::vector<std::size_t>({1}));
+    ASSERT_EQ(groups[2], std::vector<std::size_t>({4}));
+    ASSERT_EQ(groups[3], std::vector<std::size_t>({6}));
+}
+
+TEST_F(GridFofTest, test_same_groups_as_fof)
+{
+    data::SpCcl<NumericalRep> cand_list;
+    cand_list.sample_interval(data::SpCcl<NumericalRep>::MsecTimeType(1 * boost::units::si::milli * boost::units::si::seconds));
+
+    // clumps of candidates scattered through the search space
+    std::mt19937 mt(1234);
+    std::uniform_real_distribution<double> time_dist(0.0, 10.0);
+    std::uniform_real_distribution<double> dm_dist(0.0, 500.0);
+    std::uniform_int_distribution<int> width_dist(0, 8);
+    std::normal_distribution<double> offset(0.0, 1.0);
+    for(std::size_t clump=0; clump < 200; ++clump)
+    {
+        double const t = time_dist(mt);
+        double const dm = dm_dist(mt);
+        int const width = width_dist(mt);
+        for(std::size_t idx=0; idx < 10; ++idx)
+        {
+            data::SpCcl<NumericalRep>::SpCandidateType candidate(
+                      data::SpCcl<NumericalRep>::SpCandidateType::Dm((dm + 2.0 * offset(mt)) * pss::astrotypes::units::parsecs_per_cube_cm)
+                    , data::SpCcl<NumericalRep>::SpCandidateType::MsecTimeType(std::abs(t + 0.01 * offset(mt)) * boost::units::si::seconds)
+                    , data::SpCcl<NumericalRep>::SpCandidateType::MsecTimeType((1 << std::max(0, width + (int)offset(mt))) * boost::units::si::milli * boost::units::si::seconds)
+                    , 10.0
+                    , idx);
+            cand_list.push_back(candidate);
+        }
+    }
+
+    Config config;
+    config.dm_tolerance(typename Config::Dm(1.0 * pss::astrotypes::units::parsecs_per_cube_cm));
+    config.pulse_width_tolerance(typename Config::MsecTimeType(0.002 * boost::units::si::seconds));
+    config.time_tolerance(typename Config::MsecTimeType(0.01 * boost::units::si::seconds));
+    config.linking_length(1.7);
+
+    Fof fof(config);
+    auto expected = fof(cand_list);
+    for(auto& group : expected)
+    {
+        std::sort(group.begin(), group.end());
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for(std::size_t number_of_threads : {1, 3})
+    {
+        config.num_threads(number_of_threads);
+        GridFof clusterer(config);
+        auto groups = clusterer(cand_list);
+
+        // groups are ordered by their lowest index which is the order expected is sorted in to
+        ASSERT_EQ(expected.size(), groups.size());
+        for(std::size_t i=0; i < groups.size(); ++i)
+        {
+            ASSERT_TRUE(std::is_sorted(groups[i].begin(), groups[i].end()));
+            ASSERT_EQ(expected[i], groups[i]) << "group " << i << " threads " << number_of_threads;
+        }
+    }
+}
+
+} // namespace test
+} // namespace sps_clustering
+} // namespace modules
+} // namespace cheetah
+} // namespace ska
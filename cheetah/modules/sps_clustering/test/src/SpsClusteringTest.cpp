@@ -24,6 +24,10 @@
 #include "cheetah/modules/sps_clustering/test/SpsClusteringTest.h"
 #include "cheetah/modules/sps_clustering/SpsClustering.h"
 #include "cheetah/modules/sps_clustering/Fof.h"
+#include "cheetah/data/DmTrials.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
+#include <algorithm>
+#include <chrono>
 
 namespace ska {
 namespace cheetah {
@@ -49,13 +53,13 @@ void SpsClusteringTest::TearDown()
 {
 }
 
-TEST_F(SpsClusteringTest, test_sps_clustering_no_tf_blocks)
+TEST_F(SpsClusteringTest, test_sps_clustering_no_sample_interval)
 {
-    /* The test should verify that no clustering happens when no TF blocks are available */
+    /* The test should verify that no clustering happens when the sample interval is unknown */
     //Create new SpCcl<uint8_t> instance
     std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>();
 
-    ASSERT_EQ(cand_list->tf_blocks().size(),std::size_t(0));
+    ASSERT_EQ(cand_list->sample_interval().value(), 0.0);
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -94,19 +98,10 @@ TEST_F(SpsClusteringTest, test_sps_clustering_no_tf_blocks)
 
 TEST_F(SpsClusteringTest, test_sps_clustering_clustering_one_candidate)
 {
-    /* The test should verify that no clustering happens when no TF blocks are available */
+    /* The test should verify that candidates close to each other are merged in to a single candidate */
 
-    data::TimeFrequency<Cpu, uint8_t> tf1(data::DimensionSize<data::Time>(100),data::DimensionSize<data::Frequency>(16));
-
-    tf1.sample_interval(data::TimeFrequency<Cpu, uint8_t>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-
-    data::SpCcl<uint8_t>::BlocksType tf_v;
-    // fill data
-    std::fill(tf1.begin(),tf1.end(),0);
-
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, uint8_t>>(tf1));
-
-    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>(tf_v, data::DimensionIndex<data::Time>(0));
+    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>();
+    cand_list->sample_interval(data::SpCcl<uint8_t>::MsecTimeType(1.0 * data::milliseconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -145,15 +140,9 @@ TEST_F(SpsClusteringTest, test_sps_clustering_clustering_one_candidate)
 
 TEST_F(SpsClusteringTest, test_sps_clustering_multiple_candidates_within_limits)
 {
-
-    data::SpCcl<uint8_t>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, uint8_t> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, uint8_t>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, uint8_t>>(tf1));
-
-
     // Generate SpCcl instance
-    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>(tf_v, data::DimensionIndex<data::Time>(0));
+    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>();
+    cand_list->sample_interval(data::SpCcl<uint8_t>::MsecTimeType(1.0 * data::milliseconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(5000.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -198,15 +187,9 @@ TEST_F(SpsClusteringTest, test_sps_clustering_multiple_candidates_within_limits)
 
 TEST_F(SpsClusteringTest, test_sps_clustering_multiple_candidates_beyond_limits)
 {
-
-    data::SpCcl<uint8_t>::BlocksType tf_v;
-    data::TimeFrequency<Cpu, uint8_t> tf1(data::DimensionSize<data::Time>(100), data::DimensionSize<data::Frequency>(16));
-    tf1.sample_interval(data::TimeFrequency<Cpu, uint8_t>::TimeType(1 * boost::units::si::milli * boost::units::si::seconds));
-    tf_v.push_back(std::make_shared<data::TimeFrequency<Cpu, uint8_t>>(tf1));
-
-
     // Generate SpCcl instance
-    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>(tf_v, data::DimensionIndex<data::Time>(0));
+    std::shared_ptr<data::SpCcl<uint8_t>> cand_list = std::make_shared<data::SpCcl<uint8_t>>();
+    cand_list->sample_interval(data::SpCcl<uint8_t>::MsecTimeType(1.0 * data::milliseconds));
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(5000.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -249,6 +232,145 @@ TEST_F(SpsClusteringTest, test_sps_clustering_multiple_candidates_beyond_limits)
     ASSERT_EQ(grouped_cands->size(),10U);
 }
 
+namespace {
+
+typedef data::SpCcl<uint8_t> SpCclType;
+typedef SpCclType::SpCandidateType CandidateType;
+
+// a 1 second chunk of 1 ms samples
+std::shared_ptr<SpCclType> make_chunk(utils::ModifiedJulianClock::time_point const& start_time)
+{
+    auto metadata = std::make_shared<data::DmTrialsMetadata>(0.001 * data::seconds, 1000);
+    metadata->emplace_back(data::DmTrialsMetadata::DmType(0.0 * data::parsecs_per_cube_cm));
+    return std::make_shared<SpCclType>(SpCclType::DmTrialsType::make_shared(metadata, start_time));
+}
+
+void add_candidate(SpCclType& cands, double dm, double tstart_ms, float sigma, std::size_t ident)
+{
+    cands.push_back(CandidateType(CandidateType::Dm(dm * data::parsecs_per_cube_cm)
+                                , CandidateType::MsecTimeType(tstart_ms * data::milliseconds)
+                                , CandidateType::MsecTimeType(1.0 * data::milliseconds)
+                                , sigma
+                                , ident));
+}
+
+Config chunk_config()
+{
+    Config config;
+    config.dm_tolerance(Config::Dm(5.0 * pss::astrotypes::units::parsecs_per_cube_cm));
+    config.pulse_width_tolerance(Config::MsecTimeType(1.0 * data::milliseconds));
+    config.time_tolerance(Config::MsecTimeType(10.0 * data::milliseconds));
+    config.linking_length(1.5);
+    return config;
+}
+
+bool has_ident(SpCclType const& cands, std::size_t ident)
+{
+    return std::any_of(cands.begin(), cands.end(), [ident](CandidateType const& c) { return c.ident() == ident; });
+}
+
+} // namespace
+
+TEST_F(SpsClusteringTest, test_cluster_carried_across_chunk_boundary)
+{
+    /* a pulse straddling the boundary between two chunks should produce a single candidate
+     * (the lowest dm candidates, ident 0 and 10, are dropped by the dm filter) */
+    Config config = chunk_config();
+    SpsClustering merger(config);
+
+    utils::ModifiedJulianClock::time_point start(utils::julian_day(2458179.5));
+    auto chunk_1 = make_chunk(start);
+    add_candidate(*chunk_1, 0.0, 100.0, 6.0, 0);
+    add_candidate(*chunk_1, 30.0, 500.0, 10.0, 1);   // isolated pulse
+    add_candidate(*chunk_1, 30.0, 990.0, 8.0, 2);    // start of the straddling pulse
+    add_candidate(*chunk_1, 30.5, 995.0, 12.0, 3);
+
+    auto out_1 = merger(chunk_1);
+    ASSERT_EQ(1U, out_1->size());
+    ASSERT_TRUE(has_ident(*out_1, 1));
+
+    start += std::chrono::duration<double, std::milli>(1000.0);
+    auto chunk_2 = make_chunk(start);
+    add_candidate(*chunk_2, 31.0, 0.0, 9.0, 4);      // end of the straddling pulse
+    add_candidate(*chunk_2, 31.5, 5.0, 7.0, 5);
+    add_candidate(*chunk_2, 0.0, 100.0, 6.0, 10);
+    add_candidate(*chunk_2, 40.0, 400.0, 11.0, 6);   // isolated pulse
+
+    auto out_2 = merger(chunk_2);
+    ASSERT_EQ(2U, out_2->size());
+    ASSERT_TRUE(has_ident(*out_2, 3)); // the brightest member of the straddling pulse
+    ASSERT_TRUE(has_ident(*out_2, 6));
+    for(auto const& candidate : *out_2)
+    {
+        if(candidate.ident() == 3) {
+            // expressed relative to the start of the second chunk
+            ASSERT_NEAR(-5.0, candidate.tstart().value(), 0.01);
+        }
+    }
+}
+
+TEST_F(SpsClusteringTest, test_chunk_before_previous_chunk_resets_carry)
+{
+    /* a chunk that starts before the previous one must not have its candidates discarded as already processed */
+    Config config = chunk_config();
+    SpsClustering merger(config);
+
+    utils::ModifiedJulianClock::time_point start(utils::julian_day(2458179.5));
+    start += std::chrono::duration<double, std::milli>(1000.0);
+    auto chunk_1 = make_chunk(start);
+    add_candidate(*chunk_1, 0.0, 100.0, 6.0, 0);
+    add_candidate(*chunk_1, 30.0, 990.0, 8.0, 1);    // held back
+    add_candidate(*chunk_1, 30.5, 995.0, 12.0, 2);
+
+    auto out_1 = merger(chunk_1);
+    ASSERT_EQ(0U, out_1->size());
+
+    start -= std::chrono::duration<double, std::milli>(1000.0);
+    auto chunk_2 = make_chunk(start);
+    add_candidate(*chunk_2, 0.0, 100.0, 6.0, 10);
+    add_candidate(*chunk_2, 40.0, 10.0, 11.0, 3);    // before the point clusters were held back from
+
+    auto out_2 = merger(chunk_2);
+    ASSERT_EQ(2U, out_2->size());
+    ASSERT_TRUE(has_ident(*out_2, 2)); // the held back cluster is flushed
+    ASSERT_TRUE(has_ident(*out_2, 3));
+}
+
+TEST_F(SpsClusteringTest, test_flush_emits_held_back_clusters)
+{
+    /* at the end of the stream the clusters held back from the last chunk are emitted */
+    Config config = chunk_config();
+    SpsClustering merger(config);
+
+    ASSERT_EQ(0U, merger.flush<uint8_t>()->size());
+
+    utils::ModifiedJulianClock::time_point start(utils::julian_day(2458179.5));
+    auto chunk_1 = make_chunk(start);
+    add_candidate(*chunk_1, 0.0, 100.0, 6.0, 0);
+    add_candidate(*chunk_1, 30.0, 500.0, 10.0, 1);
+    add_candidate(*chunk_1, 30.0, 990.0, 8.0, 2);    // held back
+    add_candidate(*chunk_1, 30.5, 995.0, 12.0, 3);
+
+    auto out_1 = merger(chunk_1);
+    ASSERT_EQ(1U, out_1->size());
+    ASSERT_TRUE(has_ident(*out_1, 1));
+
+    auto flushed = merger.flush<uint8_t>();
+    ASSERT_EQ(1U, flushed->size());
+    ASSERT_TRUE(has_ident(*flushed, 3));
+    ASSERT_TRUE(start == flushed->start_time());
+    ASSERT_NEAR(995.0, (*flushed)[0].tstart().value(), 0.01);
+
+    // nothing is left to flush, and a new stream is not treated as already processed
+    ASSERT_EQ(0U, merger.flush<uint8_t>()->size());
+    auto chunk_2 = make_chunk(start);
+    add_candidate(*chunk_2, 0.0, 100.0, 6.0, 10);
+    add_candidate(*chunk_2, 40.0, 10.0, 11.0, 4);
+    auto out_2 = merger(chunk_2);
+    ASSERT_EQ(1U, out_2->size());
+    ASSERT_TRUE(has_ident(*out_2, 4));
+}
+
 } // namespace test
 } // namespace sps_clustering
 } // namespace modules
@@ -70,8 +70,8 @@ class Config : public utils::Config
         /**
          * @brief Maximum number of candidates that are allowed to remain in the SpCcl
          * object after the thresholding has been applied (0 = unlimited candidates).
-         * If the number of candidates exceeds this limit, the SpCcl candidate list is
-         * truncated.
+         * If the number of candidates exceeds this limit, only the candidates with the
+         * highest S/N are kept.
          */
         std::size_t maximum_candidates() const;
         void maximum_candidates(std::size_t const& numcands_threshold);
@@ -41,9 +41,11 @@ namespace spsift {
  * 2. S/N is below threshold
  * 3. Width is *above* threshold (wide pulses are more likely to be RFI)
  * There is an additional configuration parameter called 'maximum_candidates';
- * if non-zero, the input SpCcl is trimmed down to that number of candidates.
- * @todo The maximum_candidates condition is currently enforced before the thresholding,
- * which is a mistake, it should be enforced *after*.
+ * if non-zero, only that number of candidates with the highest S/N are kept after the
+ * thresholding (the order of the remaining candidates is preserved).
+ *
+ * The thresholding and the capping are also available separately so that other stages (e.g. clustering)
+ * can be run between them.
  */
 
 class SpSift
@@ -64,6 +66,18 @@ class SpSift
         template<typename NumRep>
         void operator()(data::SpCcl<NumRep>& candidate_list) const;
 
+        /**
+         * @brief Remove all candidates on the wrong side of any threshold.
+         */
+        template<typename NumRep>
+        void threshold(data::SpCcl<NumRep>& candidate_list) const;
+
+        /**
+         * @brief Keep only the maximum_candidates candidates with the highest S/N
+         */
+        template<typename NumRep>
+        void cap(data::SpCcl<NumRep>& candidate_list) const;
+
     private:
         Config const& _config;
 };
@@ -22,8 +22,12 @@
  * SOFTWARE.
  */
 #include "cheetah/modules/spsift/SpSift.h"
+#include "panda/Log.h"
 #include <algorithm>
-#include <chrono>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -33,18 +37,16 @@ namespace spsift {
 template<typename NumRep>
 void SpSift::operator()(data::SpCcl<NumRep>& candidate_list) const
 {
-    PANDA_LOG << "Total number of candidates: " << candidate_list.size();
-    /*
-    //auto start = std::chrono::high_resolution_clock::now();
     if(!_config.active()) return;
-    /// TODO: The trimming of the candidate list needs to be done *AFTER* the thresholding !
-    /// i.e. first remove the candidates that are certainly spurious, and only then limit the
-    /// size of the list if necessary.
-    /// Currently we can can lose good candidates for no reason.
-    if (_config.maximum_candidates() > 0 && candidate_list.size() > _config.maximum_candidates())
-    {
-	    candidate_list.resize(_config.maximum_candidates());
-    }
+    threshold(candidate_list);
+    cap(candidate_list);
+}
+
+template<typename NumRep>
+void SpSift::threshold(data::SpCcl<NumRep>& candidate_list) const
+{
+    if(!_config.active()) return;
+    std::size_t const number_of_candidates = candidate_list.size();
     candidate_list.remove_if(
                 [this](typename data::SpCcl<NumRep>::SpCandidateType const& candidate)
                 {
@@ -52,7 +54,52 @@ void SpSift::operator()(data::SpCcl<NumRep>& candidate_list) const
                     || candidate.width() > _config.pulse_width_threshold()
                     || candidate.sigma() < _config.sigma_threshold());
                 });
-    */
+    PANDA_LOG_DEBUG << "SpSift: " << candidate_list.size() << " of " << number_of_candidates << " candidates pass the thresholds";
+}
+
+template<typename NumRep>
+void SpSift::cap(data::SpCcl<NumRep>& candidate_list) const
+{
+    if(!_config.active()) return;
+    std::size_t const budget = _config.maximum_candidates();
+    if(budget == 0 || candidate_list.size() <= budget) return;
+
+    // min-heap of the budget highest S/N candidates seen so far
+    typedef typename data::SpCcl<NumRep>::SpCandidateType::SigmaType SigmaType;
+    typedef std::pair<SigmaType, std::size_t> EntryType;
+    std::vector<EntryType> heap_store;
+    heap_store.reserve(budget + 1);
+    std::priority_queue<EntryType, std::vector<EntryType>, std::greater<EntryType>> heap(std::greater<EntryType>(), std::move(heap_store));
+    for(std::size_t i=0; i < candidate_list.size(); ++i)
+    {
+        if(heap.size() < budget)
+        {
+            heap.emplace(candidate_list[i].sigma(), i);
+        }
+        else if(candidate_list[i].sigma() > heap.top().first)
+        {
+            heap.pop();
+            heap.emplace(candidate_list[i].sigma(), i);
+        }
+    }
+
+    std::vector<bool> keep(candidate_list.size(), false);
+    while(!heap.empty())
+    {
+        keep[heap.top().second] = true;
+        heap.pop();
+    }
+
+    PANDA_LOG_WARN << "SpSift: candidate budget exceeded, keeping the " << budget << " highest S/N of " << candidate_list.size() << " candidates";
+    // compact the kept candidates to the front, preserving their (time) order
+    std::size_t kept = 0;
+    for(std::size_t i=0; i < candidate_list.size(); ++i)
+    {
+        if(!keep[i]) continue;
+        if(kept != i) candidate_list[kept] = std::move(candidate_list[i]);
+        ++kept;
+    }
+    candidate_list.resize(kept);
 }
 
 } // namespace spsift
@@ -65,7 +65,7 @@ void Config::add_options(OptionsDescriptionEasyInit& add_options )
         }), "Pulse width threshold in ms"
     )
     ("maximum_candidates", boost::program_options::value<std::size_t>(&_maximum_candidates)->default_value(_maximum_candidates),
-        "Threshold for maximum number of candidates. If the number of candidates exceeds the threshold then we resize the list to the threshold. A value of 0 sets the threshold to unlimited."
+        "Per chunk candidate budget. If the number of candidates exceeds the budget then only the highest S/N candidates are kept. A value of 0 sets the budget to unlimited."
     );
 }
 
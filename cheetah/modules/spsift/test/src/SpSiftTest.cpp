@@ -49,14 +49,12 @@ void SpSiftTest::TearDown()
 
 TEST_F(SpSiftTest, test_sift_dm)
 {
-    typedef data::SpCcl<uint8_t>::BlocksType::value_type::element_type TimeFrequencyType;
-
     std::size_t idx;
 
     //Create new SpCcl<uint8_t> instance
     data::SpCcl<uint8_t> cand_list;
 
-    ASSERT_EQ(cand_list.tf_blocks().size(),std::size_t(0));
+    ASSERT_TRUE(cand_list.empty());
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -99,14 +97,12 @@ TEST_F(SpSiftTest, test_sift_dm)
 
 TEST_F(SpSiftTest, test_sift_width)
 {
-    typedef data::SpCcl<uint8_t>::BlocksType::value_type::element_type TimeFrequencyType;
-
     std::size_t idx;
 
     //Create new SpCcl<uint8_t> instance
     data::SpCcl<uint8_t> cand_list;
 
-    ASSERT_EQ(cand_list.tf_blocks().size(),std::size_t(0));
+    ASSERT_TRUE(cand_list.empty());
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -150,14 +146,12 @@ TEST_F(SpSiftTest, test_sift_width)
 
 TEST_F(SpSiftTest, test_sift_sigma)
 {
-    typedef data::SpCcl<uint8_t>::BlocksType::value_type::element_type TimeFrequencyType;
-
     std::size_t idx;
 
     //Create new SpCcl<uint8_t> instance
     data::SpCcl<uint8_t> cand_list;
 
-    ASSERT_EQ(cand_list.tf_blocks().size(),std::size_t(0));
+    ASSERT_TRUE(cand_list.empty());
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -201,12 +195,10 @@ TEST_F(SpSiftTest, test_sift_sigma)
 
 TEST_F(SpSiftTest, test_sift_many_candidates)
 {
-    typedef data::SpCcl<uint8_t>::BlocksType::value_type::element_type TimeFrequencyType;
-
     //Create new SpCcl<uint8_t> instance
     data::SpCcl<uint8_t> cand_list;
 
-    ASSERT_EQ(cand_list.tf_blocks().size(),std::size_t(0));
+    ASSERT_TRUE(cand_list.empty());
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -245,12 +237,10 @@ TEST_F(SpSiftTest, test_sift_many_candidates)
 
 TEST_F(SpSiftTest, test_sift_many_candidates_0threshold)
 {
-    typedef data::SpCcl<uint8_t>::BlocksType::value_type::element_type TimeFrequencyType;
-
     //Create new SpCcl<uint8_t> instance
     data::SpCcl<uint8_t> cand_list;
 
-    ASSERT_EQ(cand_list.tf_blocks().size(),std::size_t(0));
+    ASSERT_TRUE(cand_list.empty());
 
     //set single pulse candidate dispersion measure
     typename Config::Dm dm(12.0 * pss::astrotypes::units::parsecs_per_cube_cm);
@@ -287,6 +277,35 @@ TEST_F(SpSiftTest, test_sift_many_candidates_0threshold)
     ASSERT_EQ(cand_list.size(), 100000U);
 }
 
+TEST_F(SpSiftTest, test_candidate_budget_after_thresholds)
+{
+    // candidates alternate between below and above the dm threshold, with increasing sigma
+    data::SpCcl<uint8_t> cand_list;
+    data::SpCcl<uint8_t>::SpCandidateType::MsecTimeType width(0.001 * boost::units::si::seconds);
+    data::SpCcl<uint8_t>::SpCandidateType::MsecTimeType tstart(0.0 * boost::units::si::seconds);
+    for (std::size_t idx=0; idx<100; ++idx)
+    {
+        typename Config::Dm dm(((idx % 2) ? 20.0 : 5.0) * pss::astrotypes::units::parsecs_per_cube_cm);
+        cand_list.push_back(data::SpCcl<uint8_t>::SpCandidateType(dm, tstart, width, (float)(100 - idx), idx));
+        tstart += data::SpCcl<uint8_t>::SpCandidateType::MsecTimeType(1.0*boost::units::si::seconds);
+    }
+
+    Config config;
+    config.dm_threshold(typename Config::Dm(10.0 * pss::astrotypes::units::parsecs_per_cube_cm));
+    config.sigma_threshold(0.0);
+    config.maximum_candidates(10);
+
+    SpSift sifter(config);
+    sifter(cand_list);
+
+    // the budget is applied after the thresholds, keeping the highest sigma, in the original order
+    ASSERT_EQ(cand_list.size(), 10U);
+    for (std::size_t idx=0; idx<10; ++idx)
+    {
+        ASSERT_EQ(cand_list[idx].ident(), 2 * idx + 1);
+    }
+}
+
 } // namespace test
 } // namespace spsift
 } // namespace modules
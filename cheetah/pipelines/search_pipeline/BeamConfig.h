@@ -107,14 +107,24 @@ class BeamConfig : public utils::Config
          */
         bool active() const;
 
+        /**
+         * @brief the cores this beam runs on
+         * @details the configured thread affinities or, if none are set, any assigned at runtime
+         */
         std::vector<unsigned> const& affinities() const;
 
+        /**
+         * @brief set the cores to use when no thread affinities are configured (e.g. from the NUMA topology)
+         */
+        void assign_affinities(std::vector<unsigned> const& cores);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
     private:
         bool _active;
         panda::ThreadConfig _thread_config;
+        std::vector<unsigned> _assigned_affinities;
         sigproc::Config _sigproc_config;
         psrdada::Config _psrdada_config;
         data::DataSrcConfig _data_src_config;
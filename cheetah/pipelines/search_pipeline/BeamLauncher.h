@@ -27,6 +27,7 @@
 #include "cheetah/pipelines/search_pipeline/MultiBeamConfig.h"
 #include "cheetah/pipelines/search_pipeline/BeamConfig.h"
 #include "cheetah/pipelines/search_pipeline/PipelineHandler.h"
+#include "cheetah/utils/NumaTopology.h"
 #include <vector>
 #include <functional>
 #include <condition_variable>
@@ -54,7 +55,7 @@ class BeamLauncher
     public:
 
         template<typename StreamConfigFactory, typename PipelineFactory>
-        BeamLauncher(MultiBeamConfig<NumericalT> const& mb_config, StreamConfigFactory const& config_factory, PipelineFactory const& pipeline_factory);
+        BeamLauncher(MultiBeamConfig<NumericalT>& mb_config, StreamConfigFactory const& config_factory, PipelineFactory const& pipeline_factory);
         ~BeamLauncher();
 
         /** @brief launch the beam pipelines
@@ -73,12 +74,13 @@ class BeamLauncher
         std::vector<std::unique_ptr<StreamType>>& streams();
 
     private:
-        MultiBeamConfig<NumericalT> const& _multi_beam_config;
+        MultiBeamConfig<NumericalT>& _multi_beam_config;
         bool _exit;
         std::mutex _mutex;
         std::condition_variable _wait_cv;
         std::vector<std::unique_ptr<panda::Thread>> _threads;
-        std::vector<panda::ThreadConfig const*> _thread_config;
+        std::vector<std::vector<unsigned>> _affinities;
+        std::vector<int> _numa_nodes; // index of the NUMA node local to each beam (-1 if unbound)
         std::vector<std::unique_ptr<StreamType>> _streams;
         std::vector<std::unique_ptr<detail::PipelineHandlerWrapperBase>> _runtime_handlers;
         std::vector<std::unique_ptr<detail::PipelineWrapperBase>> _pipelines;
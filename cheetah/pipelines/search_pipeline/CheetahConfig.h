@@ -41,6 +41,7 @@
 
 #include <boost/program_options.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <string>
 #include <vector>
@@ -83,6 +84,17 @@ class CheetahConfig : public utils::Config
          */
         bool time_handler_invocation() const;
 
+        /**
+         * @brief the file to which per stage latency histograms are periodically written
+         * @details empty if latency histograms have not been requested
+         */
+        std::string const& latency_histogram_file() const;
+
+        /**
+         * @brief the interval between successive latency histogram snapshots
+         */
+        std::chrono::milliseconds latency_histogram_interval() const;
+
         /**
          * @brief return the selected pipeline name
          */
@@ -97,6 +109,7 @@ class CheetahConfig : public utils::Config
          * @brief return the configuration node with beam configurations
          */
         MultiBeamConfig<NumericalRep> const& beams_config() const;
+        MultiBeamConfig<NumericalRep>& beams_config();
 
         /**
          * @brief return the channel_mask configuration
@@ -175,6 +188,12 @@ class CheetahConfig : public utils::Config
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
+        /**
+         * @brief extend the generic (top level) options, e.g. for applications that reuse this configuration
+         * @details must be called before parse()
+         */
+        void add_generic_options(boost::program_options::options_description const& options);
+
     private:
         boost::program_options::options_description _desc;
         boost::program_options::options_description _all_desc;
@@ -186,6 +205,8 @@ class CheetahConfig : public utils::Config
         std::vector<std::string> _pipeline_handler_names;
         std::string _pipeline_name;
         bool _handler_timing;
+        std::string _latency_histogram_file;
+        double _latency_histogram_interval; // seconds
         mutable panda::DataSwitchConfig _switch_config; // contains the thread pools used by other objects
                                                         // so should be destroyed after MultiBeamConfig
 
@@ -27,7 +27,9 @@
 
 #include "cheetah/utils/Config.h"
 #include "cheetah/pipelines/search_pipeline/BeamConfig.h"
+#include "cheetah/utils/NumaTopology.h"
 #include <string>
+#include <vector>
 
 namespace ska {
 namespace cheetah {
@@ -61,11 +63,33 @@ class MultiBeamConfig : public utils::Config
          */
         ConstIterator beams_end() const;
 
+        /**
+         * @brief the beam configuration with the given id
+         * @throw panda::Error if no such beam is configured
+         */
+        BeamConfigType<NumericalT>& beam(std::string const& id);
+
+        /**
+         * @brief true if beams without configured affinities should be assigned cores from the NUMA topology
+         */
+        bool numa_affinity() const;
+
+        /**
+         * @brief enable/disable the automatic NUMA core assignment
+         */
+        void numa_affinity(bool enable);
+
+        /**
+         * @brief give each active beam without configured thread affinities a set of cores local to a single NUMA node
+         */
+        void assign_numa_affinities(utils::NumaTopology const& topology);
+
     protected:
         void add_options(OptionsDescriptionEasyInit& add_options) override;
 
     private:
         PoolManagerType& _pool_manager;
+        bool _numa_affinity;
 
 };
 
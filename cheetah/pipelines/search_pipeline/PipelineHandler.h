@@ -71,9 +71,15 @@ class PipelineHandler
          */
         void halt();
 
+        /**
+         * @brief the id of the beam this handler is processing (for tagging diagnostics)
+         */
+        std::string const& beam_id() const;
+
     private:
         CheetahConfig<NumericalT> const& _config;
         DataExport<NumericalT>& _out;
+        std::string _beam_id;
 };
 
 } // namespace search_pipeline
@@ -29,7 +29,8 @@
 #include "cheetah/modules/rfim/policy/LastUnflagged.h"
 #include "cheetah/channel_mask/ConfigurableChannelMask.h"
 #include "cheetah/channel_mask/PolicyFactory.h"
-#include "panda/ModuloNumber.h"
+#include "cheetah/utils/LatencyMonitor.h"
+#include "cheetah/utils/ReorderBuffer.h"
 
 namespace ska {
 namespace cheetah {
@@ -73,6 +74,9 @@ class RfiDetectionPipeline : public PipelineHandler<NumericalT>
         /// access to the output handler object
         RfimOutputHandler& output_handler();
 
+        /// the queue restoring the order of the rfim output (for monitoring depth and stall times)
+        utils::ReorderBuffer<TimeFrequencyType const*> const& sequencing_queue() const;
+
     private:
         class RfiOutputHandler {
                 typedef typename modules::rfim::PolicyInfo<RfiPolicy>::ReturnType ReturnType;
@@ -113,9 +117,11 @@ class RfiDetectionPipeline : public PipelineHandler<NumericalT>
         RfiOutputHandler _rfim_handler;
         BandPassOutputHandler _bandpass_handler;
         RfimType _rfim;
-        std::vector<TimeFrequencyType*> _data_sequence;
-        panda::AtomicModuloNumber<unsigned, std::memory_order_relaxed> _last_data_sequence_index;
-        panda::AtomicModuloNumber<unsigned, std::memory_order_relaxed> _next_data_sequence_index;
+        utils::ReorderBuffer<TimeFrequencyType const*> _data_sequence;
+        std::vector<utils::LatencyHistogram::ClockType::time_point> _data_sequence_start; // rfim submission times, indexed by sequence number modulo capacity
+        utils::LatencyHistogram& _rfim_latency;
+        utils::LatencyHistogram& _export_latency;
+        utils::LatencyHistogram& _backpressure_latency;
 };
 
 } // namespace search_pipeline
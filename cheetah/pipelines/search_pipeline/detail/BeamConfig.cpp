@@ -120,9 +120,16 @@ void BeamConfig<NumericalT>::active(bool active)
 template<typename NumericalT>
 std::vector<unsigned> const& BeamConfig<NumericalT>::affinities() const
 {
+    if(_thread_config.affinities().empty()) return _assigned_affinities;
     return _thread_config.affinities();
 }
 
+template<typename NumericalT>
+void BeamConfig<NumericalT>::assign_affinities(std::vector<unsigned> const& cores)
+{
+    _assigned_affinities = cores;
+}
+
 } // namespace search_pipeline
 } // namespace pipelines
 } // namespace cheetah
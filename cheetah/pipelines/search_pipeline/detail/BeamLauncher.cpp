@@ -26,6 +26,7 @@
 #include "cheetah/pipelines/search_pipeline/PipelineHandlerFactory.h"
 #include "panda/Thread.h"
 #include <algorithm>
+#include <sstream>
 #include <type_traits>
 
 namespace ska {
@@ -140,11 +141,16 @@ namespace detail {
 
 template<typename InputDataStream, typename NumericalT>
 template<typename ConfigFactory, typename PipelineFactory>
-BeamLauncher<InputDataStream, NumericalT>::BeamLauncher(MultiBeamConfig<NumericalT> const& multi_beams_config, ConfigFactory const& config_factory, PipelineFactory const& runtime_handler_factory)
+BeamLauncher<InputDataStream, NumericalT>::BeamLauncher(MultiBeamConfig<NumericalT>& multi_beams_config, ConfigFactory const& config_factory, PipelineFactory const& runtime_handler_factory)
     : _multi_beam_config(multi_beams_config)
     , _exit(false)
     , _execution_count(0)
 {
+    utils::NumaTopology const& topology = utils::NumaTopology::system();
+    if(multi_beams_config.numa_affinity()) {
+        _multi_beam_config.assign_numa_affinities(topology);
+    }
+
     auto it=multi_beams_config.beams();
     PANDA_LOG << "Creating Beams....";
     while(it != multi_beams_config.beams_end())
@@ -155,17 +161,35 @@ BeamLauncher<InputDataStream, NumericalT>::BeamLauncher(MultiBeamConfig<Numerica
             // create the stream
             _streams.emplace_back(std::move(std::unique_ptr<InputDataStream>(new InputDataStream(config_factory(beam_config)))));
 
-            // create the compute section of the pipeline
+            // create the compute section of the pipeline.
+            // Constructed on the beam's own cores so its buffers are first touched on the local NUMA node
             typedef decltype(runtime_handler_factory(beam_config)) RuntimeHandlerPtrType;
             typedef typename std::remove_pointer<RuntimeHandlerPtrType>::type RuntimeHandlerType;
             typedef detail::PipelineHandlerWrapper<RuntimeHandlerType> WrapperHandlerType;;
-            _runtime_handlers.emplace_back(new WrapperHandlerType(runtime_handler_factory(beam_config)));
+            RuntimeHandlerPtrType runtime_handler = nullptr;
+            topology.run_local(beam_config.affinities(), [&]() { runtime_handler = runtime_handler_factory(beam_config); });
+            _runtime_handlers.emplace_back(new WrapperHandlerType(runtime_handler));
 
             // now init a suitable pipeline
             auto pipeline = create_pipeline<InputDataStream>(*_streams.back(), *static_cast<WrapperHandlerType&>(*_runtime_handlers.back()));
             _pipelines.emplace_back(new detail::PipelineWrapper<decltype(pipeline)>(std::move(pipeline), beam_config.id()));
 
-            _thread_config.push_back(&beam_config.thread_config());
+            _affinities.push_back(beam_config.affinities());
+            int const node = topology.node_of_cpus(_affinities.back());
+            _numa_nodes.push_back(node);
+
+            // report the layout
+            std::stringstream cores;
+            for(unsigned core : _affinities.back()) cores << core << " ";
+            if(node < 0) {
+                PANDA_LOG << "Beam " << beam_config.id() << ": not bound to any cores";
+            }
+            else {
+                PANDA_LOG << "Beam " << beam_config.id() << ": cores [ " << cores.str() << "] NUMA node " << topology.node_id(node);
+                if(topology.spans_nodes(_affinities.back())) {
+                    PANDA_LOG_WARN << "Beam " << beam_config.id() << ": cores span more than one NUMA node, memory will be local to node " << topology.node_id(node) << " only";
+                }
+            }
         }
         ++it;
     }
@@ -187,10 +211,13 @@ int BeamLauncher<InputDataStream, NumericalT>::exec()
     if(_execution_count != 0) return 0; // don't try to start if its already running
     std::atomic<std::size_t> execution_start;
     execution_start = 0;
-    auto beam_thread = [&](detail::PipelineWrapperBase& pipeline, int& rv)
+    auto beam_thread = [&](detail::PipelineWrapperBase& pipeline, int& rv, int numa_node)
     {
         rv = 0;
 
+        // buffers created lazily (e.g. on the first data) should also be node local
+        if(numa_node >= 0) utils::NumaTopology::prefer_node(utils::NumaTopology::system().node_id(numa_node));
+
         // run the thread
         ++_execution_count;
         ++execution_start;
@@ -222,7 +249,7 @@ int BeamLauncher<InputDataStream, NumericalT>::exec()
         for(std::size_t ii = 0; ii < _pipelines.size(); ++ii)
         {
             PANDA_LOG << "Starting Beam: " << _pipelines[ii]->id();
-            _threads.emplace_back(new panda::Thread(_thread_config[ii]->affinities(), [&, ii, this]() { beam_thread(*_pipelines[ii], rv[ii]); } ));
+            _threads.emplace_back(new panda::Thread(_affinities[ii], [&, ii, this]() { beam_thread(*_pipelines[ii], rv[ii], _numa_nodes[ii]); } ));
         }
     }
     _wait_cv.wait(lock, [&, this]{
@@ -43,6 +43,7 @@ CheetahConfig<NumericalRep>::CheetahConfig(std::string const& app_name)
     , _system(utils::system())
     , _stream_name("sigproc")
     , _handler_timing(false)
+    , _latency_histogram_interval(10.0)
     , _pool_manager(_system, _pool_manager_config)
     , _beam_config(_pool_manager)
     , _ddtr_config(_pool_manager)
@@ -56,6 +57,8 @@ CheetahConfig<NumericalRep>::CheetahConfig(std::string const& app_name)
         ("help-config-file", "information about the configuration file and its format")
         ("help-module", boost::program_options::value<std::vector<std::string>>(), "display help message for the specified modules (see --list-modules)")
         ("timer", "record execution time for each invocation of the computation part of the pipeline")
+        ("latency-histograms", boost::program_options::value<std::string>(&_latency_histogram_file), "record per stage, per beam latency histograms and periodically append JSON snapshots of them to the specified file")
+        ("latency-histograms-interval", boost::program_options::value<double>(&_latency_histogram_interval)->default_value(_latency_histogram_interval), "the interval (in seconds) between latency histogram snapshots")
         ("input-stream,s", boost::program_options::value<std::string>()->default_value("sigproc")->required(), "select the input stream for the pipeline (see list-sources)")
         ("log-level", boost::program_options::value<std::vector<std::string>>()->notifier(
                     [](std::vector<std::string> const& levels) {
@@ -98,8 +101,8 @@ CheetahConfig<NumericalRep>::CheetahConfig(std::string const& app_name)
     add(_rfim_config);
     add(_scan_config);
     add(_spdt_config);
-//    add(_spsift_config);
-//    add(_sps_clustering_config);
+    add(_spsift_config);
+    add(_sps_clustering_config);
     add(_empty_config);
     _all_desc.add(_desc);
     _all_desc.add(command_line_options());
@@ -120,6 +123,13 @@ void CheetahConfig<NumericalRep>::add_options(OptionsDescriptionEasyInit& )
 {
 }
 
+template<typename NumericalRep>
+void CheetahConfig<NumericalRep>::add_generic_options(boost::program_options::options_description const& options)
+{
+    _desc.add(options);
+    _all_desc.add(options);
+}
+
 template<typename NumericalRep>
 std::string CheetahConfig<NumericalRep>::version() const
 {
@@ -144,6 +154,18 @@ bool CheetahConfig<NumericalRep>::time_handler_invocation() const
     return _handler_timing;
 }
 
+template<typename NumericalRep>
+std::string const& CheetahConfig<NumericalRep>::latency_histogram_file() const
+{
+    return _latency_histogram_file;
+}
+
+template<typename NumericalRep>
+std::chrono::milliseconds CheetahConfig<NumericalRep>::latency_histogram_interval() const
+{
+    return std::chrono::milliseconds(static_cast<std::chrono::milliseconds::rep>(_latency_histogram_interval * 1000.0));
+}
+
 template<typename NumericalRep>
 void CheetahConfig<NumericalRep>::set_pipeline_handlers(std::vector<std::string> const& handler_names)
 {
@@ -261,6 +283,12 @@ MultiBeamConfig<NumericalRep> const& CheetahConfig<NumericalRep>::beams_config()
     return _beam_config;
 }
 
+template<typename NumericalRep>
+MultiBeamConfig<NumericalRep>& CheetahConfig<NumericalRep>::beams_config()
+{
+    return _beam_config;
+}
+
 template<typename NumericalRep>
 channel_mask::ConfigurableChannelMaskConfig<NumericalRep> const& CheetahConfig<NumericalRep>::channel_mask_config() const
 {
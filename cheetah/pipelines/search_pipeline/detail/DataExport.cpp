@@ -29,6 +29,7 @@
 #include "cheetah/io/exporters/SpCandidateDataStreamer.h"
 #include "cheetah/io/exporters/SclCandidateDataStreamer.h"
 #include "cheetah/io/exporters/SpCclFileStreamer.h"
+#include "cheetah/io/exporters/SpCclBinaryFileStreamer.h"
 #include "cheetah/io/exporters/SpCclSpeadStreamer.h"
 //#include "cheetah/io/exporters/SpCclSigProc.h"
 #include <panda/Log.h>
@@ -105,6 +106,18 @@ struct SpsCandidateStreamer : public DataExportStreamWrapper<io::exporters::SpCc
         }
 };
 */
+template<typename NumRep, typename T>
+struct SpsCandidateBinaryStreamer : public DataExportStreamWrapper<io::exporters::SpCclBinaryFileStreamer<NumRep>, T>
+{
+    typedef DataExportStreamWrapper<io::exporters::SpCclBinaryFileStreamer<NumRep>, T> BaseT;
+
+    public:
+        SpsCandidateBinaryStreamer(io::exporters::SpCclBinaryFileStreamerConfig const& config)
+            : BaseT(config)
+        {
+        }
+};
+
 template<typename T>
 struct SpsCandidateDataStreamer : public DataExportStreamWrapper<io::exporters::SpCandidateDataStreamer<typename T::TimeFrequencyType>, T>
 {
@@ -211,6 +224,12 @@ DataExport<NumRep, ExportTraits>::DataExport(io::exporters::DataExportConfig con
         }
     );
     */
+    this->template set_factory<data::SpCcl<NumRep>>(io::exporters::ExporterType("spccl_binary_files"),
+        [](io::exporters::DataExportStreamConfig const& c)
+        {
+            return SpsCandidateBinaryStreamer<NumRep, data::SpCcl<NumRep>>(static_cast<io::exporters::SpCclBinaryFileStreamerConfig const&>(c.sink_config()));
+        }
+    );
 #ifdef ENABLE_SPEAD
     this->template set_factory<data::SpCcl<NumRep>>(io::exporters::ExporterType("spccl_spead"),
         [](io::exporters::DataExportStreamConfig const& c)
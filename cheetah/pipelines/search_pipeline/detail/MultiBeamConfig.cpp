@@ -22,6 +22,8 @@
  * SOFTWARE.
  */
 #include "cheetah/pipelines/search_pipeline/MultiBeamConfig.h"
+#include "panda/Error.h"
+#include "panda/Log.h"
 
 namespace ska {
 namespace cheetah {
@@ -38,8 +40,9 @@ template<typename NumericalT>
 MultiBeamConfig<NumericalT>::MultiBeamConfig(PoolManagerType& pool_manager)
     : BaseT("beams")
     , _pool_manager(pool_manager)
+    , _numa_affinity(false)
 {
-    add_factory(beam_tag(), [this]() { return new BeamConfigType<NumericalT>(_pool_manager); } );
+    add_factory(beam_tag(), [this]() { return new BeamConfigType<NumericalT>(_pool_manager); });
 }
 
 template<typename NumericalT>
@@ -60,8 +63,56 @@ typename MultiBeamConfig<NumericalT>::ConstIterator MultiBeamConfig<NumericalT>:
 }
 
 template<typename NumericalT>
-void MultiBeamConfig<NumericalT>::add_options(OptionsDescriptionEasyInit&)
+BeamConfigType<NumericalT>& MultiBeamConfig<NumericalT>::beam(std::string const& id)
 {
+    for(auto it=beams(); it != beams_end(); ++it) {
+        if(it->id() == id) {
+            // the subsections are owned (and were created non-const) by this config
+            return const_cast<BeamConfigType<NumericalT>&>(*it);
+        }
+    }
+    panda::Error e("no beam configured with id: ");
+    e << id;
+    throw e;
+}
+
+template<typename NumericalT>
+bool MultiBeamConfig<NumericalT>::numa_affinity() const
+{
+    return _numa_affinity;
+}
+
+template<typename NumericalT>
+void MultiBeamConfig<NumericalT>::numa_affinity(bool enable)
+{
+    _numa_affinity = enable;
+}
+
+template<typename NumericalT>
+void MultiBeamConfig<NumericalT>::assign_numa_affinities(utils::NumaTopology const& topology)
+{
+    // the active beams in configuration order
+    std::vector<std::string> active_beams;
+    for(auto it=beams(); it != beams_end(); ++it) {
+        if(it->active()) active_beams.push_back(it->id());
+    }
+    auto const assignment = topology.assign_cores(active_beams.size());
+
+    for(std::size_t beam_index=0; beam_index < active_beams.size(); ++beam_index) {
+        auto& beam_config = beam(active_beams[beam_index]);
+        if(beam_config.thread_config().affinities().empty()) {
+            beam_config.assign_affinities(assignment[beam_index]);
+        }
+    }
+    PANDA_LOG << "Assigned cores to " << active_beams.size() << " beams over " << topology.number_of_nodes() << " NUMA node(s)";
+}
+
+template<typename NumericalT>
+void MultiBeamConfig<NumericalT>::add_options(OptionsDescriptionEasyInit& add_options)
+{
+    add_options
+    ("numa_affinity", boost::program_options::bool_switch()->default_value(_numa_affinity)->notifier([this](bool val) { _numa_affinity = val; })
+    , "assign each beam without explicit thread affinities a set of cores local to a single NUMA node");
 }
 
 } // namespace search_pipeline
@@ -36,6 +36,7 @@ template<typename NumericalT>
 PipelineHandler<NumericalT>::PipelineHandler(CheetahConfig<NumericalT> const& config, BeamConfigType<NumericalT> const& beam_config)
     : _config(config)
     , _out(beam_config.data_config().data_exporter())
+    , _beam_id(beam_config.id())
 {
 }
 
@@ -51,6 +52,12 @@ void PipelineHandler<NumericalT>::halt()
     throw panda::Abort();
 }
 
+template<typename NumericalT>
+std::string const& PipelineHandler<NumericalT>::beam_id() const
+{
+    return _beam_id;
+}
+
 } // namespace search_pipeline
 } // namespace pipelines
 } // namespace cheetah
@@ -40,17 +40,17 @@ RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::RfiDetectionPipe
     , _bandpass_handler(*this)
     , _rfim(config.rfim_config(), _rfim_handler, _bandpass_handler)
     , _data_sequence(300)
-    , _last_data_sequence_index(_data_sequence.size(), 0)
-    , _next_data_sequence_index(_data_sequence.size(), 0)
+    , _data_sequence_start(_data_sequence.capacity())
+    , _rfim_latency(utils::LatencyMonitor::instance().histogram("rfim", this->beam_id()))
+    , _export_latency(utils::LatencyMonitor::instance().histogram("export", this->beam_id()))
+    , _backpressure_latency(utils::LatencyMonitor::instance().histogram("rfim_backpressure", this->beam_id()))
 {
 }
 
 template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
 RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::~RfiDetectionPipeline()
 {
-    while(_last_data_sequence_index != _next_data_sequence_index) {
-        std::this_thread::yield();
-    }
+    _data_sequence.wait_empty();
 }
 
 template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
@@ -59,36 +59,35 @@ RfimOutputHandler& RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy
     return _rfim_handler._output;
 }
 
+template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
+utils::ReorderBuffer<typename RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::TimeFrequencyType const*> const& RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::sequencing_queue() const
+{
+    return _data_sequence;
+}
+
 template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
 void RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::operator()(TimeFrequencyType& data)
 {
-    // assumes we will only be called from a single thread
-    _data_sequence[_last_data_sequence_index] = &data;
-    ++_last_data_sequence_index;
-    bool hold=false;
-    // check we are not overruning the sequence buffer.
-    // Check needs to happen before we launch job to avoid race cdn
-    if(_last_data_sequence_index == _next_data_sequence_index) {
-        hold = true;
+    // blocks (slowing the pipeline) whilst the sequencing queue is full
+    auto const stalls = _data_sequence.producer_stall_count();
+    auto const push_start = utils::LatencyHistogram::ClockType::now();
+    auto const sequence_number = _data_sequence.push(&data);
+    if(_data_sequence.producer_stall_count() != stalls) {
+        PANDA_LOG_WARN << "sequencing queue full. Pipeline was held until space recovered";
+        _backpressure_latency.record_since(push_start);
+    }
+
+    if(utils::LatencyMonitor::enabled()) {
+        _data_sequence_start[sequence_number % _data_sequence.capacity()] = utils::LatencyHistogram::ClockType::now();
     }
     try {
         _rfim.run(data);
     }
     catch(...)
     {
-        --_last_data_sequence_index;
+        _data_sequence.cancel(sequence_number);
         throw;
     }
-
-    if(hold) {
-        // slow things down until buffer has caught up
-        if(_last_data_sequence_index == _next_data_sequence_index) {
-            PANDA_LOG_WARN << "sequencing queue full. Slowing pipeline until space recovered";
-        }
-        while(_last_data_sequence_index == _next_data_sequence_index) {
-            std::this_thread::yield();
-        }
-    }
 }
 
 template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
@@ -104,25 +103,31 @@ void RfiDetectionPipeline<NumericalT, RfimOutputHandler, RfiPolicy>::RfiOutputHa
 {
     TimeFrequencyType& tf_data = static_cast<TimeFrequencyType&>(panda::is_pointer_wrapper<typename std::remove_reference<ReturnType>::type>::extract(data));
 
-    // resync data stream
-    while(_pipeline._data_sequence[_pipeline._next_data_sequence_index] != &tf_data) {
-        std::this_thread::yield();
+    // resync data stream: wait for all earlier chunks to be passed on
+    auto const sequence_number = _pipeline._data_sequence.acquire(&tf_data);
+
+    auto& start = _pipeline._data_sequence_start[sequence_number % _pipeline._data_sequence.capacity()];
+    if(start != utils::LatencyHistogram::ClockType::time_point()) {
+        _pipeline._rfim_latency.record_since(start);
+        start = utils::LatencyHistogram::ClockType::time_point();
     }
 
     try {
         // process the rfim data
-        _pipeline.out().send(panda::ChannelId("rfim"), tf_data);
+        {
+            utils::ScopedLatency timer(_pipeline._export_latency);
+            _pipeline.out().send(panda::ChannelId("rfim"), tf_data);
+        }
         _output(data);
     }
     catch(...)
     {
-        ++_pipeline._next_data_sequence_index;
+        _pipeline._data_sequence.release(sequence_number);
         throw;
     }
 
-    // now safe to let other threads push their data
-    ++_pipeline._next_data_sequence_index;
-
+    // now safe to let the next chunk through
+    _pipeline._data_sequence.release(sequence_number);
 }
 
 template<typename NumericalT, typename RfimOutputHandler, typename RfiPolicy>
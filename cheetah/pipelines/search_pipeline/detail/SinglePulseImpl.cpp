@@ -35,6 +35,10 @@ SinglePulseImpl<NumericalT>::SinglePulseImpl(CheetahConfig<NumericalT> const& co
     , _ddtr_handler(*this)
     , _spclusterer(config.sps_clustering_config())
     , _spsifter(config.spsift_config())
+    , _aggregation_latency(utils::LatencyMonitor::instance().histogram("aggregation", this->beam_id()))
+    , _spdt_latency(utils::LatencyMonitor::instance().histogram("spdt", this->beam_id()))
+    , _sift_cluster_latency(utils::LatencyMonitor::instance().histogram("sift_cluster", this->beam_id()))
+    , _export_latency(utils::LatencyMonitor::instance().histogram("export", this->beam_id()))
     , _spdt(beam_config, config.spdt_config(), [this](std::shared_ptr<SpType> sp_data)
                                             {
                                                 _spdt_handler(sp_data);
@@ -49,6 +53,14 @@ SinglePulseImpl<NumericalT>::SinglePulseImpl(CheetahConfig<NumericalT> const& co
 template<typename NumericalT>
 SinglePulseImpl<NumericalT>::~SinglePulseImpl()
 {
+    // end of stream: emit the clusters held back for a chunk that will not arrive
+    _thread.exec([this]()
+                 {
+                     auto held_back = _spclusterer.flush<NumericalT>();
+                     if(held_back->empty()) return;
+                     _spsifter.cap(*held_back);
+                     this->out().send(ska::panda::ChannelId("sps_events"), held_back);
+                 });
 }
 
 template<typename NumericalT>
@@ -66,6 +78,7 @@ SinglePulseImpl<NumericalT>::DdtrHandler::DdtrHandler(SinglePulseImpl<NumericalT
 template<typename NumericalT>
 void SinglePulseImpl<NumericalT>::operator()(TimeFrequencyType& data)
 {
+    utils::ScopedLatency timer(_aggregation_latency);
     _ddtr(data);
 }
 
@@ -82,15 +95,37 @@ void SinglePulseImpl<NumericalT>::SpdtHandler::operator()(std::shared_ptr<SpType
 template<typename NumericalT>
 void SinglePulseImpl<NumericalT>::DdtrHandler::operator()(std::shared_ptr<DmTrialType> data)
 {
-    _pipeline._spdt(data);
+    if(utils::LatencyMonitor::enabled()) {
+        // the spdt latency is measured from here to the start of post processing
+        std::lock_guard<std::mutex> lock(_pipeline._spdt_start_mutex);
+        if(_pipeline._spdt_start.size() == 16) _pipeline._spdt_start.pop_front(); // lost candidates are never matched
+        _pipeline._spdt_start.emplace_back(data->start_time(), LatencyClockType::now());
+    }
+    // hand over our reference so the DmTrials slot returns to the ddtr ring as soon as spdt is done with it
+    _pipeline._spdt(std::move(data));
 }
 
 template<typename NumericalT>
 void SinglePulseImpl<NumericalT>::do_post_processing(std::shared_ptr<SpType> const& data)
 {
-    //PANDA_LOG<<"number of candidates "<<data->size();
-    this->_spsifter(*data);
-    std::shared_ptr<SpType> new_data = this->_spclusterer(data);
+    if(utils::LatencyMonitor::enabled()) {
+        std::lock_guard<std::mutex> lock(_spdt_start_mutex);
+        auto it = std::find_if(_spdt_start.begin(), _spdt_start.end(), [&](auto const& entry) { return entry.first == data->start_time(); });
+        if(it != _spdt_start.end()) {
+            _spdt_latency.record_since(it->second);
+            _spdt_start.erase(_spdt_start.begin(), it + 1);
+        }
+    }
+
+    std::shared_ptr<SpType> new_data;
+    {
+        // threshold, cluster, then apply the candidate budget to the cluster representatives
+        utils::ScopedLatency timer(_sift_cluster_latency);
+        this->_spsifter.threshold(*data);
+        new_data = this->_spclusterer(data);
+        this->_spsifter.cap(*new_data);
+    }
+    utils::ScopedLatency timer(_export_latency);
     this->out().send(ska::panda::ChannelId("sps_events"), new_data);
 }
 
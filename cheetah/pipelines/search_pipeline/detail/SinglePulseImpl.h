@@ -29,7 +29,12 @@
 #include "cheetah/modules/spdt/Spdt.h"
 #include "cheetah/modules/spsift/SpSift.h"
 #include "cheetah/modules/sps_clustering/SpsClustering.h"
+#include "cheetah/utils/LatencyMonitor.h"
+#include "cheetah/utils/ModifiedJulianClock.h"
 #include "panda/Thread.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
 
 namespace ska {
 namespace cheetah {
@@ -102,6 +107,15 @@ class SinglePulseImpl : public PipelineHandler<NumericalT>
         modules::spsift::SpSift _spsifter;
         panda::Thread _thread;
 
+        // latency instrumentation
+        typedef utils::LatencyHistogram::ClockType LatencyClockType;
+        utils::LatencyHistogram& _aggregation_latency;
+        utils::LatencyHistogram& _spdt_latency;
+        utils::LatencyHistogram& _sift_cluster_latency;
+        utils::LatencyHistogram& _export_latency;
+        std::mutex _spdt_start_mutex;
+        std::deque<std::pair<utils::ModifiedJulianClock::time_point, LatencyClockType::time_point>> _spdt_start; // keyed on data start time
+
     protected:
         Spdt _spdt;
         Ddtr _ddtr;
@@ -28,6 +28,7 @@
 #include "cheetah/pipelines/search_pipeline/Empty.h"
 #include "cheetah/pipelines/search_pipeline/SinglePulse.h"
 #include "cheetah/pipelines/search_pipeline/RfiDetectionPipeline.h"
+#include "cheetah/utils/LatencyMonitor.h"
 
 #include "panda/Error.h"
 #include "panda/MixInTimer.h"
@@ -47,14 +48,20 @@ T* make_handler(CheetahConfig<NumericalT> const& config, BeamConfigType<Numerica
 }
 
 // wrapper to protect the pipeline from being destroyed before tasks in the pools finish
+// and to record the ingest (time waiting on the stream) and handler latencies
 template<typename NumericalT, typename Base>
 class PipelineWrapper : public Base
 {
+        typedef utils::LatencyHistogram::ClockType ClockType;
+
     public:
         template<typename... Args>
         PipelineWrapper(CheetahConfig<NumericalT> const& config, Args&&... args)
             : Base(config, std::forward<Args>(args)...)
             , _config(config)
+            , _ingest_latency(utils::LatencyMonitor::instance().histogram("ingest", this->beam_id()))
+            , _handler_latency(utils::LatencyMonitor::instance().histogram("handler", this->beam_id()))
+            , _has_returned(false)
         {
         }
 
@@ -63,8 +70,26 @@ class PipelineWrapper : public Base
             _config.pool_manager().wait();
         }
 
+        void operator()(typename PipelineHandler<NumericalT>::TimeFrequencyType& data) override
+        {
+            if(!utils::LatencyMonitor::enabled()) {
+                Base::operator()(data);
+                return;
+            }
+            auto const start = ClockType::now();
+            if(_has_returned) _ingest_latency.record(start - _last_return);
+            Base::operator()(data);
+            _last_return = ClockType::now();
+            _has_returned = true;
+            _handler_latency.record(_last_return - start);
+        }
+
     private:
         CheetahConfig<NumericalT> const& _config;
+        utils::LatencyHistogram& _ingest_latency;
+        utils::LatencyHistogram& _handler_latency;
+        bool _has_returned;
+        ClockType::time_point _last_return;
 };
 
 // wrapper to implement required virtual function of PipelineHandler
@@ -106,7 +131,7 @@ class TimedPipeline : public PipelineHandler<NumericalT>
             auto start=ClockType::now();
             (*_handler)(data);
             auto end=ClockType::now();
-            PANDA_LOG << "timing: " << std::chrono::duration_cast<std::chrono::microseconds>(start - end).count() << "microseconds";
+            PANDA_LOG << "timing: " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << "microseconds";
         }
 
     private:
@@ -0,0 +1,357 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/** @addtogroup apps
+ * @{
+ * @section app_pipeline_benchmark Pipeline Benchmark
+ * @brief cheetah_pipeline_benchmark Benchmark the computational part of a search pipeline
+ * @details
+ *    Feeds synthetic TimeFrequency data, produced by the generators (e.g. gaussian_noise + dispersed_pulse),
+ *    to a computational pipeline (default SinglePulse) for each active beam, in process and without any I/O.
+ *    The pipeline and all its modules (ddtr, spdt, sift, clustering,...) are configured exactly as for
+ *    cheetah_pipeline (i.e. via a configuration file), the generators via the <generators> section.
+ *
+ *    On completion it reports:
+ *    - the sustained real time factor (seconds of data processed per second of wall time, per beam)
+ *    - per stage latency percentiles (see utils::LatencyMonitor)
+ *    - the peak resident set size of the process
+ *    - the utilisation of each cpu core over the run
+ *
+ *    for help on how to use see:
+ *    @verbatim
+       cheetah_pipeline_benchmark --help
+      @endverbatim
+ *
+ * @} */ // end group
+
+#include "cheetah/pipelines/search_pipeline/CheetahConfig.h"
+#include "cheetah/pipelines/search_pipeline/PipelineHandlerFactory.h"
+#include "cheetah/pipelines/search_pipeline/PipelineHandler.h"
+#include "cheetah/pipelines/search_pipeline/BeamConfig.h"
+#include "cheetah/generators/Config.h"
+#include "cheetah/generators/GeneratorFactory.h"
+#include "cheetah/data/TimeFrequency.h"
+#include "cheetah/data/Units.h"
+#include "cheetah/utils/LatencyMonitor.h"
+#include "cheetah/utils/TerminateException.h"
+#include "pss/astrotypes/units/ModifiedJulianClock.h"
+#include "panda/Error.h"
+#include "panda/Log.h"
+
+#include <sys/resource.h>
+#include <cctype>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ska::cheetah;
+
+namespace {
+
+typedef pipelines::search_pipeline::PipelineHandlerFactory::NumericalT NumericalT;
+typedef data::TimeFrequency<Cpu, NumericalT> TimeFrequencyType;
+typedef pipelines::search_pipeline::PipelineHandlerFactory::HandlerType HandlerType;
+typedef std::chrono::steady_clock ClockType;
+
+/**
+ * @brief The cheetah pipeline configuration extended with the synthetic data parameters
+ */
+class PipelineBenchmarkConfig : public pipelines::search_pipeline::CheetahConfig<NumericalT>
+{
+        typedef pipelines::search_pipeline::CheetahConfig<NumericalT> BaseT;
+        typedef boost::units::quantity<data::MegaHertz, double> FrequencyType;
+        typedef boost::units::quantity<boost::units::si::time, double> IntervalType;
+
+    public:
+        PipelineBenchmarkConfig()
+            : BaseT("cheetah_pipeline_benchmark")
+            , _benchmark_options("Benchmark Options")
+            , _generator_selected({"gaussian_noise", "dispersed_pulse"})
+            , _number_of_chunks(64)
+            , _number_of_distinct_chunks(4)
+            , _number_of_channels(4096)
+            , _number_of_time_samples(16384)
+            , _frequency(1670.0 * boost::units::si::mega * data::hz)
+            , _channel_width(-73.2421875 * boost::units::si::kilo * data::hz)
+            , _sample_interval(64e-6 * boost::units::si::seconds)
+        {
+            _benchmark_options.add_options()
+            ("generator,g", boost::program_options::value<std::vector<std::string>>(&_generator_selected)->multitoken()
+                          , "the generators used to model the data (default gaussian_noise dispersed_pulse), configured in the <generators> section")
+            ("chunks", boost::program_options::value<std::size_t>(&_number_of_chunks)->default_value(_number_of_chunks)
+                     , "the number of blocks of data to pass through the pipeline for each beam")
+            ("distinct-chunks", boost::program_options::value<std::size_t>(&_number_of_distinct_chunks)->default_value(_number_of_distinct_chunks)
+                              , "the number of different blocks of data to generate before the run (these are cycled through)")
+            ("channels", boost::program_options::value<std::size_t>(&_number_of_channels)->default_value(_number_of_channels)
+                       , "the number of channels in each block of data")
+            ("samples", boost::program_options::value<std::size_t>(&_number_of_time_samples)->default_value(_number_of_time_samples)
+                      , "the number of time samples in each block of data")
+            ("start_freq", boost::program_options::value<typename FrequencyType::value_type>()->default_value(_frequency.value())
+                           ->notifier([this](typename FrequencyType::value_type const& val)
+                                      {
+                                        _frequency = val * boost::units::si::mega * data::hertz;
+                                      })
+                         , "the frequency of the first channel (MHz)")
+            ("channel_width", boost::program_options::value<typename FrequencyType::value_type>()->default_value(_channel_width.value())
+                           ->notifier([this](typename FrequencyType::value_type const& val)
+                                      {
+                                        _channel_width = val * boost::units::si::mega * data::hertz;
+                                      })
+                            , "the width of each channel (MHz)")
+            ("sample_interval", boost::program_options::value<typename IntervalType::value_type>()->default_value(_sample_interval.value())
+                           ->notifier([this](typename IntervalType::value_type const& val)
+                                      {
+                                        _sample_interval = val * boost::units::si::seconds;
+                                      })
+                            , "the sample interval (s)")
+            ("report", boost::program_options::value<std::string>(&_report_file)
+                     , "also write the summary report as a single JSON object to this file")
+            ;
+            add_generic_options(_benchmark_options);
+            add(_generator_config);
+        }
+
+        generators::Config const& generator_config() const { return _generator_config; }
+        std::vector<std::string> const& data_generator() const { return _generator_selected; }
+        std::size_t number_of_chunks() const { return _number_of_chunks; }
+        std::size_t number_of_distinct_chunks() const { return std::max<std::size_t>(1, _number_of_distinct_chunks); }
+        std::size_t number_of_channels() const { return _number_of_channels; }
+        std::size_t number_of_time_samples() const { return _number_of_time_samples; }
+        FrequencyType start_frequency() const { return _frequency; }
+        FrequencyType channel_width() const { return _channel_width; }
+        IntervalType sample_interval() const { return _sample_interval; }
+        std::string const& report_file() const { return _report_file; }
+
+    private:
+        boost::program_options::options_description _benchmark_options;
+        generators::Config _generator_config;
+        std::vector<std::string> _generator_selected;
+        std::size_t _number_of_chunks;
+        std::size_t _number_of_distinct_chunks;
+        std::size_t _number_of_channels;
+        std::size_t _number_of_time_samples;
+        FrequencyType _frequency;
+        FrequencyType _channel_width;
+        IntervalType _sample_interval;
+        std::string _report_file;
+};
+
+/**
+ * @brief cumulative jiffies for each cpu core, as reported by /proc/stat
+ */
+struct CpuTimes
+{
+    std::vector<unsigned long long> busy;
+    std::vector<unsigned long long> total;
+
+    static CpuTimes now()
+    {
+        CpuTimes times;
+        std::ifstream stat("/proc/stat");
+        std::string line;
+        while(std::getline(stat, line)) {
+            // per core lines only i.e cpu0, cpu1, ...
+            if(line.compare(0, 3, "cpu") != 0 || line.size() < 4 || !std::isdigit(static_cast<unsigned char>(line[3]))) continue;
+            std::istringstream ss(line);
+            std::string name;
+            unsigned long long value, total = 0, idle = 0;
+            ss >> name;
+            for(unsigned field = 0; ss >> value; ++field) {
+                if(field >= 8) break; // guest times are already included in user/nice
+                if(field == 3 || field == 4) idle += value; // idle, iowait
+                total += value;
+            }
+            times.busy.push_back(total - idle);
+            times.total.push_back(total);
+        }
+        return times;
+    }
+};
+
+/**
+ * @brief feed the handler with copies of the template chunks, with contiguous start times
+ */
+void feed_beam(HandlerType& handler, std::vector<std::shared_ptr<TimeFrequencyType>> const& templates, std::size_t number_of_chunks)
+{
+    // keep a few of the most recent chunks alive in case the handler processes them asynchronously
+    std::deque<std::shared_ptr<TimeFrequencyType>> in_flight;
+    auto start_time = pss::astrotypes::units::ModifiedJulianClock::now();
+    for(std::size_t chunk_index = 0; chunk_index < number_of_chunks; ++chunk_index) {
+        auto chunk = std::make_shared<TimeFrequencyType>(*templates[chunk_index % templates.size()]);
+        chunk->start_time(start_time);
+        start_time = chunk->end_time() + chunk->sample_interval();
+        handler(*chunk);
+        in_flight.push_back(std::move(chunk));
+        if(in_flight.size() > templates.size()) in_flight.pop_front();
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+
+    int rv = 1; // program return value
+
+    try {
+        // -- configuration setup --
+        PipelineBenchmarkConfig config;
+        pipelines::search_pipeline::PipelineHandlerFactory pipeline_factory(config);
+        config.set_pipeline_handlers(pipeline_factory.available());
+        generators::GeneratorFactory<TimeFrequencyType> generator_factory(config.generator_config());
+
+        // -- parse the command line --
+        if( (rv=config.parse(argc, argv)) ) return rv;
+        std::string const pipeline_name = config.pipeline_name().empty() ? std::string("SinglePulse") : config.pipeline_name();
+
+        // -- generate the synthetic data --
+        std::vector<std::unique_ptr<generators::DataGenerator<TimeFrequencyType>>> models;
+        for(auto const& generator_name : config.data_generator()) {
+            models.emplace_back(generator_factory.create(generator_name));
+        }
+        std::vector<std::shared_ptr<TimeFrequencyType>> templates;
+        for(std::size_t ii = 0; ii < config.number_of_distinct_chunks(); ++ii) {
+            auto chunk = std::make_shared<TimeFrequencyType>(data::DimensionSize<data::Time>(config.number_of_time_samples())
+                                                            , data::DimensionSize<data::Frequency>(config.number_of_channels()));
+            chunk->set_channel_frequencies_const_width(config.start_frequency(), config.channel_width());
+            chunk->sample_interval(config.sample_interval());
+            chunk->start_time(pss::astrotypes::units::ModifiedJulianClock::now());
+            for(auto& model : models) {
+                model->next(*chunk);
+            }
+            templates.push_back(std::move(chunk));
+        }
+
+        // -- create a handler for each active beam --
+        std::vector<std::unique_ptr<HandlerType>> handlers;
+        for(auto it = config.beams_config().beams(); it != config.beams_config().beams_end(); ++it) {
+            if(!it->active()) continue;
+            handlers.emplace_back(pipeline_factory.create(pipeline_name, *it));
+        }
+        if(handlers.empty()) {
+            throw panda::Error("no active beams have been configured");
+        }
+        std::size_t const number_of_beams = handlers.size();
+
+        // -- run --
+        utils::LatencyMonitor& monitor = utils::LatencyMonitor::instance();
+        if(!config.latency_histogram_file().empty()) {
+            monitor.start_dump(config.latency_histogram_file(), config.latency_histogram_interval());
+        }
+        monitor.enable(true);
+
+        PANDA_LOG << "benchmarking pipeline '" << pipeline_name << "' with " << number_of_beams << " beam(s), "
+                  << config.number_of_chunks() << " chunks of " << config.number_of_time_samples() << " samples x "
+                  << config.number_of_channels() << " channels";
+
+        CpuTimes const cpu_start = CpuTimes::now();
+        auto const wall_start = ClockType::now();
+        {
+            std::vector<std::thread> threads;
+            for(auto& handler : handlers) {
+                threads.emplace_back([&, h = handler.get()]() { feed_beam(*h, templates, config.number_of_chunks()); });
+            }
+            for(auto& thread : threads) thread.join();
+            config.pool_manager().wait();
+            handlers.clear(); // wait for any outstanding asynchronous processing
+        }
+        auto const wall_stop = ClockType::now();
+        CpuTimes const cpu_stop = CpuTimes::now();
+        monitor.stop_dump();
+        monitor.enable(false);
+
+        // -- report --
+        double const wall_seconds = std::chrono::duration<double>(wall_stop - wall_start).count();
+        double const data_seconds = config.number_of_chunks() * config.number_of_time_samples() * config.sample_interval().value();
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        long const peak_rss_kb = usage.ru_maxrss; // kilobytes on linux
+
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(3);
+        report << "{\"pipeline\":\"" << pipeline_name << "\""
+               << ",\"beams\":" << number_of_beams
+               << ",\"chunks\":" << config.number_of_chunks()
+               << ",\"wall_s\":" << wall_seconds
+               << ",\"data_s_per_beam\":" << data_seconds
+               << ",\"real_time_factor\":" << data_seconds / wall_seconds
+               << ",\"peak_rss_kb\":" << peak_rss_kb
+               << ",\"cpu_utilisation\":[";
+        for(std::size_t core = 0; core < cpu_stop.total.size() && core < cpu_start.total.size(); ++core) {
+            unsigned long long const total = cpu_stop.total[core] - cpu_start.total[core];
+            unsigned long long const busy = cpu_stop.busy[core] - cpu_start.busy[core];
+            report << (core ? "," : "") << (total ? static_cast<double>(busy) / total : 0.0);
+        }
+        report << "],\"latency\":";
+        monitor.write_snapshot(report);
+        std::string json = report.str();
+        json.back() = '}'; // replace the snapshot's trailing newline
+
+        std::cout << "pipeline:          " << pipeline_name << "\n"
+                  << "wall time:         " << wall_seconds << " s\n"
+                  << "data per beam:     " << data_seconds << " s\n"
+                  << "real time factor:  " << data_seconds / wall_seconds << "\n"
+                  << "peak RSS:          " << peak_rss_kb / 1024.0 << " MiB\n"
+                  << "cpu utilisation:  ";
+        for(std::size_t core = 0; core < cpu_stop.total.size() && core < cpu_start.total.size(); ++core) {
+            unsigned long long const total = cpu_stop.total[core] - cpu_start.total[core];
+            unsigned long long const busy = cpu_stop.busy[core] - cpu_start.busy[core];
+            std::cout << " " << std::setprecision(0) << std::fixed << (total ? 100.0 * busy / total : 0.0) << "%";
+        }
+        std::cout << "\nstage latencies (us):\n";
+        std::cout << std::setprecision(1);
+        std::cout << "  " << std::left << std::setw(20) << "stage" << std::setw(12) << "beam" << std::right
+                  << std::setw(8) << "count" << std::setw(12) << "p50" << std::setw(12) << "p90"
+                  << std::setw(12) << "p99" << std::setw(12) << "max" << "\n";
+        for(auto const& stage : monitor.stages()) {
+            auto const snapshot = monitor.histogram(stage.first, stage.second).snapshot();
+            if(snapshot.count() == 0) continue;
+            std::cout << "  " << std::left << std::setw(20) << stage.first << std::setw(12) << stage.second << std::right
+                      << std::setw(8) << snapshot.count()
+                      << std::setw(12) << snapshot.value_at_percentile(50.0) / 1000.0
+                      << std::setw(12) << snapshot.value_at_percentile(90.0) / 1000.0
+                      << std::setw(12) << snapshot.value_at_percentile(99.0) / 1000.0
+                      << std::setw(12) << snapshot.max() / 1000.0 << "\n";
+        }
+
+        if(!config.report_file().empty()) {
+            std::ofstream report_file(config.report_file());
+            report_file << json << "\n";
+        }
+        rv = 0;
+    }
+    catch(utils::TerminateException&) {
+        return 0; // terminate with success
+    }
+    catch(std::exception& e) {
+        std::cerr << e.what() << std::endl;
+    }
+
+    return rv;
+}
@@ -41,6 +41,7 @@
 
 #include "cheetah/pipelines/search_pipeline/CheetahConfig.h"
 #include "cheetah/pipelines/search_pipeline/BeamLauncher.h"
+#include "cheetah/utils/LatencyMonitor.h"
 #include "cheetah/utils/TerminateException.h"
 #include "cheetah/io/producers/rcpt/SkaUdpStream.h"
 #include "cheetah/sigproc/SigProcFileStream.h"
@@ -58,7 +59,7 @@ struct SelectUdpBeam : public io::producers::rcpt::SkaUdpStream<Stream>
 
     template<typename NumericalT, typename HandlerFactoryT>
     static inline
-    int exec(pipelines::search_pipeline::CheetahConfig<NumericalT> const& config, HandlerFactoryT& runtime_handler_factory)
+    int exec(pipelines::search_pipeline::CheetahConfig<NumericalT>& config, HandlerFactoryT& runtime_handler_factory)
     {
         int rv;
         pipelines::search_pipeline::BeamLauncher<typename BaseT::UdpStream, NumericalT> beam( config.beams_config()
@@ -86,6 +87,11 @@ int main(int argc, char** argv) {
         // -- parse the command line --
         if( (rv=config.parse(argc, argv)) ) return rv;
 
+        // -- optional per stage latency instrumentation --
+        if(!config.latency_histogram_file().empty()) {
+            utils::LatencyMonitor::instance().start_dump(config.latency_histogram_file(), config.latency_histogram_interval());
+        }
+
         // -- create computation unit to run --
         std::function<pipelines::search_pipeline::PipelineHandlerFactory::HandlerType*(pipelines::search_pipeline::BeamConfigType<NumericalT> const&)> runtime_handler_factory;
         if(config.time_handler_invocation()) {
@@ -110,6 +116,7 @@ int main(int argc, char** argv) {
         else {
             rv = io::producers::rcpt::SkaSelector::select<int,SelectUdpBeam>(stream_name, config, runtime_handler_factory);
         }
+        utils::LatencyMonitor::instance().stop_dump();
     }
     catch(utils::TerminateException&) {
         return 0; // terminate with success
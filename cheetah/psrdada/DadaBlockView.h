@@ -0,0 +1,112 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_PSRDADA_DADABLOCKVIEW_H
+#define SKA_CHEETAH_PSRDADA_DADABLOCKVIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ska {
+namespace cheetah {
+namespace psrdada {
+
+/**
+ * @brief      A read only view directly on to a data block of a DADA ring buffer
+ *
+ * @details    No data is copied out of the shared memory segment. The view is handed
+ *             out by the DadaReadClient as a std::shared_ptr and the block is returned to
+ *             the ring (and so becomes available to the writer again) when the last
+ *             reference to the view is released.
+ *
+ * @code
+ *             std::shared_ptr<DadaBlockView> view = client.read_view();
+ *             std::for_each(view->begin<uint8_t>(), view->end<uint8_t>(), ...);
+ *             view.reset(); // block released back to the ring
+ * @endcode
+ */
+class DadaBlockView
+{
+    public:
+        typedef std::function<void(DadaBlockView const&)> ReleaseHandler;
+
+    public:
+        /**
+         * @param data         pointer to the start of the data in the shared memory block
+         * @param used_bytes   the number of valid bytes in the block
+         * @param block_index  the index of the block in the ring
+         * @param release      called once from the destructor to return the block to the ring
+         */
+        DadaBlockView(char const* data, std::size_t used_bytes, std::uint64_t block_index, ReleaseHandler const& release);
+        DadaBlockView(DadaBlockView const&) = delete;
+        DadaBlockView& operator=(DadaBlockView const&) = delete;
+        ~DadaBlockView();
+
+        /**
+         * @brief      raw pointer to the start of the block data
+         */
+        char const* data() const;
+
+        /**
+         * @brief      the number of valid bytes in the block
+         */
+        std::size_t used_bytes() const;
+
+        /**
+         * @brief      the index of the block in the DADA ring
+         */
+        std::uint64_t block_index() const;
+
+        /**
+         * @brief      the number of complete elements of type T in the block
+         */
+        template<typename T>
+        std::size_t size() const;
+
+        /**
+         * @brief      pointer to the first element of type T in the block
+         */
+        template<typename T>
+        T const* begin() const;
+
+        /**
+         * @brief      pointer to one past the last complete element of type T in the block
+         */
+        template<typename T>
+        T const* end() const;
+
+    private:
+        char const* _data;
+        std::size_t _used_bytes;
+        std::uint64_t _block_index;
+        ReleaseHandler _release;
+};
+
+} // namespace psrdada
+} // namespace cheetah
+} // namespace ska
+
+#include "cheetah/psrdada/detail/DadaBlockView.cpp"
+
+#endif // SKA_CHEETAH_PSRDADA_DADABLOCKVIEW_H
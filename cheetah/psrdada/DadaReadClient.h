@@ -26,6 +26,7 @@
 #define SKA_CHEETAH_PSRDADA_DADAREADCLIENT_H
 
 #include "cheetah/psrdada/DadaClientBase.h"
+#include "cheetah/psrdada/DadaBlockView.h"
 #include "cheetah/psrdada/detail/RawBytes.h"
 #include "cheetah/psrdada/detail/RawBytesReader.h"
 #include "panda/Engine.h"
@@ -100,6 +101,23 @@ class DadaReadClient: public DadaClientBase
         template <typename Iterator, typename DataType=typename std::iterator_traits<Iterator>::value_type>
         Iterator& read(Iterator& begin, Iterator const& end);
 
+        /**
+         * @brief      Acquire the next data block as a view directly on the ring buffer memory
+         *
+         * @details    No data is copied. The block is returned to the ring when the last
+         *             reference to the view is dropped. DADA allows a reader only a single
+         *             open data block, so any previously returned view must be released
+         *             before calling this method again. Any block partially consumed via
+         *             read() is released first.
+         *             The client must outlive all the views it has handed out: its
+         *             destructor asserts that no view is outstanding.
+         *
+         * @returns    the view or nullptr if the end of data has been reached or the
+         *             client has been stopped.
+         * @throws     panda::Error if a previous view is still held
+         */
+        std::shared_ptr<DadaBlockView> read_view();
+
         /**
          * @brief      Move to the next sequence in the ring buffer.
          *
@@ -140,6 +158,7 @@ class DadaReadClient: public DadaClientBase
     private:
         std::unique_ptr<detail::RawBytesReader>& acquire_data_block();
         void release_data_block();
+        void release_view(DadaBlockView const& view);
         void flush();
         void lock();
         void unlock();
@@ -156,6 +175,7 @@ class DadaReadClient: public DadaClientBase
         panda::Engine& _engine;
         mutable std::shared_ptr<bool>  _destructor_flag;
         std::mutex _block_mutex;
+        bool _view_open; // a DadaBlockView currently owns the open data block
 };
 
 } // namespace psrdada
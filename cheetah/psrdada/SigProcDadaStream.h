@@ -42,6 +42,10 @@ namespace psrdada {
  *    Opens a DadaReadClient object to read the DADA header (assumes sigproc header format) and then streams data in open DADA data blocks as Timefrequency chunks.
  *    Also checks whether the data are bad or there are incomplete spectra.
  *    Continues to read in data until there are no more data blocks to read or the stream detects an eod marker.
+ *
+ *    Each chunk is filled with a single copy from the DADA data blocks. The chunks are not views on
+ *    the ring: data::TimeFrequency owns its storage, so the ring memory cannot back a chunk and the
+ *    blocks are released as soon as they have been copied.
  */
 
 class SigProcDadaStream : public ska::panda::Producer<SigProcDadaStream, data::TimeFrequency<Cpu, uint8_t>>
@@ -78,11 +82,22 @@ class SigProcDadaStream : public ska::panda::Producer<SigProcDadaStream, data::T
         void new_chunk_process(std::shared_ptr<bool> stopped);
         bool do_process(std::shared_ptr<bool> stopped, std::shared_ptr<ChunkType> chunk,ChunkType::Iterator it);
 
+        /**
+         * @brief copy data from the DADA data blocks into [begin, end)
+         * @details the data block view is held across calls, so a block that spans two chunks is
+         *          read once. The block is returned to the ring as soon as it has been consumed.
+         * @returns an iterator one past the last element written. This is short of end if the
+         *          end of data has been reached.
+         */
+        ChunkType::Iterator read(ChunkType::Iterator begin, ChunkType::Iterator const& end);
+
     private:
         Config const& _config;
         panda::Engine& _engine;
         sigproc::SigProcHeader _header;
         DadaReadClient _client;
+        std::shared_ptr<DadaBlockView> _view; // must be released before the _client
+        std::size_t _view_offset; // elements of _view already consumed
         utils::ModifiedJulianClock::time_point _start_time;
         bool _error;
 };
@@ -0,0 +1,62 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/psrdada/DadaBlockView.h"
+
+
+namespace ska {
+namespace cheetah {
+namespace psrdada {
+
+
+DadaBlockView::DadaBlockView(char const* data, std::size_t used_bytes, std::uint64_t block_index, ReleaseHandler const& release)
+    : _data(data)
+    , _used_bytes(used_bytes)
+    , _block_index(block_index)
+    , _release(release)
+{
+}
+
+DadaBlockView::~DadaBlockView()
+{
+    if(_release) _release(*this);
+}
+
+char const* DadaBlockView::data() const
+{
+    return _data;
+}
+
+std::size_t DadaBlockView::used_bytes() const
+{
+    return _used_bytes;
+}
+
+std::uint64_t DadaBlockView::block_index() const
+{
+    return _block_index;
+}
+
+} // namespace psrdada
+} // namespace cheetah
+} // namespace ska
@@ -31,6 +31,7 @@
 #include <sys/ipc.h>
 #include <streambuf>
 #include <mutex>
+#include <cassert>
 
 #define IPCBUF_VIEWER  1  /* connected */
 #define IPCBUF_READER  5  /* one process that reads from the buffer */
@@ -57,6 +58,7 @@ DadaReadClient::DadaReadClient(key_t key,panda::Engine& engine, NextSequenceCall
     , _locked(false)
     , _engine(engine)
     , _destructor_flag(std::make_shared<bool>(false))
+    , _view_open(false)
 {
     lock();
     //_engine.post(std::bind(&DadaReadClient::do_next_sequence<NextSequenceCallback>
@@ -72,6 +74,13 @@ void DadaReadClient::start()
 DadaReadClient::~DadaReadClient()
 {
     PANDA_LOG_DEBUG << "Destructing the read client";
+    // an outstanding DadaBlockView still owns the open data block. Views do not keep the
+    // client alive, so releasing one after this point cannot return its block to the ring.
+    assert(!_view_open && "all DadaBlockViews must be released before the DadaReadClient is destroyed");
+    if(_view_open)
+    {
+        PANDA_LOG_ERROR << id() << "destroyed with an outstanding data block view";
+    }
     stop();
     unlock();
     while(_destructor_flag.use_count() != 1 )
@@ -141,11 +150,66 @@ std::unique_ptr<detail::RawBytesReader>& DadaReadClient::acquire_data_block()
 }
 
 
+std::shared_ptr<DadaBlockView> DadaReadClient::read_view()
+{
+    if(_view_open)
+    {
+        throw panda::Error("DadaReadClient: previous data block view has not been released");
+    }
+    release_data_block();
+
+    PANDA_LOG_DEBUG << id() << "Acquiring next data block view";
+    uint64_t block_idx, nbytes = 0;
+    char* tmp;
+    do {
+        if(*_destructor_flag)
+        {
+            return nullptr;
+        }
+        tmp = open_block_read(_hdu->data_block, &nbytes, &block_idx);
+        if (!tmp && eod())
+        {
+            PANDA_LOG << id() << "Reached EOD in data ring";
+            return nullptr;
+        }
+    } while(!tmp);
+
+    std::lock_guard<std::mutex> lock(_block_mutex);
+    _view_open = true;
+    // a weak reference so that an outstanding view cannot stall our destructor
+    std::weak_ptr<bool> destructor_flag(_destructor_flag);
+    return std::make_shared<DadaBlockView>(tmp, nbytes, block_idx
+                                          , [this, destructor_flag](DadaBlockView const& view)
+                                            {
+                                                if(destructor_flag.expired()) return; // client already destroyed
+                                                release_view(view);
+                                            });
+}
+
+void DadaReadClient::release_view(DadaBlockView const& view)
+{
+    PANDA_LOG_DEBUG << id() << "Releasing data block view " << view.block_index();
+    std::lock_guard<std::mutex> lock(_block_mutex);
+    if(!_view_open) return;
+    _view_open = false;
+    if (ipcio_close_block_read (_hdu->data_block, view.used_bytes()) < 0)
+    {
+        // called from a destructor so we cannot throw
+        _log.write(LOG_ERR, "release_view: ipcio_close_block_read failed\n");
+        PANDA_LOG_ERROR << id() << "Could not close ipcio data block " << view.block_index();
+    }
+}
+
 void DadaReadClient::release_data_block()
 {
 
     PANDA_LOG_DEBUG << id() << "Releasing data block";
     std::lock_guard<std::mutex> lock(_block_mutex);
+    if (_view_open)
+    {
+        // the block is owned by an outstanding DadaBlockView and will be released with it
+        return;
+    }
     if (!_current_block)
     {
         if(_hdu->data_block)
@@ -167,6 +231,10 @@ void DadaReadClient::release_data_block()
 void DadaReadClient::flush()
 {
     PANDA_LOG_DEBUG << id() << "Reader flush called";
+    if (_view_open)
+    {
+        throw panda::Error("DadaReadClient: cannot flush with an outstanding data block view");
+    }
     while (!eod() && !*_destructor_flag)
     {
         if(!acquire_data_block())
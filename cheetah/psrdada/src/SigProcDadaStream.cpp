@@ -28,6 +28,7 @@
 #include "cheetah/utils/ModifiedJulianClock.h"
 
 #include "panda/Error.h"
+#include <algorithm>
 #include <type_traits>
 #include <iostream>
 #include <new>
@@ -52,6 +53,7 @@ SigProcDadaStream::SigProcDadaStream(Config const& config)
           {
               handle_new_sequence(in, eptr);
           })
+    , _view_offset(0)
     , _start_time(std::chrono::milliseconds(0))
     , _error(false)
 {
@@ -203,7 +205,7 @@ bool SigProcDadaStream::do_process( std::shared_ptr<bool> stopped
         }
 
         // Checks for a partial read (due to eod) and resizes the chunk accordingly and stops reading data.
-        if(_client.read(it,current_chunk->end()) != current_chunk->end())
+        if((it = read(it, current_chunk->end())) != current_chunk->end())
         {
             PANDA_LOG_DEBUG << "Partial read of stream, resizing and invoking next_sequence";
             std::size_t elements_read = std::distance(begin,it);
@@ -239,6 +241,29 @@ bool SigProcDadaStream::do_process( std::shared_ptr<bool> stopped
 
 }
 
+SigProcDadaStream::ChunkType::Iterator SigProcDadaStream::read(ChunkType::Iterator begin, ChunkType::Iterator const& end)
+{
+    typedef ChunkType::value_type ValueType;
+    while(begin != end)
+    {
+        if(!_view)
+        {
+            _view = _client.read_view();
+            _view_offset = 0;
+            if(!_view) break; // end of data or stopped
+        }
+        std::size_t const n = std::min(static_cast<std::size_t>(std::distance(begin, end)), _view->size<ValueType>() - _view_offset);
+        begin = std::copy_n(_view->begin<ValueType>() + _view_offset, n, begin);
+        _view_offset += n;
+        if(_view_offset == _view->size<ValueType>())
+        {
+            // return the block to the ring
+            _view.reset();
+        }
+    }
+    return begin;
+}
+
 void SigProcDadaStream::stop()
 {
     _client.stop();
@@ -2,7 +2,9 @@
 #include "cheetah/psrdada/DadaWriteClient.h"
 #include "cheetah/psrdada/DadaReadClient.h"
 #include "cheetah/psrdada/test_utils/TestDadaDB.h"
+#include "panda/Error.h"
 
+#include <algorithm>
 #include <sstream>
 
 namespace ska {
@@ -80,6 +82,39 @@ TEST_F(DadaReadWriteClientTest, test_multiblock_readwrite)
     test_db.destroy();
 }
 
+TEST_F(DadaReadWriteClientTest, test_read_view)
+{
+    test_utils::TestDadaDB test_db(4, 4096, 4, 4096);
+    test_db.create();
+    {
+        std::vector<char> input_data(2*4096+222);
+        for (std::size_t ii=0; ii<input_data.size(); ++ii)
+        {
+            input_data[ii] = (char) (ii%127);
+        }
+        {
+            DadaWriteClient writer(test_db.key(), [&](std::ostream& out){
+                out << "header";
+            });
+            auto it = input_data.begin();
+            writer.write(it, input_data.end());
+        }
+
+        DadaReadClient reader(test_db.key(), _engine, [&](std::istream&, std::exception_ptr){});
+        std::size_t offset = 0;
+        while(std::shared_ptr<DadaBlockView> view = reader.read_view())
+        {
+            // only one block may be held at a time
+            ASSERT_THROW(reader.read_view(), panda::Error);
+            ASSERT_LE(offset + view->size<char>(), input_data.size());
+            ASSERT_TRUE(std::equal(view->begin<char>(), view->end<char>(), input_data.begin() + offset));
+            offset += view->size<char>();
+        }
+        ASSERT_EQ(offset, input_data.size());
+    }
+    test_db.destroy();
+}
+
 TEST_F(DadaReadWriteClientTest, test_header_overflow)
 {
     test_utils::TestDadaDB test_db(1, 1, 1, 1);
@@ -0,0 +1,123 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_FIXEDBLOCKALLOCATOR_H
+#define SKA_CHEETAH_UTILS_FIXEDBLOCKALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    The thread safe store of free blocks shared by copies of a FixedBlockAllocator
+ */
+class FixedBlockCache
+{
+    public:
+        FixedBlockCache();
+        FixedBlockCache(FixedBlockCache const&) = delete;
+        ~FixedBlockCache();
+
+        /// a free block of exactly bytes size, or nullptr if none is cached
+        void* pop(std::size_t bytes);
+
+        /// add a block to the cache
+        void push(void* ptr, std::size_t bytes);
+
+        /// the number of free blocks
+        std::size_t size() const;
+
+    private:
+        mutable std::mutex _mutex;
+        std::vector<std::pair<std::size_t, void*>> _blocks;
+};
+
+/**
+ * @brief
+ *    A std compatible allocator that recycles the blocks it hands out
+ *
+ * @details
+ *    Freed blocks are kept in a cache and reused by the next allocation of the same size
+ *    rather than being returned to the heap. It is intended for the small, fixed size
+ *    allocations that are repeated for every chunk of data, such as the control block of a
+ *    std::shared_ptr with a custom deleter, so that the steady state makes no calls to the
+ *    global allocator.
+ *
+ *    Copies (including rebound copies) share the same cache, which is released when the last
+ *    of them is destroyed. It is safe to allocate and deallocate from different threads.
+ *
+ *    Not suitable for allocations of many different sizes.
+ */
+template<typename T>
+class FixedBlockAllocator
+{
+    public:
+        typedef T value_type;
+
+    public:
+        FixedBlockAllocator();
+        FixedBlockAllocator(FixedBlockAllocator const&) = default;
+        template<typename U>
+        FixedBlockAllocator(FixedBlockAllocator<U> const&);
+        ~FixedBlockAllocator();
+
+        /**
+         * @brief return a block of n elements, reusing a cached block of the same size if available
+         */
+        T* allocate(std::size_t n);
+
+        /**
+         * @brief return a block to the cache
+         */
+        void deallocate(T* ptr, std::size_t n);
+
+        /**
+         * @brief the number of free blocks currently cached
+         */
+        std::size_t cached_blocks() const;
+
+        template<typename U>
+        bool operator==(FixedBlockAllocator<U> const&) const;
+        template<typename U>
+        bool operator!=(FixedBlockAllocator<U> const&) const;
+
+    private:
+        template<typename> friend class FixedBlockAllocator;
+
+    private:
+        std::shared_ptr<FixedBlockCache> _cache;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/utils/detail/FixedBlockAllocator.cpp"
+
+#endif // SKA_CHEETAH_UTILS_FIXEDBLOCKALLOCATOR_H
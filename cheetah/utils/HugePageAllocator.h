@@ -0,0 +1,141 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_HUGEPAGEALLOCATOR_H
+#define SKA_CHEETAH_UTILS_HUGEPAGEALLOCATOR_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief The kind of pages to back a large buffer with
+ */
+enum class HugePagePolicy
+{
+    None,        ///< ordinary heap allocation
+    Transparent, ///< 2MB aligned anonymous mapping advised to use transparent huge pages (madvise)
+    HugeTlb2M,   ///< explicit 2MB hugetlbfs pages
+    HugeTlb1G    ///< explicit 1GB hugetlbfs pages
+};
+
+/**
+ * @brief parse a policy name ("none", "transparent", "2MB", "1GB")
+ * @throw panda::Error if the name is not recognised
+ */
+HugePagePolicy huge_page_policy(std::string const& name);
+
+/**
+ * @brief the name of a policy, as accepted by huge_page_policy()
+ */
+std::string to_string(HugePagePolicy policy);
+
+/**
+ * @brief
+ *    Allocation of memory backed by huge pages
+ *
+ * @details
+ *    Reduces TLB misses for large buffers accessed with wide strides.
+ *    If the requested page size is not available (e.g. no hugetlbfs pages reserved) the
+ *    allocation falls back to transparent huge pages and then to ordinary pages. The outcome
+ *    is logged the first time it occurs for each buffer label, giving a report at start up of
+ *    how each class of buffer is backed.
+ *    Allocations smaller than a huge page always use the heap.
+ */
+class HugePages
+{
+    public:
+        /**
+         * @brief allocate bytes of memory
+         * @param label the name of the buffer class, used in the report
+         */
+        static void* allocate(std::size_t bytes, HugePagePolicy policy, char const* label);
+
+        /**
+         * @brief release memory returned by allocate()
+         */
+        static void deallocate(void* ptr, std::size_t bytes);
+
+        /**
+         * @brief the number of bytes currently allocated that are backed by the given kind of page
+         */
+        static std::size_t bytes_allocated(HugePagePolicy backing);
+};
+
+/**
+ * @brief
+ *    A std compatible allocator that backs containers with huge pages
+ *
+ * @details
+ *    The policy and label are carried by the allocator so they may be set per container
+ *    (e.g. from configuration). All instances are interchangeable for deallocation.
+ * @code
+ *    std::vector<float, HugePageAllocator<float>> data(size, 0, HugePageAllocator<float>(HugePagePolicy::HugeTlb2M, "my buffer"));
+ * @endcode
+ */
+template<typename T>
+class HugePageAllocator
+{
+    public:
+        typedef T value_type;
+
+    public:
+        HugePageAllocator(HugePagePolicy policy = HugePagePolicy::None, char const* label = "");
+        template<typename U>
+        HugePageAllocator(HugePageAllocator<U> const&);
+
+        T* allocate(std::size_t n);
+        void deallocate(T* ptr, std::size_t n);
+
+        /// the requested policy
+        HugePagePolicy policy() const;
+
+        /// the label used for reporting
+        char const* label() const;
+
+        template<typename U>
+        bool operator==(HugePageAllocator<U> const&) const;
+        template<typename U>
+        bool operator!=(HugePageAllocator<U> const&) const;
+
+    private:
+        HugePagePolicy _policy;
+        char const* _label;
+};
+
+/**
+ * @brief a std::vector using the HugePageAllocator
+ */
+template<typename T>
+using HugePageVector = std::vector<T, HugePageAllocator<T>>;
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/utils/detail/HugePageAllocator.cpp"
+
+#endif // SKA_CHEETAH_UTILS_HUGEPAGEALLOCATOR_H
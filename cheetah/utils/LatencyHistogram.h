@@ -0,0 +1,161 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_LATENCYHISTOGRAM_H
+#define SKA_CHEETAH_UTILS_LATENCYHISTOGRAM_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    A lock free histogram of latencies with a bounded relative error
+ *
+ * @details
+ *    Values (in nanoseconds) are stored in log-linear buckets (HDR style): each power of two
+ *    is divided into 2^sub_bucket_bits linear sub buckets, so any recorded value can be
+ *    recovered to within 1/2^sub_bucket_bits of its true value over the full 64 bit range.
+ *
+ *    Counters are spread over a fixed number of cache line aligned shards. Each recording thread
+ *    is assigned a shard on first use and only ever updates that shard with relaxed atomics, so
+ *    record() never blocks and concurrent writers rarely share a cache line.
+ *    snapshot() sums the shards and may be called at any time from any thread.
+ */
+class LatencyHistogram
+{
+    public:
+        typedef std::chrono::steady_clock ClockType;
+        typedef std::chrono::nanoseconds DurationType;
+
+        static constexpr unsigned sub_bucket_bits = 4;
+        static constexpr std::size_t sub_bucket_count = std::size_t(1) << sub_bucket_bits;
+        static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+        static constexpr std::size_t shard_count = 16;
+
+        /**
+         * @brief an immutable copy of the histogram at some point in time
+         */
+        class Snapshot
+        {
+            public:
+                Snapshot();
+
+                /// the number of recorded values
+                std::uint64_t count() const;
+
+                /// the sum of all recorded values (ns)
+                std::uint64_t sum() const;
+
+                /// the smallest recorded value (ns), 0 if empty
+                std::uint64_t min() const;
+
+                /// the largest recorded value (ns), 0 if empty
+                std::uint64_t max() const;
+
+                /// the mean recorded value (ns), 0 if empty
+                double mean() const;
+
+                /**
+                 * @brief the value (ns) below which the given percentage (0-100) of the recorded values fall
+                 * @details reported as the upper edge of the bucket containing that rank, clamped to max()
+                 */
+                std::uint64_t value_at_percentile(double percentile) const;
+
+                /// the number of values recorded in each bucket
+                std::vector<std::uint64_t> const& buckets() const;
+
+            private:
+                friend class LatencyHistogram;
+                std::uint64_t _count;
+                std::uint64_t _sum;
+                std::uint64_t _min;
+                std::uint64_t _max;
+                std::vector<std::uint64_t> _buckets;
+        };
+
+    public:
+        LatencyHistogram();
+        LatencyHistogram(LatencyHistogram const&) = delete;
+        ~LatencyHistogram();
+
+        /**
+         * @brief add a single value to the histogram
+         */
+        void record(DurationType duration);
+        void record(std::uint64_t nanoseconds);
+
+        /**
+         * @brief add the time elapsed since start
+         */
+        void record_since(ClockType::time_point const& start);
+
+        /**
+         * @brief return a consistent-enough copy of the current state
+         * @details values recorded concurrently with this call may or may not be included
+         */
+        Snapshot snapshot() const;
+
+        /**
+         * @brief clear all recorded values
+         */
+        void reset();
+
+        /// the bucket a value (ns) will be recorded in
+        static std::size_t bucket_index(std::uint64_t value);
+
+        /// the smallest value (ns) that falls in the bucket
+        static std::uint64_t bucket_lower_bound(std::size_t index);
+
+        /// the largest value (ns) that falls in the bucket
+        static std::uint64_t bucket_upper_bound(std::size_t index);
+
+    private:
+        struct alignas(64) Shard
+        {
+            Shard();
+            std::atomic<std::uint64_t> count;
+            std::atomic<std::uint64_t> sum;
+            std::atomic<std::uint64_t> min;
+            std::atomic<std::uint64_t> max;
+            std::array<std::atomic<std::uint64_t>, bucket_count> buckets;
+        };
+
+        static std::size_t thread_shard();
+
+    private:
+        std::unique_ptr<Shard[]> _shards;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_UTILS_LATENCYHISTOGRAM_H
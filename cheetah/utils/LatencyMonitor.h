@@ -0,0 +1,153 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_LATENCYMONITOR_H
+#define SKA_CHEETAH_UTILS_LATENCYMONITOR_H
+
+#include "cheetah/utils/LatencyHistogram.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    Process wide registry of per stage, per beam LatencyHistograms
+ *
+ * @details
+ *    Instrumentation is disabled by default, in which case ScopedLatency does not even read the clock.
+ *    Once enabled, each instrumented stage records into the histogram identified by (stage, beam id),
+ *    which is created on first use and lives as long as the process.
+ *
+ *    start_dump() enables recording and launches a background thread that appends a snapshot of
+ *    every histogram to a file at a fixed interval, one JSON object per line, e.g.
+ *    @code
+ *    {"time":1700000000.000,"histograms":[{"stage":"ddtr","beam":"1","count":12,"mean_us":..,"p50_us":..,...}]}
+ *    @endcode
+ *    Values are cumulative since the histogram was created.
+ */
+class LatencyMonitor
+{
+    public:
+        /// the singleton instance
+        static LatencyMonitor& instance();
+
+        /// true if latencies should be recorded
+        static bool enabled();
+
+        /**
+         * @brief switch the recording of latencies on or off
+         */
+        void enable(bool enable=true);
+
+        /**
+         * @brief return the histogram for the specified stage & beam, creating it if required
+         * @details The returned reference remains valid for the lifetime of the process
+         */
+        LatencyHistogram& histogram(std::string const& stage, std::string const& beam_id = std::string());
+
+        /**
+         * @brief the (stage, beam id) of every histogram created so far
+         */
+        std::vector<std::pair<std::string, std::string>> stages() const;
+
+        /**
+         * @brief write a single line JSON snapshot of all the histograms to the stream
+         */
+        void write_snapshot(std::ostream& os) const;
+
+        /**
+         * @brief enable recording and periodically append snapshots to the named file
+         * @details a final snapshot is written when stop_dump() is called
+         */
+        void start_dump(std::string const& filename, std::chrono::milliseconds interval);
+
+        /**
+         * @brief stop any periodic dump started with start_dump(), writing a final snapshot
+         */
+        void stop_dump();
+
+        ~LatencyMonitor();
+
+    private:
+        LatencyMonitor();
+        LatencyMonitor(LatencyMonitor const&) = delete;
+
+        void dump_loop(std::chrono::milliseconds interval);
+
+    private:
+        typedef std::pair<std::string, std::string> KeyType;
+
+        std::atomic<bool> _enabled;
+        mutable std::mutex _mutex;
+        std::map<KeyType, std::unique_ptr<LatencyHistogram>> _histograms;
+
+        std::mutex _dump_mutex;
+        std::condition_variable _dump_cv;
+        bool _dump_stop;
+        std::ofstream _dump_file;
+        std::thread _dump_thread;
+};
+
+/**
+ * @brief
+ *    RAII helper that records the lifetime of the object in a LatencyHistogram
+ *
+ * @details Does nothing if the LatencyMonitor was not enabled at construction
+ * @code
+ *    {
+ *        utils::ScopedLatency timer("spdt", beam_id);
+ *        ... code to be timed
+ *    }
+ * @endcode
+ */
+class ScopedLatency
+{
+    public:
+        ScopedLatency(std::string const& stage, std::string const& beam_id = std::string());
+        ScopedLatency(LatencyHistogram& histogram);
+        ScopedLatency(ScopedLatency const&) = delete;
+        ~ScopedLatency();
+
+    private:
+        LatencyHistogram* _histogram;
+        LatencyHistogram::ClockType::time_point _start;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_UTILS_LATENCYMONITOR_H
@@ -51,10 +51,13 @@ class MultiThread
         MultiThread(MultiThread&&) = delete;
 
         /**
-         * @brief construct the thread and bind to the core specified by 'affinity'. If affinity == -1 the thread is not bound to any particular core
+         * @brief terminates and joins the job threads. No job may be running.
          */
         ~MultiThread();
 
+        /**
+         * @brief construct the thread and bind to the core specified by 'affinity'. If affinity == -1 the thread is not bound to any particular core
+         */
         template<typename Function, typename... Args>
         void add_job(unsigned const& affinity, Function&& fn, Args... args);
 
@@ -69,7 +72,11 @@ class MultiThread
         unsigned number_of_jobs() const;
 
     protected:
-        void wait(unsigned id);
+        /**
+         * @brief wait for job id to be made ready
+         * @return false if the threads are terminated whilst waiting
+         */
+        bool wait(unsigned id);
         void reset(unsigned id);
         bool status(unsigned id);
 
@@ -0,0 +1,124 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_NUMATOPOLOGY_H
+#define SKA_CHEETAH_UTILS_NUMATOPOLOGY_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    The NUMA layout of the host (which cpus belong to which memory node)
+ *
+ * @details
+ *    The topology is read from sysfs. If it is not available (e.g. non linux hosts) a single
+ *    node containing all the cpus is assumed.
+ *    Nodes are referred to by index (0..number_of_nodes()-1); node_id() gives the corresponding
+ *    operating system node number, which need not be contiguous.
+ *
+ *    Also provides the thread pinning and memory policy helpers needed to keep a thread and the
+ *    memory it first touches on the same node.
+ */
+class NumaTopology
+{
+    public:
+        /**
+         * @param sysfs_node_dir the directory containing the nodeN/cpulist files
+         */
+        explicit NumaTopology(std::string const& sysfs_node_dir = "/sys/devices/system/node");
+        ~NumaTopology();
+
+        /**
+         * @brief the topology of this host
+         */
+        static NumaTopology const& system();
+
+        /// the number of memory nodes
+        std::size_t number_of_nodes() const;
+
+        /// the operating system id of the node with the given index
+        unsigned node_id(std::size_t node) const;
+
+        /// the cpus belonging to the node with the given index
+        std::vector<unsigned> const& cpus(std::size_t node) const;
+
+        /// the index of the node a cpu belongs to, or -1 if unknown
+        int node_of_cpu(unsigned cpu) const;
+
+        /// the index of the node holding most of the given cpus, or -1 if none are known
+        int node_of_cpus(std::vector<unsigned> const& cpus) const;
+
+        /// true if the cpus given are spread over more than one node
+        bool spans_nodes(std::vector<unsigned> const& cpus) const;
+
+        /**
+         * @brief partition the cpus of the host between a number of beams
+         * @details beams are distributed round robin over the nodes and each node's cpus are
+         *          split into contiguous, equally sized sets between the beams placed on it.
+         *          No set crosses a node boundary.
+         */
+        std::vector<std::vector<unsigned>> assign_cores(std::size_t number_of_beams) const;
+
+        /**
+         * @brief parse a linux cpu list string e.g. "0-3,8,10-11"
+         */
+        static std::vector<unsigned> parse_cpu_list(std::string const& cpu_list);
+
+        /**
+         * @brief restrict the calling thread to the given cpus
+         * @return false if not supported on this platform
+         */
+        static bool bind_thread(std::vector<unsigned> const& cpus);
+
+        /**
+         * @brief make the calling thread allocate new pages on the given (operating system) node where possible
+         * @return false if not supported on this platform
+         */
+        static bool prefer_node(unsigned node_id);
+
+        /**
+         * @brief run fn to completion on a thread bound to cpus, preferring memory local to them
+         * @details use to construct objects so that their buffers are first touched on the node
+         *          they will be used from. fn is called directly if cpus is empty.
+         *          Any exception thrown by fn is rethrown in the calling thread.
+         */
+        template<typename FnT>
+        void run_local(std::vector<unsigned> const& cpus, FnT&& fn) const;
+
+    private:
+        std::vector<unsigned> _node_ids;
+        std::vector<std::vector<unsigned>> _node_cpus;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/utils/detail/NumaTopology.cpp"
+
+#endif // SKA_CHEETAH_UTILS_NUMATOPOLOGY_H
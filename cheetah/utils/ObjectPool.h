@@ -0,0 +1,123 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_OBJECTPOOL_H
+#define SKA_CHEETAH_UTILS_OBJECTPOOL_H
+
+#include "cheetah/utils/FixedBlockAllocator.h"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    A thread safe pool of reusable objects handed out as std::shared_ptr
+ *
+ * @details
+ *    acquire() returns a previously released object if one is available and only constructs
+ *    a new one when all are in use. Objects are returned to the pool automatically when the
+ *    last shared_ptr to them is released, and the shared_ptr control blocks are themselves
+ *    recycled, so once the pool has grown to the number of objects in flight acquire() makes
+ *    no heap allocations.
+ *
+ *    A recycled object is returned in the state it was released in: callers should reset it
+ *    (e.g. clear() a container, which keeps its capacity) before use.
+ *
+ *    Copies of an ObjectPool share the same objects. Objects in flight keep the pool storage
+ *    alive, so the ObjectPool itself may be destroyed before them.
+ *
+ * @tparam T the type of object to pool
+ */
+template<typename T>
+class ObjectPool
+{
+    public:
+        typedef T ValueType;
+        typedef std::shared_ptr<T> PtrType;
+
+    public:
+        ObjectPool();
+        ~ObjectPool();
+
+        /**
+         * @brief take ownership of an object, constructing a new one from args if none are free
+         */
+        template<typename... Args>
+        PtrType acquire(Args&&... args);
+
+        /**
+         * @brief ensure at least n objects exist, constructing any new ones from args
+         */
+        template<typename... Args>
+        void reserve(std::size_t n, Args const&... args);
+
+        /**
+         * @brief the number of objects owned by the pool
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief the number of objects not currently in use
+         */
+        std::size_t available() const;
+
+        /**
+         * @brief the number of acquire() calls that had to construct a new object
+         */
+        std::size_t misses() const;
+
+    private:
+        struct Storage
+        {
+            mutable std::mutex mutex;
+            std::vector<std::unique_ptr<T>> objects;
+            std::vector<T*> free_list;
+            std::size_t misses = 0;
+        };
+
+        class Releaser
+        {
+            public:
+                Releaser(std::shared_ptr<Storage> const& storage);
+                void operator()(T*) const;
+
+            private:
+                std::shared_ptr<Storage> _storage;
+        };
+
+    private:
+        std::shared_ptr<Storage> _storage;
+        FixedBlockAllocator<T> _control_block_allocator;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/utils/detail/ObjectPool.cpp"
+
+#endif // SKA_CHEETAH_UTILS_OBJECTPOOL_H
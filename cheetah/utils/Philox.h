@@ -0,0 +1,76 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_PHILOX_H
+#define SKA_CHEETAH_UTILS_PHILOX_H
+
+#include <array>
+#include <cstdint>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    The Philox4x32-10 counter based random number generator (Salmon et al., SC11)
+ *
+ * @details
+ *    Each (counter, key) pair maps to four independent 32 bit random numbers, with no state
+ *    carried between calls. Any element of a random sequence can therefore be generated
+ *    directly from its index, so a sequence can be split over threads (or recomputed)
+ *    without changing its values.
+ *    The key plays the role of the seed.
+ */
+class Philox4x32
+{
+    public:
+        typedef std::array<std::uint32_t, 4> CounterType;
+        typedef std::array<std::uint32_t, 2> KeyType;
+
+    public:
+        /**
+         * @brief generate the four random numbers associated with the counter and key
+         */
+        static CounterType generate(CounterType counter, KeyType key);
+
+        /**
+         * @brief split a 64 bit seed into a key
+         */
+        static KeyType key(std::uint64_t seed);
+
+        /**
+         * @brief convert a random 32 bit integer into a float uniformly distributed on the open interval (0, 1)
+         */
+        static float to_open_unit_interval(std::uint32_t value);
+
+    private:
+        static void round(CounterType& counter, KeyType const& key);
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "detail/Philox.cpp"
+
+#endif // SKA_CHEETAH_UTILS_PHILOX_H
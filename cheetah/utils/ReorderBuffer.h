@@ -0,0 +1,145 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_REORDERBUFFER_H
+#define SKA_CHEETAH_UTILS_REORDERBUFFER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    A bounded buffer that restores the submission order of asynchronously processed items
+ *
+ * @details
+ *    The producer(s) push() a key for each item before it is handed off for asynchronous
+ *    processing and receive a sequence number. Completion handlers, which may run in any
+ *    order on any thread, call acquire() with their key. This blocks until every item
+ *    submitted earlier has been release()d, so downstream consumers see items in
+ *    submission order.
+ *
+ *    At most capacity items may be outstanding. push() blocks while the buffer is full, which
+ *    provides backpressure to the producer.
+ *
+ *    All waits use a condition variable rather than spinning. The time spent blocked on either
+ *    side and the queue depth are available for monitoring.
+ *
+ * @tparam KeyT an equality comparable identifier of the item (e.g. a pointer to it)
+ */
+template<typename KeyT>
+class ReorderBuffer
+{
+    public:
+        typedef KeyT KeyType;
+        typedef std::uint64_t SequenceNumber;
+        typedef std::chrono::steady_clock ClockType;
+        typedef std::chrono::nanoseconds DurationType;
+
+    public:
+        explicit ReorderBuffer(std::size_t capacity);
+        ReorderBuffer(ReorderBuffer const&) = delete;
+        ~ReorderBuffer();
+
+        /**
+         * @brief register a new item, blocking while the buffer is full
+         * @return the sequence number assigned to the item
+         */
+        SequenceNumber push(KeyType const& key);
+
+        /**
+         * @brief withdraw an item that was pushed but will never be acquired (e.g. its launch failed)
+         */
+        void cancel(SequenceNumber sequence_number);
+
+        /**
+         * @brief block until the item matching key is the oldest outstanding item
+         * @return the sequence number of the item
+         * @throw panda::Error if no outstanding item matches key
+         */
+        SequenceNumber acquire(KeyType const& key);
+
+        /**
+         * @brief mark the oldest item (as returned by acquire()) as done, allowing the next in sequence to proceed
+         */
+        void release(SequenceNumber sequence_number);
+
+        /**
+         * @brief block until all outstanding items have been released
+         */
+        void wait_empty();
+
+        /// the maximum number of outstanding items
+        std::size_t capacity() const;
+
+        /// the current number of outstanding items
+        std::size_t depth() const;
+
+        /// the largest depth seen since construction
+        std::size_t max_depth() const;
+
+        /// total time push() has spent blocked waiting for space
+        DurationType producer_stall_time() const;
+
+        /// the number of push() calls that had to wait for space
+        std::uint64_t producer_stall_count() const;
+
+        /// total time acquire() has spent blocked waiting for earlier items to complete
+        DurationType consumer_stall_time() const;
+
+    private:
+        struct Entry
+        {
+            SequenceNumber sequence_number;
+            KeyType key;
+            bool cancelled;
+        };
+
+        /// remove cancelled entries at the head. Must hold _mutex
+        void drop_cancelled();
+
+    private:
+        std::size_t const _capacity;
+        std::deque<Entry> _entries;
+        SequenceNumber _next_sequence_number;
+        std::size_t _max_depth;
+        DurationType _producer_stall_time;
+        std::uint64_t _producer_stall_count;
+        DurationType _consumer_stall_time;
+        mutable std::mutex _mutex;
+        std::condition_variable _space_available;
+        std::condition_variable _head_changed;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+#include "cheetah/utils/detail/ReorderBuffer.cpp"
+
+#endif // SKA_CHEETAH_UTILS_REORDERBUFFER_H
@@ -0,0 +1,126 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_WORKERPOOL_H
+#define SKA_CHEETAH_UTILS_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+/**
+ * @brief
+ *    A fixed set of worker threads for splitting a blocking computation into independent tasks
+ *
+ * @details
+ *    The threads are started once and then reused for every call to run(), so a computation
+ *    that is repeated per data chunk does not pay for thread creation each time.
+ *    run() hands out task indices to the workers and to the calling thread, and returns once
+ *    every task has completed.
+ *
+ *    An exception thrown by a task is captured and rethrown by run() on the calling thread
+ *    after all the other tasks have finished. If several tasks throw, the first is rethrown.
+ *
+ *    The workers can be bound to a set of cpus (e.g. a beam's cores), in which case they also
+ *    prefer memory on the NUMA node of those cpus. Otherwise they inherit the cpu affinity and
+ *    memory policy of the thread that constructs the pool, so a pool created on a beam thread or
+ *    under NumaTopology::run_local stays on that beam's node.
+ *
+ * @code
+ *    WorkerPool pool(4); // the calling thread + 3 workers
+ *    pool.run(number_of_blocks, [&](std::size_t block) { process(block); });
+ * @endcode
+ */
+class WorkerPool
+{
+    public:
+        typedef std::function<void(std::size_t)> TaskType;
+
+    public:
+        /**
+         * @param number_of_threads the number of threads that run() uses, the calling thread included
+         *        (i.e. number_of_threads - 1 workers are started). Values < 1 are treated as 1.
+         */
+        explicit WorkerPool(unsigned number_of_threads = 1);
+
+        /**
+         * @param number_of_threads as above
+         * @param cpus the cpus to bind the workers to. If empty the workers are not rebound.
+         */
+        WorkerPool(unsigned number_of_threads, std::vector<unsigned> const& cpus);
+        WorkerPool(WorkerPool const&) = delete;
+        WorkerPool& operator=(WorkerPool const&) = delete;
+        ~WorkerPool();
+
+        /**
+         * @brief the number of threads run() uses, the calling thread included
+         */
+        unsigned number_of_threads() const;
+
+        /**
+         * @brief the cpus the workers are bound to (empty if they inherited their affinity)
+         */
+        std::vector<unsigned> const& cpus() const;
+
+        /**
+         * @brief call task(i) for each i in [0, number_of_tasks) and wait for them all to complete
+         * @details the order and the thread each task is run on are unspecified.
+         *          Concurrent calls are serialised.
+         * @throw any exception thrown by a task
+         */
+        void run(std::size_t number_of_tasks, TaskType const& task);
+
+    private:
+        void worker();
+        void do_tasks();
+
+    private:
+        std::vector<unsigned> _cpus;
+        std::vector<std::thread> _threads;
+        std::mutex _run_mutex;
+        std::mutex _mutex;
+        std::condition_variable _start;
+        std::condition_variable _done;
+        TaskType const* _task;
+        std::size_t _number_of_tasks;
+        std::atomic<std::size_t> _next_task;
+        std::size_t _active;
+        std::uint64_t _generation;
+        bool _stop;
+        std::exception_ptr _exception;
+};
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+
+#endif // SKA_CHEETAH_UTILS_WORKERPOOL_H
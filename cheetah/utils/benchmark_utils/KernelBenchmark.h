@@ -0,0 +1,71 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SKA_CHEETAH_UTILS_BENCHMARK_UTILS_KERNELBENCHMARK_H
+#define SKA_CHEETAH_UTILS_BENCHMARK_UTILS_KERNELBENCHMARK_H
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace benchmark_utils {
+
+/**
+ * @brief the sustained memory (copy) bandwidth of this machine in bytes/s
+ * @details measured once per process with a STREAM-like copy of buffers much larger
+ *          than the last level cache (best of several repetitions). Counting both the
+ *          bytes read and the bytes written, as the kernel counters below do.
+ */
+double measured_memory_bandwidth();
+
+/**
+ * @brief set the standard kernel counters on a benchmark::State
+ * @param bytes_per_iteration the bytes read + written by one call of the kernel
+ * @param ops_per_iteration the number of arithmetic (or element) operations of one call
+ * @details adds the counters
+ *          - "bytes_per_second" (reported by google-benchmark as GB/s)
+ *          - "bandwidth_fraction" : the fraction of the measured_memory_bandwidth() achieved
+ *          - "ops_per_cycle" : ops_per_iteration per CPU cycle (using the nominal clock rate)
+ */
+void set_kernel_counters(::benchmark::State& state, std::size_t bytes_per_iteration, std::size_t ops_per_iteration);
+
+/**
+ * @brief run all registered benchmarks, adding the machine characteristics to the report context
+ * @details use in place of BENCHMARK_MAIN(). The results can be exported as JSON with
+ *          the --benchmark_out=<file> --benchmark_out_format=json options.
+ */
+int kernel_benchmark_main(int argc, char** argv);
+
+} // namespace benchmark_utils
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
+
+#define CHEETAH_KERNEL_BENCHMARK_MAIN() \
+    int main(int argc, char** argv) { return ska::cheetah::utils::benchmark_utils::kernel_benchmark_main(argc, argv); }
+
+#include "cheetah/utils/benchmark_utils/detail/KernelBenchmark.cpp"
+
+#endif // SKA_CHEETAH_UTILS_BENCHMARK_UTILS_KERNELBENCHMARK_H
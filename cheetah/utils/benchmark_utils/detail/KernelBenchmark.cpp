@@ -0,0 +1,83 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace benchmark_utils {
+
+inline double measured_memory_bandwidth()
+{
+    static double const bandwidth = []()
+    {
+        constexpr std::size_t buffer_size = 256 * 1024 * 1024;
+        constexpr unsigned repetitions = 5;
+        std::vector<char> src(buffer_size, 1);
+        std::vector<char> dst(buffer_size, 0); // touch all pages before timing
+        double best = 0.0;
+        for(unsigned i=0; i < repetitions; ++i) {
+            auto const start = std::chrono::steady_clock::now();
+            std::memcpy(dst.data(), src.data(), buffer_size);
+            ::benchmark::DoNotOptimize(dst.data());
+            ::benchmark::ClobberMemory();
+            std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+            best = std::max(best, 2.0 * buffer_size / elapsed.count());
+        }
+        return best;
+    }();
+    return bandwidth;
+}
+
+inline void set_kernel_counters(::benchmark::State& state, std::size_t bytes_per_iteration, std::size_t ops_per_iteration)
+{
+    typedef ::benchmark::Counter Counter;
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes_per_iteration));
+    state.counters["bandwidth_fraction"] = Counter(static_cast<double>(bytes_per_iteration) / measured_memory_bandwidth()
+                                                  , Counter::kIsIterationInvariantRate);
+    double const cycles_per_second = ::benchmark::CPUInfo::Get().cycles_per_second;
+    if(cycles_per_second > 0.0) {
+        state.counters["ops_per_cycle"] = Counter(static_cast<double>(ops_per_iteration) / cycles_per_second
+                                                 , Counter::kIsIterationInvariantRate);
+    }
+}
+
+inline int kernel_benchmark_main(int argc, char** argv)
+{
+    ::benchmark::Initialize(&argc, argv);
+    if(::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    ::benchmark::AddCustomContext("memory_bandwidth_GBps", std::to_string(measured_memory_bandwidth() / 1e9));
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
+
+} // namespace benchmark_utils
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,87 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/FixedBlockAllocator.h"
+#include <algorithm>
+#include <new>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+template<typename T>
+FixedBlockAllocator<T>::FixedBlockAllocator()
+    : _cache(std::make_shared<FixedBlockCache>())
+{
+}
+
+template<typename T>
+template<typename U>
+FixedBlockAllocator<T>::FixedBlockAllocator(FixedBlockAllocator<U> const& other)
+    : _cache(other._cache)
+{
+}
+
+template<typename T>
+FixedBlockAllocator<T>::~FixedBlockAllocator()
+{
+}
+
+template<typename T>
+T* FixedBlockAllocator<T>::allocate(std::size_t n)
+{
+    std::size_t const bytes = n * sizeof(T);
+    void* ptr = _cache->pop(bytes);
+    if(ptr == nullptr) ptr = ::operator new(bytes);
+    return static_cast<T*>(ptr);
+}
+
+template<typename T>
+void FixedBlockAllocator<T>::deallocate(T* ptr, std::size_t n)
+{
+    _cache->push(static_cast<void*>(ptr), n * sizeof(T));
+}
+
+template<typename T>
+std::size_t FixedBlockAllocator<T>::cached_blocks() const
+{
+    return _cache->size();
+}
+
+template<typename T>
+template<typename U>
+bool FixedBlockAllocator<T>::operator==(FixedBlockAllocator<U> const& other) const
+{
+    return _cache == other._cache;
+}
+
+template<typename T>
+template<typename U>
+bool FixedBlockAllocator<T>::operator!=(FixedBlockAllocator<U> const& other) const
+{
+    return !(*this == other);
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,85 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/HugePageAllocator.h"
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+template<typename T>
+HugePageAllocator<T>::HugePageAllocator(HugePagePolicy policy, char const* label)
+    : _policy(policy)
+    , _label(label)
+{
+}
+
+template<typename T>
+template<typename U>
+HugePageAllocator<T>::HugePageAllocator(HugePageAllocator<U> const& other)
+    : _policy(other.policy())
+    , _label(other.label())
+{
+}
+
+template<typename T>
+T* HugePageAllocator<T>::allocate(std::size_t n)
+{
+    return static_cast<T*>(HugePages::allocate(n * sizeof(T), _policy, _label));
+}
+
+template<typename T>
+void HugePageAllocator<T>::deallocate(T* ptr, std::size_t n)
+{
+    HugePages::deallocate(static_cast<void*>(ptr), n * sizeof(T));
+}
+
+template<typename T>
+HugePagePolicy HugePageAllocator<T>::policy() const
+{
+    return _policy;
+}
+
+template<typename T>
+char const* HugePageAllocator<T>::label() const
+{
+    return _label;
+}
+
+template<typename T>
+template<typename U>
+bool HugePageAllocator<T>::operator==(HugePageAllocator<U> const&) const
+{
+    return true;
+}
+
+template<typename T>
+template<typename U>
+bool HugePageAllocator<T>::operator!=(HugePageAllocator<U> const& other) const
+{
+    return !(*this == other);
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
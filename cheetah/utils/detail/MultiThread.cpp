@@ -9,7 +9,7 @@ void MultiThread::add_job(unsigned const& affinity, Function&& fn, Args... args)
                 set_core_affinity(affinity);
                 while(status(njobs))
                 {
-                    wait(njobs);
+                    if(!wait(njobs)) break;
                     fn(args...);
                     reset(njobs);
                 }
@@ -0,0 +1,114 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/ObjectPool.h"
+#include <utility>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+template<typename T>
+ObjectPool<T>::Releaser::Releaser(std::shared_ptr<Storage> const& storage)
+    : _storage(storage)
+{
+}
+
+template<typename T>
+void ObjectPool<T>::Releaser::operator()(T* object) const
+{
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    _storage->free_list.push_back(object);
+}
+
+template<typename T>
+ObjectPool<T>::ObjectPool()
+    : _storage(std::make_shared<Storage>())
+{
+}
+
+template<typename T>
+ObjectPool<T>::~ObjectPool()
+{
+}
+
+template<typename T>
+template<typename... Args>
+typename ObjectPool<T>::PtrType ObjectPool<T>::acquire(Args&&... args)
+{
+    T* object = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(_storage->mutex);
+        if(!_storage->free_list.empty()) {
+            object = _storage->free_list.back();
+            _storage->free_list.pop_back();
+        }
+    }
+    if(object == nullptr) {
+        std::unique_ptr<T> new_object(new T(std::forward<Args>(args)...));
+        object = new_object.get();
+        std::lock_guard<std::mutex> lock(_storage->mutex);
+        _storage->objects.push_back(std::move(new_object));
+        _storage->free_list.reserve(_storage->objects.size());
+        ++_storage->misses;
+    }
+    return PtrType(object, Releaser(_storage), _control_block_allocator);
+}
+
+template<typename T>
+template<typename... Args>
+void ObjectPool<T>::reserve(std::size_t n, Args const&... args)
+{
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    _storage->objects.reserve(n);
+    _storage->free_list.reserve(n);
+    while(_storage->objects.size() < n) {
+        _storage->objects.emplace_back(new T(args...));
+        _storage->free_list.push_back(_storage->objects.back().get());
+    }
+}
+
+template<typename T>
+std::size_t ObjectPool<T>::size() const
+{
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    return _storage->objects.size();
+}
+
+template<typename T>
+std::size_t ObjectPool<T>::available() const
+{
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    return _storage->free_list.size();
+}
+
+template<typename T>
+std::size_t ObjectPool<T>::misses() const
+{
+    std::lock_guard<std::mutex> lock(_storage->mutex);
+    return _storage->misses;
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,71 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/Philox.h"
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+inline void Philox4x32::round(CounterType& counter, KeyType const& key)
+{
+    static constexpr std::uint64_t multiplier_0 = 0xD2511F53;
+    static constexpr std::uint64_t multiplier_1 = 0xCD9E8D57;
+
+    std::uint64_t const product_0 = multiplier_0 * counter[0];
+    std::uint64_t const product_1 = multiplier_1 * counter[2];
+    counter = {{ static_cast<std::uint32_t>(product_1 >> 32) ^ counter[1] ^ key[0]
+               , static_cast<std::uint32_t>(product_1)
+               , static_cast<std::uint32_t>(product_0 >> 32) ^ counter[3] ^ key[1]
+               , static_cast<std::uint32_t>(product_0)
+              }};
+}
+
+inline Philox4x32::CounterType Philox4x32::generate(CounterType counter, KeyType key)
+{
+    static constexpr std::uint32_t weyl_0 = 0x9E3779B9;
+    static constexpr std::uint32_t weyl_1 = 0xBB67AE85;
+
+    round(counter, key);
+    for(unsigned i = 1; i < 10; ++i) {
+        key[0] += weyl_0;
+        key[1] += weyl_1;
+        round(counter, key);
+    }
+    return counter;
+}
+
+inline Philox4x32::KeyType Philox4x32::key(std::uint64_t seed)
+{
+    return {{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) }};
+}
+
+inline float Philox4x32::to_open_unit_interval(std::uint32_t value)
+{
+    // use the top 23 bits and centre in the bin so that neither 0 nor 1 can be returned
+    return (static_cast<float>(value >> 9) + 0.5f) * (1.0f / 8388608.0f);
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
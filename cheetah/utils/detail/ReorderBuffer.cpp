@@ -0,0 +1,170 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "panda/Error.h"
+#include <algorithm>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+template<typename KeyT>
+ReorderBuffer<KeyT>::ReorderBuffer(std::size_t capacity)
+    : _capacity(std::max<std::size_t>(capacity, 1))
+    , _next_sequence_number(0)
+    , _max_depth(0)
+    , _producer_stall_time(0)
+    , _producer_stall_count(0)
+    , _consumer_stall_time(0)
+{
+}
+
+template<typename KeyT>
+ReorderBuffer<KeyT>::~ReorderBuffer()
+{
+}
+
+template<typename KeyT>
+typename ReorderBuffer<KeyT>::SequenceNumber ReorderBuffer<KeyT>::push(KeyType const& key)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if(_entries.size() >= _capacity) {
+        auto const start = ClockType::now();
+        _space_available.wait(lock, [this]() { return _entries.size() < _capacity; });
+        _producer_stall_time += std::chrono::duration_cast<DurationType>(ClockType::now() - start);
+        ++_producer_stall_count;
+    }
+    SequenceNumber const sequence_number = _next_sequence_number++;
+    _entries.push_back(Entry{sequence_number, key, false});
+    _max_depth = std::max(_max_depth, _entries.size());
+    return sequence_number;
+}
+
+template<typename KeyT>
+void ReorderBuffer<KeyT>::cancel(SequenceNumber sequence_number)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = std::find_if(_entries.begin(), _entries.end(), [&](Entry const& e) { return e.sequence_number == sequence_number; });
+        if(it == _entries.end()) return;
+        it->cancelled = true;
+        drop_cancelled();
+    }
+    _head_changed.notify_all();
+    _space_available.notify_all();
+}
+
+template<typename KeyT>
+typename ReorderBuffer<KeyT>::SequenceNumber ReorderBuffer<KeyT>::acquire(KeyType const& key)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto const find = [&]() {
+        return std::find_if(_entries.begin(), _entries.end(), [&](Entry const& e) { return !e.cancelled && e.key == key; });
+    };
+    auto it = find();
+    if(it == _entries.end()) {
+        throw panda::Error("ReorderBuffer: unknown item");
+    }
+    SequenceNumber const sequence_number = it->sequence_number;
+    if(it != _entries.begin()) {
+        auto const start = ClockType::now();
+        _head_changed.wait(lock, [&]() { return _entries.front().sequence_number == sequence_number; });
+        _consumer_stall_time += std::chrono::duration_cast<DurationType>(ClockType::now() - start);
+    }
+    return sequence_number;
+}
+
+template<typename KeyT>
+void ReorderBuffer<KeyT>::release(SequenceNumber sequence_number)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if(_entries.empty() || _entries.front().sequence_number != sequence_number) {
+            throw panda::Error("ReorderBuffer: release out of sequence");
+        }
+        _entries.pop_front();
+        drop_cancelled();
+    }
+    _head_changed.notify_all();
+    _space_available.notify_all();
+}
+
+template<typename KeyT>
+void ReorderBuffer<KeyT>::wait_empty()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _space_available.wait(lock, [this]() { return _entries.empty(); });
+}
+
+template<typename KeyT>
+void ReorderBuffer<KeyT>::drop_cancelled()
+{
+    while(!_entries.empty() && _entries.front().cancelled) {
+        _entries.pop_front();
+    }
+}
+
+template<typename KeyT>
+std::size_t ReorderBuffer<KeyT>::capacity() const
+{
+    return _capacity;
+}
+
+template<typename KeyT>
+std::size_t ReorderBuffer<KeyT>::depth() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
+template<typename KeyT>
+std::size_t ReorderBuffer<KeyT>::max_depth() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _max_depth;
+}
+
+template<typename KeyT>
+typename ReorderBuffer<KeyT>::DurationType ReorderBuffer<KeyT>::producer_stall_time() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _producer_stall_time;
+}
+
+template<typename KeyT>
+std::uint64_t ReorderBuffer<KeyT>::producer_stall_count() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _producer_stall_count;
+}
+
+template<typename KeyT>
+typename ReorderBuffer<KeyT>::DurationType ReorderBuffer<KeyT>::consumer_stall_time() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _consumer_stall_time;
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
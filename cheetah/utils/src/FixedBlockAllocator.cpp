@@ -0,0 +1,68 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/FixedBlockAllocator.h"
+#include <algorithm>
+#include <new>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+FixedBlockCache::FixedBlockCache()
+{
+}
+
+FixedBlockCache::~FixedBlockCache()
+{
+    for(auto const& block : _blocks) {
+        ::operator delete(block.second);
+    }
+}
+
+void* FixedBlockCache::pop(std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = std::find_if(_blocks.rbegin(), _blocks.rend(), [bytes](std::pair<std::size_t, void*> const& block) { return block.first == bytes; });
+    if(it == _blocks.rend()) return nullptr;
+    void* ptr = it->second;
+    *it = _blocks.back();
+    _blocks.pop_back();
+    return ptr;
+}
+
+void FixedBlockCache::push(void* ptr, std::size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _blocks.emplace_back(bytes, ptr);
+}
+
+std::size_t FixedBlockCache::size() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _blocks.size();
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,242 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/HugePageAllocator.h"
+#include "panda/Error.h"
+#include "panda/Log.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <set>
+#include <tuple>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif // __linux__
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t page_size_2m = std::size_t(1) << 21;
+constexpr std::size_t page_size_1g = std::size_t(1) << 30;
+
+struct Mapping
+{
+    std::size_t length;     // length of the mapped region
+    std::size_t bytes;      // bytes requested
+    HugePagePolicy backing; // what the region is actually backed by
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    std::map<void*, Mapping> mappings;
+    std::set<std::tuple<std::string, HugePagePolicy, HugePagePolicy>> reported; // label, requested, backing
+};
+
+// never destroyed so that buffers released during static destruction can still be unmapped
+Registry& registry()
+{
+    static Registry* registry = new Registry;
+    return *registry;
+}
+
+std::size_t round_up(std::size_t bytes, std::size_t page_size)
+{
+    return ((bytes + page_size - 1) / page_size) * page_size;
+}
+
+std::string describe(HugePagePolicy backing)
+{
+    switch(backing) {
+        case HugePagePolicy::HugeTlb1G:
+            return "1GB hugetlb pages";
+        case HugePagePolicy::HugeTlb2M:
+            return "2MB hugetlb pages";
+        case HugePagePolicy::Transparent:
+            return "transparent huge pages";
+        default:
+            return "ordinary pages";
+    }
+}
+
+#ifdef __linux__
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+void* map_hugetlb(std::size_t length, int log2_page_size)
+{
+#ifdef MAP_HUGETLB
+    void* ptr = mmap(nullptr, length, PROT_READ | PROT_WRITE
+                    , MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (log2_page_size << MAP_HUGE_SHIFT), -1, 0);
+    return (ptr == MAP_FAILED) ? nullptr : ptr;
+#else
+    (void)length;
+    (void)log2_page_size;
+    return nullptr;
+#endif // MAP_HUGETLB
+}
+
+// a 2MB aligned anonymous mapping, advised to use transparent huge pages
+void* map_transparent(std::size_t length, bool& advised)
+{
+    std::size_t const padded_length = length + page_size_2m;
+    void* ptr = mmap(nullptr, padded_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(ptr == MAP_FAILED) return nullptr;
+
+    // trim to the aligned region
+    std::uintptr_t const start = reinterpret_cast<std::uintptr_t>(ptr);
+    std::uintptr_t const aligned = (start + page_size_2m - 1) & ~(page_size_2m - 1);
+    if(aligned != start) munmap(ptr, aligned - start);
+    std::size_t const tail = (start + padded_length) - (aligned + length);
+    if(tail) munmap(reinterpret_cast<void*>(aligned + length), tail);
+
+#ifdef MADV_HUGEPAGE
+    advised = (madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE) == 0);
+#else
+    advised = false;
+#endif // MADV_HUGEPAGE
+    return reinterpret_cast<void*>(aligned);
+}
+#endif // __linux__
+
+} // namespace
+
+HugePagePolicy huge_page_policy(std::string const& name)
+{
+    std::string lower(name);
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) { return std::tolower(static_cast<unsigned char>(c)); });
+    if(lower == "none" || lower.empty()) return HugePagePolicy::None;
+    if(lower == "transparent" || lower == "thp") return HugePagePolicy::Transparent;
+    if(lower == "2mb" || lower == "2m") return HugePagePolicy::HugeTlb2M;
+    if(lower == "1gb" || lower == "1g") return HugePagePolicy::HugeTlb1G;
+    panda::Error e("unknown huge page policy '");
+    e << name << "' (expecting one of none, transparent, 2MB, 1GB)";
+    throw e;
+}
+
+std::string to_string(HugePagePolicy policy)
+{
+    switch(policy) {
+        case HugePagePolicy::Transparent:
+            return "transparent";
+        case HugePagePolicy::HugeTlb2M:
+            return "2MB";
+        case HugePagePolicy::HugeTlb1G:
+            return "1GB";
+        default:
+            return "none";
+    }
+}
+
+void* HugePages::allocate(std::size_t bytes, HugePagePolicy policy, char const* label)
+{
+    if(policy == HugePagePolicy::None || bytes < page_size_2m) {
+        return ::operator new(bytes);
+    }
+
+    void* ptr = nullptr;
+    Mapping mapping{0, bytes, HugePagePolicy::None};
+#ifdef __linux__
+    if(policy == HugePagePolicy::HugeTlb1G) {
+        mapping.length = round_up(bytes, page_size_1g);
+        ptr = map_hugetlb(mapping.length, 30);
+        mapping.backing = HugePagePolicy::HugeTlb1G;
+    }
+    if(ptr == nullptr && policy != HugePagePolicy::Transparent) {
+        mapping.length = round_up(bytes, page_size_2m);
+        ptr = map_hugetlb(mapping.length, 21);
+        mapping.backing = HugePagePolicy::HugeTlb2M;
+    }
+    if(ptr == nullptr) {
+        bool advised = false;
+        mapping.length = round_up(bytes, page_size_2m);
+        ptr = map_transparent(mapping.length, advised);
+        mapping.backing = advised ? HugePagePolicy::Transparent : HugePagePolicy::None;
+    }
+#endif // __linux__
+
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    if(ptr == nullptr) {
+        mapping.backing = HugePagePolicy::None;
+    }
+    else {
+        reg.mappings.emplace(ptr, mapping);
+    }
+
+    if(reg.reported.emplace(label, policy, mapping.backing).second) {
+        if(mapping.backing == policy) {
+            PANDA_LOG << "hugepages: '" << label << "' buffers backed by " << describe(mapping.backing);
+        }
+        else {
+            PANDA_LOG_WARN << "hugepages: '" << label << "' requested " << describe(policy)
+                           << ", falling back to " << describe(mapping.backing);
+        }
+    }
+    if(ptr == nullptr) return ::operator new(bytes);
+    return ptr;
+}
+
+void HugePages::deallocate(void* ptr, std::size_t bytes)
+{
+    if(ptr == nullptr) return;
+    if(bytes >= page_size_2m) {
+        Registry& reg = registry();
+        std::unique_lock<std::mutex> lock(reg.mutex);
+        auto it = reg.mappings.find(ptr);
+        if(it != reg.mappings.end()) {
+            std::size_t const length = it->second.length;
+            reg.mappings.erase(it);
+            lock.unlock();
+#ifdef __linux__
+            munmap(ptr, length);
+#else
+            (void)length;
+#endif // __linux__
+            return;
+        }
+    }
+    ::operator delete(ptr);
+}
+
+std::size_t HugePages::bytes_allocated(HugePagePolicy backing)
+{
+    Registry& reg = registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    std::size_t total = 0;
+    for(auto const& mapping : reg.mappings) {
+        if(mapping.second.backing == backing) total += mapping.second.bytes;
+    }
+    return total;
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
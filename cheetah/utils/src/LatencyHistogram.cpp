@@ -0,0 +1,209 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+namespace {
+
+inline unsigned highest_bit(std::uint64_t value)
+{
+    return 63U - static_cast<unsigned>(__builtin_clzll(value));
+}
+
+} // namespace
+
+LatencyHistogram::Shard::Shard()
+    : count(0)
+    , sum(0)
+    , min(std::numeric_limits<std::uint64_t>::max())
+    , max(0)
+{
+    for(auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+LatencyHistogram::LatencyHistogram()
+    : _shards(new Shard[shard_count])
+{
+}
+
+LatencyHistogram::~LatencyHistogram()
+{
+}
+
+std::size_t LatencyHistogram::thread_shard()
+{
+    static std::atomic<std::size_t> next_shard(0);
+    thread_local std::size_t const shard = next_shard.fetch_add(1, std::memory_order_relaxed) % shard_count;
+    return shard;
+}
+
+std::size_t LatencyHistogram::bucket_index(std::uint64_t value)
+{
+    if(value < sub_bucket_count) return static_cast<std::size_t>(value);
+    unsigned const exponent = highest_bit(value);
+    unsigned const shift = exponent - sub_bucket_bits;
+    std::size_t const sub_bucket = static_cast<std::size_t>(value >> shift) - sub_bucket_count;
+    return (exponent - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::bucket_lower_bound(std::size_t index)
+{
+    if(index < sub_bucket_count) return index;
+    unsigned const shift = static_cast<unsigned>(index / sub_bucket_count) - 1;
+    return static_cast<std::uint64_t>(sub_bucket_count + index % sub_bucket_count) << shift;
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(std::size_t index)
+{
+    if(index < sub_bucket_count) return index;
+    unsigned const shift = static_cast<unsigned>(index / sub_bucket_count) - 1;
+    return bucket_lower_bound(index) + ((std::uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::record(DurationType duration)
+{
+    record(static_cast<std::uint64_t>(std::max(duration.count(), DurationType::rep(0))));
+}
+
+void LatencyHistogram::record_since(ClockType::time_point const& start)
+{
+    record(std::chrono::duration_cast<DurationType>(ClockType::now() - start));
+}
+
+void LatencyHistogram::record(std::uint64_t value)
+{
+    Shard& shard = _shards[thread_shard()];
+    shard.buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.count.fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t current = shard.max.load(std::memory_order_relaxed);
+    while(value > current && !shard.max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    current = shard.min.load(std::memory_order_relaxed);
+    while(value < current && !shard.min.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot._buckets.resize(bucket_count, 0);
+    std::uint64_t min = std::numeric_limits<std::uint64_t>::max();
+    for(std::size_t shard_index = 0; shard_index < shard_count; ++shard_index) {
+        Shard const& shard = _shards[shard_index];
+        for(std::size_t i = 0; i < bucket_count; ++i) {
+            snapshot._buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+        snapshot._count += shard.count.load(std::memory_order_relaxed);
+        snapshot._sum += shard.sum.load(std::memory_order_relaxed);
+        min = std::min(min, shard.min.load(std::memory_order_relaxed));
+        snapshot._max = std::max(snapshot._max, shard.max.load(std::memory_order_relaxed));
+    }
+    if(snapshot._count != 0) snapshot._min = min;
+    return snapshot;
+}
+
+void LatencyHistogram::reset()
+{
+    for(std::size_t shard_index = 0; shard_index < shard_count; ++shard_index) {
+        Shard& shard = _shards[shard_index];
+        for(auto& bucket : shard.buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        shard.count.store(0, std::memory_order_relaxed);
+        shard.sum.store(0, std::memory_order_relaxed);
+        shard.min.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+        shard.max.store(0, std::memory_order_relaxed);
+    }
+}
+
+// ------------------ Snapshot ---------------------
+LatencyHistogram::Snapshot::Snapshot()
+    : _count(0)
+    , _sum(0)
+    , _min(0)
+    , _max(0)
+{
+}
+
+std::uint64_t LatencyHistogram::Snapshot::count() const
+{
+    return _count;
+}
+
+std::uint64_t LatencyHistogram::Snapshot::sum() const
+{
+    return _sum;
+}
+
+std::uint64_t LatencyHistogram::Snapshot::min() const
+{
+    return _min;
+}
+
+std::uint64_t LatencyHistogram::Snapshot::max() const
+{
+    return _max;
+}
+
+double LatencyHistogram::Snapshot::mean() const
+{
+    if(_count == 0) return 0.0;
+    return static_cast<double>(_sum) / static_cast<double>(_count);
+}
+
+std::uint64_t LatencyHistogram::Snapshot::value_at_percentile(double percentile) const
+{
+    // the bucket totals can be ahead of _count if values were recorded during the snapshot
+    std::uint64_t total = 0;
+    for(auto const& bucket : _buckets) total += bucket;
+    if(total == 0) return 0;
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    std::uint64_t const rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(percentile * static_cast<double>(total) / 100.0)));
+    std::uint64_t cumulative = 0;
+    for(std::size_t i = 0; i < _buckets.size(); ++i) {
+        cumulative += _buckets[i];
+        if(cumulative >= rank) {
+            return std::min(bucket_upper_bound(i), _max);
+        }
+    }
+    return _max;
+}
+
+std::vector<std::uint64_t> const& LatencyHistogram::Snapshot::buckets() const
+{
+    return _buckets;
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
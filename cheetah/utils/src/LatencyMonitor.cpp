@@ -0,0 +1,184 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/LatencyMonitor.h"
+#include "panda/Error.h"
+#include "panda/Log.h"
+#include <iomanip>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+namespace {
+
+void write_json_string(std::ostream& os, std::string const& value)
+{
+    os << '"';
+    for(char c : value) {
+        if(c == '"' || c == '\\') os << '\\';
+        os << c;
+    }
+    os << '"';
+}
+
+} // namespace
+
+LatencyMonitor::LatencyMonitor()
+    : _enabled(false)
+    , _dump_stop(false)
+{
+}
+
+LatencyMonitor::~LatencyMonitor()
+{
+    stop_dump();
+}
+
+LatencyMonitor& LatencyMonitor::instance()
+{
+    static LatencyMonitor monitor;
+    return monitor;
+}
+
+bool LatencyMonitor::enabled()
+{
+    return instance()._enabled.load(std::memory_order_relaxed);
+}
+
+void LatencyMonitor::enable(bool enable)
+{
+    _enabled.store(enable, std::memory_order_relaxed);
+}
+
+LatencyHistogram& LatencyMonitor::histogram(std::string const& stage, std::string const& beam_id)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& histogram = _histograms[KeyType(stage, beam_id)];
+    if(!histogram) histogram.reset(new LatencyHistogram());
+    return *histogram;
+}
+
+std::vector<std::pair<std::string, std::string>> LatencyMonitor::stages() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<KeyType> keys;
+    keys.reserve(_histograms.size());
+    for(auto const& entry : _histograms) {
+        keys.push_back(entry.first);
+    }
+    return keys;
+}
+
+void LatencyMonitor::write_snapshot(std::ostream& os) const
+{
+    auto const now = std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::ios::fmtflags const flags = os.flags();
+    std::streamsize const precision = os.precision();
+    os << "{\"time\":" << std::fixed << std::setprecision(3) << now << ",\"histograms\":[";
+    bool first = true;
+    for(auto const& entry : _histograms) {
+        LatencyHistogram::Snapshot const snapshot = entry.second->snapshot();
+        if(!first) os << ",";
+        first = false;
+        os << "{\"stage\":";
+        write_json_string(os, entry.first.first);
+        os << ",\"beam\":";
+        write_json_string(os, entry.first.second);
+        os << ",\"count\":" << snapshot.count()
+           << ",\"mean_us\":" << snapshot.mean() / 1000.0
+           << ",\"min_us\":" << snapshot.min() / 1000.0
+           << ",\"p50_us\":" << snapshot.value_at_percentile(50.0) / 1000.0
+           << ",\"p90_us\":" << snapshot.value_at_percentile(90.0) / 1000.0
+           << ",\"p99_us\":" << snapshot.value_at_percentile(99.0) / 1000.0
+           << ",\"p999_us\":" << snapshot.value_at_percentile(99.9) / 1000.0
+           << ",\"max_us\":" << snapshot.max() / 1000.0
+           << "}";
+    }
+    os << "]}\n";
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void LatencyMonitor::start_dump(std::string const& filename, std::chrono::milliseconds interval)
+{
+    stop_dump();
+    if(interval.count() <= 0) {
+        throw panda::Error("LatencyMonitor: dump interval must be > 0");
+    }
+    _dump_file.open(filename, std::ios::out | std::ios::app);
+    if(!_dump_file.is_open()) {
+        panda::Error e("LatencyMonitor: unable to open file ");
+        e << filename;
+        throw e;
+    }
+    PANDA_LOG << "writing latency histograms to " << filename << " every " << interval.count() << "ms";
+    enable(true);
+    _dump_stop = false;
+    _dump_thread = std::thread([this, interval]() { dump_loop(interval); });
+}
+
+void LatencyMonitor::stop_dump()
+{
+    if(!_dump_thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(_dump_mutex);
+        _dump_stop = true;
+    }
+    _dump_cv.notify_all();
+    _dump_thread.join();
+    write_snapshot(_dump_file);
+    _dump_file.close();
+}
+
+void LatencyMonitor::dump_loop(std::chrono::milliseconds interval)
+{
+    std::unique_lock<std::mutex> lock(_dump_mutex);
+    while(!_dump_cv.wait_for(lock, interval, [this]() { return _dump_stop; })) {
+        write_snapshot(_dump_file);
+        _dump_file.flush();
+    }
+}
+
+// ------------------ ScopedLatency ---------------------
+ScopedLatency::ScopedLatency(std::string const& stage, std::string const& beam_id)
+    : _histogram(LatencyMonitor::enabled() ? &LatencyMonitor::instance().histogram(stage, beam_id) : nullptr)
+{
+    if(_histogram) _start = LatencyHistogram::ClockType::now();
+}
+
+ScopedLatency::ScopedLatency(LatencyHistogram& histogram)
+    : _histogram(LatencyMonitor::enabled() ? &histogram : nullptr)
+{
+    if(_histogram) _start = LatencyHistogram::ClockType::now();
+}
+
+ScopedLatency::~ScopedLatency()
+{
+    if(_histogram) _histogram->record_since(_start);
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
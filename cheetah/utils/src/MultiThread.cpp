@@ -15,7 +15,11 @@ MultiThread::MultiThread()
 
 MultiThread::~MultiThread()
 {
-    std::cout<<"~MultiThread()\n";
+    terminate();
+    for(auto& thread : _threads)
+    {
+        if(thread.joinable()) thread.join();
+    }
 }
 
 void MultiThread::reset(unsigned id)
@@ -33,11 +37,12 @@ void MultiThread::ready(unsigned id)
     //_cv.notify_all();
 }
 
-void MultiThread::wait(unsigned id)
+bool MultiThread::wait(unsigned id)
 {
     bool flag = false;
     while(!flag)
     {
+        if(!status(id)) return false;
         {
             std::unique_lock lk(_mutex[id]);
             flag = _ready[id];
@@ -46,6 +51,7 @@ void MultiThread::wait(unsigned id)
     //std::unique_lock lk(_mutex[id]);
     //_cv.wait(lk, [id, this]{ return _ready[id]; });
     //if(_ready[id]==false)
+    return true;
 }
 
 void MultiThread::finish(unsigned id)
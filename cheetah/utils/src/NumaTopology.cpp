@@ -0,0 +1,218 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/NumaTopology.h"
+#include "panda/Log.h"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <thread>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+NumaTopology::NumaTopology(std::string const& sysfs_node_dir)
+{
+    std::map<unsigned, std::vector<unsigned>> nodes;
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator it(sysfs_node_dir, ec);
+    if(!ec) {
+        for(; it != boost::filesystem::directory_iterator(); ++it) {
+            std::string const name = it->path().filename().string();
+            if(name.size() <= 4 || name.compare(0, 4, "node") != 0
+               || !std::all_of(name.begin() + 4, name.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); })) continue;
+            std::ifstream cpulist((it->path() / "cpulist").string());
+            std::string line;
+            if(!std::getline(cpulist, line)) continue;
+            auto cpus = parse_cpu_list(line);
+            if(cpus.empty()) continue; // memory only node
+            nodes[static_cast<unsigned>(std::stoul(name.substr(4)))] = std::move(cpus);
+        }
+    }
+
+    if(nodes.empty()) {
+        std::vector<unsigned> cpus(std::max(1U, std::thread::hardware_concurrency()));
+        for(unsigned i=0; i < cpus.size(); ++i) cpus[i] = i;
+        nodes[0] = std::move(cpus);
+    }
+
+    for(auto& node : nodes) {
+        _node_ids.push_back(node.first);
+        _node_cpus.push_back(std::move(node.second));
+    }
+}
+
+NumaTopology::~NumaTopology()
+{
+}
+
+NumaTopology const& NumaTopology::system()
+{
+    static NumaTopology const topology;
+    return topology;
+}
+
+std::size_t NumaTopology::number_of_nodes() const
+{
+    return _node_cpus.size();
+}
+
+unsigned NumaTopology::node_id(std::size_t node) const
+{
+    return _node_ids[node];
+}
+
+std::vector<unsigned> const& NumaTopology::cpus(std::size_t node) const
+{
+    return _node_cpus[node];
+}
+
+int NumaTopology::node_of_cpu(unsigned cpu) const
+{
+    for(std::size_t node=0; node < _node_cpus.size(); ++node) {
+        if(std::find(_node_cpus[node].begin(), _node_cpus[node].end(), cpu) != _node_cpus[node].end()) return static_cast<int>(node);
+    }
+    return -1;
+}
+
+int NumaTopology::node_of_cpus(std::vector<unsigned> const& cpus) const
+{
+    std::vector<std::size_t> counts(_node_cpus.size(), 0);
+    for(unsigned cpu : cpus) {
+        int const node = node_of_cpu(cpu);
+        if(node >= 0) ++counts[node];
+    }
+    auto it = std::max_element(counts.begin(), counts.end());
+    if(it == counts.end() || *it == 0) return -1;
+    return static_cast<int>(std::distance(counts.begin(), it));
+}
+
+bool NumaTopology::spans_nodes(std::vector<unsigned> const& cpus) const
+{
+    int first = -1;
+    for(unsigned cpu : cpus) {
+        int const node = node_of_cpu(cpu);
+        if(node < 0) continue;
+        if(first < 0) first = node;
+        else if(node != first) return true;
+    }
+    return false;
+}
+
+std::vector<std::vector<unsigned>> NumaTopology::assign_cores(std::size_t number_of_beams) const
+{
+    std::vector<std::vector<unsigned>> assignment(number_of_beams);
+    std::size_t const number_of_nodes = _node_cpus.size();
+    for(std::size_t node=0; node < number_of_nodes; ++node) {
+        // beams node, node + number_of_nodes, ... live here
+        std::vector<std::size_t> beams;
+        for(std::size_t beam=node; beam < number_of_beams; beam += number_of_nodes) beams.push_back(beam);
+        if(beams.empty()) continue;
+
+        auto const& cpus = _node_cpus[node];
+        std::size_t const share = cpus.size() / beams.size();
+        std::size_t const remainder = cpus.size() % beams.size();
+        std::size_t offset = 0;
+        for(std::size_t i=0; i < beams.size(); ++i) {
+            std::size_t const n = std::max<std::size_t>(1, share + (i < remainder ? 1 : 0));
+            for(std::size_t j=0; j < n; ++j) {
+                assignment[beams[i]].push_back(cpus[(offset + j) % cpus.size()]); // more beams than cpus: share
+            }
+            offset += n;
+        }
+    }
+    return assignment;
+}
+
+std::vector<unsigned> NumaTopology::parse_cpu_list(std::string const& cpu_list)
+{
+    std::vector<unsigned> cpus;
+    std::stringstream ss(cpu_list);
+    std::string range;
+    while(std::getline(ss, range, ',')) {
+        range.erase(std::remove_if(range.begin(), range.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }), range.end());
+        if(range.empty()) continue;
+        auto const dash = range.find('-');
+        unsigned const first = static_cast<unsigned>(std::stoul(range.substr(0, dash)));
+        unsigned const last = (dash == std::string::npos) ? first : static_cast<unsigned>(std::stoul(range.substr(dash + 1)));
+        for(unsigned cpu=first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+#ifdef __linux__
+bool NumaTopology::bind_thread(std::vector<unsigned> const& cpus)
+{
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for(unsigned cpu : cpus) CPU_SET(cpu, &cpuset);
+    if(pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset) != 0) {
+        PANDA_LOG_WARN << "unable to set thread affinity";
+        return false;
+    }
+    return true;
+}
+
+bool NumaTopology::prefer_node(unsigned node_id)
+{
+#ifdef SYS_set_mempolicy
+    constexpr int mpol_preferred = 1; // from linux/mempolicy.h
+    constexpr unsigned long bits_per_mask = 8 * sizeof(unsigned long);
+    std::vector<unsigned long> nodemask(node_id / bits_per_mask + 1, 0);
+    nodemask[node_id / bits_per_mask] |= 1UL << (node_id % bits_per_mask);
+    if(syscall(SYS_set_mempolicy, mpol_preferred, nodemask.data(), nodemask.size() * bits_per_mask + 1) != 0) {
+        PANDA_LOG_DEBUG << "set_mempolicy failed: relying on first touch placement";
+        return false;
+    }
+    return true;
+#else
+    (void)node_id;
+    return false;
+#endif // SYS_set_mempolicy
+}
+#else
+
+bool NumaTopology::bind_thread(std::vector<unsigned> const&)
+{
+    return false;
+}
+
+bool NumaTopology::prefer_node(unsigned)
+{
+    return false;
+}
+#endif // __linux__
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,161 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/WorkerPool.h"
+#include "cheetah/utils/NumaTopology.h"
+#include <algorithm>
+
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+
+
+WorkerPool::WorkerPool(unsigned number_of_threads)
+    : WorkerPool(number_of_threads, std::vector<unsigned>())
+{
+}
+
+WorkerPool::WorkerPool(unsigned number_of_threads, std::vector<unsigned> const& cpus)
+    : _cpus(cpus)
+    , _task(nullptr)
+    , _number_of_tasks(0)
+    , _next_task(0)
+    , _active(0)
+    , _generation(0)
+    , _stop(false)
+{
+    number_of_threads = std::max(1U, number_of_threads);
+    _threads.reserve(number_of_threads - 1);
+    for(unsigned i=1; i < number_of_threads; ++i)
+    {
+        _threads.emplace_back(&WorkerPool::worker, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start.notify_all();
+    for(auto& thread : _threads)
+    {
+        thread.join();
+    }
+}
+
+unsigned WorkerPool::number_of_threads() const
+{
+    return _threads.size() + 1;
+}
+
+std::vector<unsigned> const& WorkerPool::cpus() const
+{
+    return _cpus;
+}
+
+void WorkerPool::run(std::size_t number_of_tasks, TaskType const& task)
+{
+    if(number_of_tasks == 0) return;
+    if(_threads.empty() || number_of_tasks == 1)
+    {
+        for(std::size_t i=0; i < number_of_tasks; ++i)
+        {
+            task(i);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(_run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _task = &task;
+        _number_of_tasks = number_of_tasks;
+        _next_task = 0;
+        _active = _threads.size();
+        _exception = nullptr;
+        ++_generation;
+    }
+    _start.notify_all();
+
+    // the calling thread takes its share
+    do_tasks();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _done.wait(lock, [this]() { return _active == 0; });
+        _task = nullptr;
+        std::swap(exception, _exception);
+    }
+    if(exception) std::rethrow_exception(exception);
+}
+
+void WorkerPool::do_tasks()
+{
+    std::size_t index;
+    while((index = _next_task++) < _number_of_tasks)
+    {
+        try
+        {
+            (*_task)(index);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(!_exception) _exception = std::current_exception();
+        }
+    }
+}
+
+void WorkerPool::worker()
+{
+    if(!_cpus.empty())
+    {
+        NumaTopology::bind_thread(_cpus);
+        int const node = NumaTopology::system().node_of_cpus(_cpus);
+        if(node >= 0) NumaTopology::prefer_node(NumaTopology::system().node_id(node));
+    }
+    std::uint64_t generation = 0;
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _start.wait(lock, [&]() { return _stop || _generation != generation; });
+            if(_stop) return;
+            generation = _generation;
+        }
+        do_tasks();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(--_active != 0) continue;
+        }
+        _done.notify_one();
+    }
+}
+
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,111 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/FixedBlockAllocatorTest.h"
+#include "cheetah/utils/FixedBlockAllocator.h"
+#include <memory>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+FixedBlockAllocatorTest::FixedBlockAllocatorTest()
+    : ::testing::Test()
+{
+}
+
+FixedBlockAllocatorTest::~FixedBlockAllocatorTest()
+{
+}
+
+void FixedBlockAllocatorTest::SetUp()
+{
+}
+
+void FixedBlockAllocatorTest::TearDown()
+{
+}
+
+TEST_F(FixedBlockAllocatorTest, test_blocks_are_reused)
+{
+    FixedBlockAllocator<double> allocator;
+    double* block = allocator.allocate(4);
+    ASSERT_NE(nullptr, block);
+    ASSERT_EQ(0U, allocator.cached_blocks());
+    allocator.deallocate(block, 4);
+    ASSERT_EQ(1U, allocator.cached_blocks());
+
+    // a different size does not use the cached block
+    double* other = allocator.allocate(8);
+    ASSERT_EQ(1U, allocator.cached_blocks());
+    ASSERT_EQ(block, allocator.allocate(4));
+    ASSERT_EQ(0U, allocator.cached_blocks());
+    allocator.deallocate(other, 8);
+    allocator.deallocate(block, 4);
+    ASSERT_EQ(2U, allocator.cached_blocks());
+}
+
+TEST_F(FixedBlockAllocatorTest, test_copies_share_cache)
+{
+    FixedBlockAllocator<int> allocator;
+    FixedBlockAllocator<char> rebound(allocator);
+    ASSERT_TRUE(allocator == rebound);
+    ASSERT_FALSE(allocator == FixedBlockAllocator<int>());
+
+    int* block = allocator.allocate(2);
+    allocator.deallocate(block, 2);
+    ASSERT_EQ(1U, rebound.cached_blocks());
+    char* reused = rebound.allocate(2 * sizeof(int));
+    ASSERT_EQ(static_cast<void*>(block), static_cast<void*>(reused));
+    rebound.deallocate(reused, 2 * sizeof(int));
+}
+
+TEST_F(FixedBlockAllocatorTest, test_shared_ptr_control_block)
+{
+    FixedBlockAllocator<int> allocator;
+    {
+        std::shared_ptr<int> ptr(new int(1), [](int* p) { delete p; }, allocator);
+        ASSERT_EQ(0U, allocator.cached_blocks());
+    }
+    ASSERT_EQ(1U, allocator.cached_blocks());
+    std::shared_ptr<int> ptr(new int(2), [](int* p) { delete p; }, allocator);
+    ASSERT_EQ(0U, allocator.cached_blocks());
+}
+
+TEST_F(FixedBlockAllocatorTest, test_std_container)
+{
+    FixedBlockAllocator<float> allocator;
+    {
+        std::vector<float, FixedBlockAllocator<float>> data(100, 1.0f, allocator);
+        ASSERT_EQ(100U, data.size());
+    }
+    ASSERT_EQ(1U, allocator.cached_blocks());
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,113 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/HugePageAllocatorTest.h"
+#include "cheetah/utils/HugePageAllocator.h"
+#include "panda/Error.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+HugePageAllocatorTest::HugePageAllocatorTest()
+    : ::testing::Test()
+{
+}
+
+HugePageAllocatorTest::~HugePageAllocatorTest()
+{
+}
+
+void HugePageAllocatorTest::SetUp()
+{
+}
+
+void HugePageAllocatorTest::TearDown()
+{
+}
+
+TEST_F(HugePageAllocatorTest, test_policy_names)
+{
+    ASSERT_EQ(HugePagePolicy::None, huge_page_policy("none"));
+    ASSERT_EQ(HugePagePolicy::Transparent, huge_page_policy("transparent"));
+    ASSERT_EQ(HugePagePolicy::HugeTlb2M, huge_page_policy("2MB"));
+    ASSERT_EQ(HugePagePolicy::HugeTlb1G, huge_page_policy("1gb"));
+    ASSERT_THROW(huge_page_policy("4kB"), panda::Error);
+
+    for(auto policy : { HugePagePolicy::None, HugePagePolicy::Transparent, HugePagePolicy::HugeTlb2M, HugePagePolicy::HugeTlb1G }) {
+        ASSERT_EQ(policy, huge_page_policy(to_string(policy)));
+    }
+}
+
+TEST_F(HugePageAllocatorTest, test_small_allocations_use_heap)
+{
+    std::size_t const before = HugePages::bytes_allocated(HugePagePolicy::Transparent) + HugePages::bytes_allocated(HugePagePolicy::None);
+    std::vector<int, HugePageAllocator<int>> data(100, 1, HugePageAllocator<int>(HugePagePolicy::Transparent, "test small"));
+    ASSERT_EQ(before, HugePages::bytes_allocated(HugePagePolicy::Transparent) + HugePages::bytes_allocated(HugePagePolicy::None));
+}
+
+TEST_F(HugePageAllocatorTest, test_large_allocations)
+{
+    // whatever the host supports the buffer must be usable (falling back as required)
+    std::size_t const size = 3 * (1 << 20);
+    for(auto policy : { HugePagePolicy::None, HugePagePolicy::Transparent, HugePagePolicy::HugeTlb2M, HugePagePolicy::HugeTlb1G }) {
+        std::vector<float, HugePageAllocator<float>> data(size, 2.0f, HugePageAllocator<float>(policy, "test large"));
+        ASSERT_EQ(size, data.size());
+        ASSERT_TRUE(std::all_of(data.begin(), data.end(), [](float v) { return v == 2.0f; }));
+        if(policy != HugePagePolicy::None) {
+            // huge page backed buffers are mapped on a 2MB boundary
+            ASSERT_EQ(0U, reinterpret_cast<std::uintptr_t>(data.data()) % (1 << 21));
+        }
+        auto copy = data;
+        ASSERT_EQ(policy, copy.get_allocator().policy());
+        data.clear();
+        data.shrink_to_fit();
+    }
+}
+
+TEST_F(HugePageAllocatorTest, test_accounting)
+{
+    std::size_t const bytes = 4 * (1 << 20);
+    auto total = []() {
+        return HugePages::bytes_allocated(HugePagePolicy::None)
+             + HugePages::bytes_allocated(HugePagePolicy::Transparent)
+             + HugePages::bytes_allocated(HugePagePolicy::HugeTlb2M)
+             + HugePages::bytes_allocated(HugePagePolicy::HugeTlb1G);
+    };
+    std::size_t const before = total();
+    void* ptr = HugePages::allocate(bytes, HugePagePolicy::Transparent, "test accounting");
+    ASSERT_NE(nullptr, ptr);
+    ASSERT_EQ(before + bytes, total());
+    HugePages::deallocate(ptr, bytes);
+    ASSERT_EQ(before, total());
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,157 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/LatencyHistogramTest.h"
+#include "cheetah/utils/LatencyHistogram.h"
+#include "cheetah/utils/LatencyMonitor.h"
+#include <sstream>
+#include <thread>
+#include <vector>
+
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+LatencyHistogramTest::LatencyHistogramTest()
+    : ::testing::Test()
+{
+}
+
+LatencyHistogramTest::~LatencyHistogramTest()
+{
+}
+
+void LatencyHistogramTest::SetUp()
+{
+}
+
+void LatencyHistogramTest::TearDown()
+{
+}
+
+TEST_F(LatencyHistogramTest, test_bucket_bounds)
+{
+    // every value must lie within the bounds of its bucket and the buckets must be contiguous
+    std::vector<std::uint64_t> values = { 0, 1, 15, 16, 17, 31, 32, 33, 1000, 123456789, 1ULL << 40, ~0ULL };
+    for(auto value : values) {
+        std::size_t index = LatencyHistogram::bucket_index(value);
+        ASSERT_LT(index, LatencyHistogram::bucket_count);
+        ASSERT_LE(LatencyHistogram::bucket_lower_bound(index), value) << value;
+        ASSERT_GE(LatencyHistogram::bucket_upper_bound(index), value) << value;
+    }
+    for(std::size_t index = 1; index < LatencyHistogram::bucket_count; ++index) {
+        ASSERT_EQ(LatencyHistogram::bucket_upper_bound(index - 1) + 1, LatencyHistogram::bucket_lower_bound(index)) << index;
+    }
+    ASSERT_EQ(~0ULL, LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_count - 1));
+}
+
+TEST_F(LatencyHistogramTest, test_percentiles)
+{
+    LatencyHistogram histogram;
+    ASSERT_EQ(0U, histogram.snapshot().count());
+    ASSERT_EQ(0U, histogram.snapshot().value_at_percentile(50.0));
+
+    for(std::uint64_t value = 1; value <= 10000; ++value) {
+        histogram.record(std::chrono::microseconds(value));
+    }
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(10000U, snapshot.count());
+    ASSERT_EQ(1000U, snapshot.min());
+    ASSERT_EQ(10000000U, snapshot.max());
+    ASSERT_DOUBLE_EQ(5000500.0, snapshot.mean());
+
+    // relative error is bounded by the sub bucket resolution
+    double const tolerance = 1.0 / LatencyHistogram::sub_bucket_count;
+    for(double percentile : { 10.0, 50.0, 90.0, 99.0, 99.9 }) {
+        double expected = percentile * 100000.0; // in ns
+        double value = static_cast<double>(snapshot.value_at_percentile(percentile));
+        ASSERT_GE(value, expected) << percentile;
+        ASSERT_LE(value, expected * (1.0 + tolerance)) << percentile;
+    }
+    ASSERT_EQ(snapshot.max(), snapshot.value_at_percentile(100.0));
+
+    histogram.reset();
+    ASSERT_EQ(0U, histogram.snapshot().count());
+    ASSERT_EQ(0U, histogram.snapshot().max());
+}
+
+TEST_F(LatencyHistogramTest, test_concurrent_record)
+{
+    LatencyHistogram histogram;
+    unsigned const number_of_threads = 4;
+    std::uint64_t const values_per_thread = 10000;
+    std::vector<std::thread> threads;
+    for(unsigned thread = 0; thread < number_of_threads; ++thread) {
+        threads.emplace_back([&histogram, values_per_thread, thread]()
+                             {
+                                 for(std::uint64_t value = 0; value < values_per_thread; ++value) {
+                                     histogram.record(value + thread);
+                                 }
+                             });
+    }
+    for(auto& thread : threads) thread.join();
+
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(number_of_threads * values_per_thread, snapshot.count());
+    std::uint64_t total = 0;
+    for(auto count : snapshot.buckets()) total += count;
+    ASSERT_EQ(snapshot.count(), total);
+    ASSERT_EQ(0U, snapshot.min());
+    ASSERT_EQ(values_per_thread + number_of_threads - 2, snapshot.max());
+}
+
+TEST_F(LatencyHistogramTest, test_monitor_snapshot)
+{
+    LatencyMonitor& monitor = LatencyMonitor::instance();
+    LatencyHistogram& histogram = monitor.histogram("test_stage", "beam \"1\"");
+    ASSERT_EQ(&histogram, &monitor.histogram("test_stage", "beam \"1\""));
+    ASSERT_NE(&histogram, &monitor.histogram("test_stage", "beam 2"));
+
+    monitor.enable(false);
+    {
+        ScopedLatency timer(histogram);
+    }
+    ASSERT_EQ(0U, histogram.snapshot().count());
+
+    monitor.enable(true);
+    {
+        ScopedLatency timer("test_stage", "beam \"1\"");
+    }
+    monitor.enable(false);
+    ASSERT_EQ(1U, histogram.snapshot().count());
+
+    std::stringstream ss;
+    monitor.write_snapshot(ss);
+    std::string const line = ss.str();
+    ASSERT_EQ('\n', line.back());
+    ASSERT_NE(std::string::npos, line.find("{\"stage\":\"test_stage\",\"beam\":\"beam \\\"1\\\"\",\"count\":1,"));
+    ASSERT_NE(std::string::npos, line.find("\"beam\":\"beam 2\",\"count\":0,"));
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
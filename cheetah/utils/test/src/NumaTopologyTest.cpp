@@ -0,0 +1,156 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/NumaTopologyTest.h"
+#include "cheetah/utils/NumaTopology.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <set>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+NumaTopologyTest::NumaTopologyTest()
+    : ::testing::Test()
+{
+}
+
+NumaTopologyTest::~NumaTopologyTest()
+{
+}
+
+void NumaTopologyTest::SetUp()
+{
+}
+
+void NumaTopologyTest::TearDown()
+{
+}
+
+namespace {
+    // create a directory with the same layout as /sys/devices/system/node
+    struct FakeSysfs
+    {
+        FakeSysfs(std::vector<std::pair<unsigned, std::string>> const& nodes)
+            : _dir(boost::filesystem::temp_directory_path() / boost::filesystem::unique_path())
+        {
+            boost::filesystem::create_directories(_dir);
+            for(auto const& node : nodes) {
+                auto const node_dir = _dir / ("node" + std::to_string(node.first));
+                boost::filesystem::create_directories(node_dir);
+                std::ofstream((node_dir / "cpulist").string()) << node.second << "\n";
+            }
+            boost::filesystem::create_directories(_dir / "power"); // not a node
+        }
+
+        ~FakeSysfs()
+        {
+            boost::filesystem::remove_all(_dir);
+        }
+
+        std::string path() const { return _dir.string(); }
+
+        boost::filesystem::path _dir;
+    };
+} // namespace
+
+TEST_F(NumaTopologyTest, test_parse_cpu_list)
+{
+    ASSERT_EQ(std::vector<unsigned>({0, 1, 2, 3, 8, 10, 11}), NumaTopology::parse_cpu_list("0-3,8,10-11"));
+    ASSERT_EQ(std::vector<unsigned>({5}), NumaTopology::parse_cpu_list(" 5\n"));
+    ASSERT_TRUE(NumaTopology::parse_cpu_list("").empty());
+}
+
+TEST_F(NumaTopologyTest, test_read_topology)
+{
+    FakeSysfs sysfs({{0, "0-3"}, {2, "4-7"}, {3, ""}}); // node 3 is memory only
+    NumaTopology topology(sysfs.path());
+    ASSERT_EQ(2U, topology.number_of_nodes());
+    ASSERT_EQ(0U, topology.node_id(0));
+    ASSERT_EQ(2U, topology.node_id(1));
+    ASSERT_EQ(std::vector<unsigned>({4, 5, 6, 7}), topology.cpus(1));
+    ASSERT_EQ(1, topology.node_of_cpu(5));
+    ASSERT_EQ(-1, topology.node_of_cpu(8));
+    ASSERT_EQ(1, topology.node_of_cpus({3, 4, 5}));
+    ASSERT_EQ(-1, topology.node_of_cpus({}));
+    ASSERT_TRUE(topology.spans_nodes({3, 4}));
+    ASSERT_FALSE(topology.spans_nodes({4, 7}));
+}
+
+TEST_F(NumaTopologyTest, test_missing_sysfs)
+{
+    NumaTopology topology("/this/does/not/exist");
+    ASSERT_EQ(1U, topology.number_of_nodes());
+    ASSERT_FALSE(topology.cpus(0).empty());
+}
+
+TEST_F(NumaTopologyTest, test_assign_cores)
+{
+    FakeSysfs sysfs({{0, "0-7"}, {1, "8-15"}});
+    NumaTopology topology(sysfs.path());
+
+    auto const assignment = topology.assign_cores(4);
+    ASSERT_EQ(4U, assignment.size());
+    std::set<unsigned> used;
+    for(auto const& cpus : assignment) {
+        ASSERT_EQ(4U, cpus.size());
+        ASSERT_FALSE(topology.spans_nodes(cpus));
+        for(unsigned cpu : cpus) ASSERT_TRUE(used.insert(cpu).second) << "cpu " << cpu << " assigned twice";
+    }
+    // beams alternate between the nodes
+    ASSERT_EQ(0, topology.node_of_cpus(assignment[0]));
+    ASSERT_EQ(1, topology.node_of_cpus(assignment[1]));
+    ASSERT_EQ(0, topology.node_of_cpus(assignment[2]));
+    ASSERT_EQ(1, topology.node_of_cpus(assignment[3]));
+}
+
+TEST_F(NumaTopologyTest, test_assign_more_beams_than_cores)
+{
+    FakeSysfs sysfs({{0, "0-1"}});
+    NumaTopology topology(sysfs.path());
+
+    auto const assignment = topology.assign_cores(3);
+    ASSERT_EQ(3U, assignment.size());
+    for(auto const& cpus : assignment) {
+        ASSERT_EQ(1U, cpus.size());
+    }
+}
+
+TEST_F(NumaTopologyTest, test_run_local)
+{
+    NumaTopology const& topology = NumaTopology::system();
+    int value = 0;
+    topology.run_local(topology.cpus(0), [&]() { value = 1; });
+    ASSERT_EQ(1, value);
+    topology.run_local(std::vector<unsigned>(), [&]() { value = 2; });
+    ASSERT_EQ(2, value);
+    ASSERT_THROW(topology.run_local(topology.cpus(0), []() { throw std::runtime_error("expected"); }), std::runtime_error);
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
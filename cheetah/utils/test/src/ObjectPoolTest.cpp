@@ -0,0 +1,138 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/ObjectPoolTest.h"
+#include "cheetah/utils/ObjectPool.h"
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+ObjectPoolTest::ObjectPoolTest()
+    : ::testing::Test()
+{
+}
+
+ObjectPoolTest::~ObjectPoolTest()
+{
+}
+
+void ObjectPoolTest::SetUp()
+{
+}
+
+void ObjectPoolTest::TearDown()
+{
+}
+
+namespace {
+    struct TestObject
+    {
+        TestObject(int v = 0) : value(v) {}
+        int value;
+        std::vector<int> data;
+    };
+} // namespace
+
+TEST_F(ObjectPoolTest, test_objects_are_recycled)
+{
+    ObjectPool<TestObject> pool;
+    ASSERT_EQ(0U, pool.size());
+    TestObject* first = nullptr;
+    {
+        auto object = pool.acquire(5);
+        ASSERT_EQ(5, object->value);
+        object->data.resize(100);
+        first = object.get();
+        ASSERT_EQ(1U, pool.size());
+        ASSERT_EQ(0U, pool.available());
+    }
+    ASSERT_EQ(1U, pool.available());
+
+    // recycled object keeps its state (and capacity)
+    auto object = pool.acquire(7);
+    ASSERT_EQ(first, object.get());
+    ASSERT_EQ(5, object->value);
+    ASSERT_EQ(100U, object->data.size());
+    ASSERT_EQ(1U, pool.misses());
+}
+
+TEST_F(ObjectPoolTest, test_grows_when_all_in_use)
+{
+    ObjectPool<TestObject> pool;
+    pool.reserve(2, 3);
+    ASSERT_EQ(2U, pool.size());
+    ASSERT_EQ(2U, pool.available());
+
+    std::vector<std::shared_ptr<TestObject>> objects;
+    for(int i=0; i < 3; ++i) objects.push_back(pool.acquire(i));
+    std::set<TestObject*> distinct;
+    for(auto const& object : objects) distinct.insert(object.get());
+    ASSERT_EQ(3U, distinct.size());
+    ASSERT_EQ(3U, pool.size());
+    ASSERT_EQ(1U, pool.misses());
+    ASSERT_EQ(3, objects[0]->value); // from reserve
+    ASSERT_EQ(2, objects[2]->value); // newly constructed
+
+    objects.clear();
+    ASSERT_EQ(3U, pool.available());
+}
+
+TEST_F(ObjectPoolTest, test_objects_outlive_pool)
+{
+    std::shared_ptr<TestObject> object;
+    {
+        ObjectPool<TestObject> pool;
+        object = pool.acquire(9);
+    }
+    ASSERT_EQ(9, object->value);
+    object.reset();
+}
+
+TEST_F(ObjectPoolTest, test_multithreaded)
+{
+    ObjectPool<TestObject> pool;
+    std::vector<std::thread> threads;
+    for(int t=0; t < 4; ++t) {
+        threads.emplace_back([&pool]()
+                             {
+                                 for(int i=0; i < 1000; ++i) {
+                                     auto object = pool.acquire();
+                                     object->value = i;
+                                 }
+                             });
+    }
+    for(auto& thread : threads) thread.join();
+    ASSERT_LE(pool.size(), 4U);
+    ASSERT_EQ(pool.size(), pool.available());
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
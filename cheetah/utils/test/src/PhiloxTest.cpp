@@ -0,0 +1,88 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/PhiloxTest.h"
+#include "cheetah/utils/Philox.h"
+#include <cmath>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+PhiloxTest::PhiloxTest()
+    : ::testing::Test()
+{
+}
+
+PhiloxTest::~PhiloxTest()
+{
+}
+
+void PhiloxTest::SetUp()
+{
+}
+
+void PhiloxTest::TearDown()
+{
+}
+
+TEST_F(PhiloxTest, test_known_answers)
+{
+    // known answer tests from the Random123 distribution
+    ASSERT_EQ(Philox4x32::CounterType({{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}})
+            , Philox4x32::generate({{0, 0, 0, 0}}, {{0, 0}}));
+    ASSERT_EQ(Philox4x32::CounterType({{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}})
+            , Philox4x32::generate({{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}}, {{0xffffffff, 0xffffffff}}));
+    ASSERT_EQ(Philox4x32::CounterType({{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}})
+            , Philox4x32::generate({{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}}, {{0xa4093822, 0x299f31d0}}));
+}
+
+TEST_F(PhiloxTest, test_key)
+{
+    Philox4x32::KeyType key = Philox4x32::key(0x0123456789abcdefULL);
+    ASSERT_EQ(0x89abcdefU, key[0]);
+    ASSERT_EQ(0x01234567U, key[1]);
+}
+
+TEST_F(PhiloxTest, test_open_unit_interval)
+{
+    ASSERT_GT(Philox4x32::to_open_unit_interval(0), 0.0f);
+    ASSERT_LT(Philox4x32::to_open_unit_interval(0xffffffff), 1.0f);
+
+    // the mean of the uniform deviates should be close to 0.5
+    double sum = 0.0;
+    std::size_t const number_of_blocks = 10000;
+    for(std::uint32_t i = 0; i < number_of_blocks; ++i) {
+        for(auto value : Philox4x32::generate({{i, 0, 0, 0}}, Philox4x32::key(42))) {
+            sum += Philox4x32::to_open_unit_interval(value);
+        }
+    }
+    ASSERT_NEAR(0.5, sum / (4 * number_of_blocks), 0.01);
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,136 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/ReorderBufferTest.h"
+#include "cheetah/utils/ReorderBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+ReorderBufferTest::ReorderBufferTest()
+    : ::testing::Test()
+{
+}
+
+ReorderBufferTest::~ReorderBufferTest()
+{
+}
+
+void ReorderBufferTest::SetUp()
+{
+}
+
+void ReorderBufferTest::TearDown()
+{
+}
+
+TEST_F(ReorderBufferTest, test_in_order)
+{
+    ReorderBuffer<int> buffer(4);
+    ASSERT_EQ(0U, buffer.push(10));
+    ASSERT_EQ(1U, buffer.push(11));
+    ASSERT_EQ(2U, buffer.depth());
+
+    ASSERT_EQ(0U, buffer.acquire(10));
+    buffer.release(0);
+    ASSERT_EQ(1U, buffer.acquire(11));
+    buffer.release(1);
+    ASSERT_EQ(0U, buffer.depth());
+    ASSERT_EQ(2U, buffer.max_depth());
+    ASSERT_THROW(buffer.acquire(10), panda::Error);
+}
+
+TEST_F(ReorderBufferTest, test_out_of_order_completion_is_resequenced)
+{
+    unsigned const n = 64;
+    ReorderBuffer<unsigned> buffer(n);
+    for(unsigned i=0; i < n; ++i) {
+        buffer.push(i);
+    }
+
+    // complete in reverse order, each on its own thread
+    std::vector<unsigned> output;
+    std::mutex output_mutex;
+    std::vector<std::thread> threads;
+    for(unsigned i=n; i > 0; --i) {
+        threads.emplace_back([&, i]()
+        {
+            auto sequence_number = buffer.acquire(i - 1);
+            {
+                std::lock_guard<std::mutex> lock(output_mutex);
+                output.push_back(i - 1);
+            }
+            buffer.release(sequence_number);
+        });
+    }
+    for(auto& thread : threads) thread.join();
+
+    ASSERT_EQ(n, output.size());
+    for(unsigned i=0; i < n; ++i) {
+        ASSERT_EQ(i, output[i]);
+    }
+}
+
+TEST_F(ReorderBufferTest, test_push_blocks_when_full)
+{
+    ReorderBuffer<int> buffer(1);
+    auto sequence_number = buffer.push(0);
+    std::atomic<bool> pushed(false);
+    std::thread producer([&]()
+    {
+        buffer.push(1);
+        pushed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(pushed);
+    buffer.acquire(0);
+    buffer.release(sequence_number);
+    producer.join();
+    ASSERT_TRUE(pushed);
+    ASSERT_EQ(1U, buffer.producer_stall_count());
+    ASSERT_GT(buffer.producer_stall_time().count(), 0);
+}
+
+TEST_F(ReorderBufferTest, test_cancel)
+{
+    ReorderBuffer<int> buffer(4);
+    auto first = buffer.push(0);
+    auto second = buffer.push(1);
+    buffer.cancel(first); // a cancelled head must not hold up the next item
+    ASSERT_EQ(second, buffer.acquire(1));
+    buffer.release(second);
+    buffer.wait_empty();
+    ASSERT_EQ(0U, buffer.depth());
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
@@ -0,0 +1,159 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2024 The SKA organisation
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "cheetah/utils/test/WorkerPoolTest.h"
+#include "cheetah/utils/WorkerPool.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace ska {
+namespace cheetah {
+namespace utils {
+namespace test {
+
+
+WorkerPoolTest::WorkerPoolTest()
+    : ::testing::Test()
+{
+}
+
+WorkerPoolTest::~WorkerPoolTest()
+{
+}
+
+void WorkerPoolTest::SetUp()
+{
+}
+
+void WorkerPoolTest::TearDown()
+{
+}
+
+TEST_F(WorkerPoolTest, test_number_of_threads)
+{
+    ASSERT_EQ(1U, WorkerPool().number_of_threads());
+    ASSERT_EQ(1U, WorkerPool(0).number_of_threads());
+    ASSERT_EQ(4U, WorkerPool(4).number_of_threads());
+}
+
+TEST_F(WorkerPoolTest, test_every_task_runs_once)
+{
+    for(unsigned number_of_threads : {1U, 2U, 5U})
+    {
+        WorkerPool pool(number_of_threads);
+        // the same threads are reused for every run
+        for(std::size_t number_of_tasks : {0U, 1U, 3U, 100U})
+        {
+            std::vector<std::atomic<unsigned>> calls(number_of_tasks);
+            for(auto& c : calls) c = 0;
+            pool.run(number_of_tasks, [&](std::size_t i) { ++calls[i]; });
+            for(std::size_t i=0; i < number_of_tasks; ++i)
+            {
+                ASSERT_EQ(1U, calls[i]) << "threads=" << number_of_threads << " task=" << i;
+            }
+        }
+    }
+}
+
+TEST_F(WorkerPoolTest, test_threads_are_reused)
+{
+    WorkerPool pool(3);
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    for(unsigned run=0; run < 20; ++run)
+    {
+        pool.run(30, [&](std::size_t)
+                     {
+                         std::lock_guard<std::mutex> lock(mutex);
+                         ids.insert(std::this_thread::get_id());
+                     });
+    }
+    // the workers and the calling thread only
+    ASSERT_LE(ids.size(), 3U);
+}
+
+TEST_F(WorkerPoolTest, test_exception_rethrown_on_caller)
+{
+    for(unsigned number_of_threads : {1U, 4U})
+    {
+        WorkerPool pool(number_of_threads);
+        std::atomic<unsigned> count(0);
+        ASSERT_THROW(pool.run(50, [&](std::size_t i)
+                                  {
+                                      ++count;
+                                      if(i == 17) throw std::runtime_error("task failed");
+                                  })
+                    , std::runtime_error);
+
+        // the pool remains usable
+        count = 0;
+        pool.run(50, [&](std::size_t) { ++count; });
+        ASSERT_EQ(50U, count);
+    }
+}
+
+TEST_F(WorkerPoolTest, test_workers_bound_to_cpus)
+{
+    ASSERT_TRUE(WorkerPool(3).cpus().empty());
+#ifdef __linux__
+    // the first cpu this process may run on
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(allowed), &allowed));
+    std::vector<unsigned> cpus;
+    for(unsigned cpu=0; cpu < CPU_SETSIZE && cpus.empty(); ++cpu) {
+        if(CPU_ISSET(cpu, &allowed)) cpus.push_back(cpu);
+    }
+    ASSERT_FALSE(cpus.empty());
+
+    WorkerPool pool(3, cpus);
+    ASSERT_EQ(cpus, pool.cpus());
+
+    std::thread::id const caller = std::this_thread::get_id();
+    std::mutex mutex;
+    std::set<int> worker_cpus;
+    pool.run(64, [&](std::size_t)
+                 {
+                     std::this_thread::sleep_for(std::chrono::microseconds(100));
+                     if(std::this_thread::get_id() == caller) return;
+                     std::lock_guard<std::mutex> lock(mutex);
+                     worker_cpus.insert(sched_getcpu());
+                 });
+    for(int cpu : worker_cpus) {
+        ASSERT_EQ(static_cast<int>(cpus[0]), cpu);
+    }
+#endif // __linux__
+}
+
+} // namespace test
+} // namespace utils
+} // namespace cheetah
+} // namespace ska
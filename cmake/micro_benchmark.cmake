@@ -0,0 +1,31 @@
+option(ENABLE_BENCHMARK "Build the google-benchmark micro benchmarks for the low level (e.g. nasm/SIMD) kernels" OFF)
+
+if(NOT SKA_CHEETAH_MICRO_BENCHMARK_GUARD_VAR)
+    set(SKA_CHEETAH_MICRO_BENCHMARK_GUARD_VAR TRUE)
+else()
+    return()
+endif()
+
+if(ENABLE_BENCHMARK)
+    find_package(benchmark REQUIRED)
+    set(BENCHMARK_LIBRARIES benchmark::benchmark)
+    message("ENABLE_BENCHMARK activated")
+endif()
+
+#================================================
+# add_kernel_benchmark
+#
+# brief: add a google-benchmark executable for a set of kernels
+#
+# usage: add_kernel_benchmark(name src1 [src2...])
+#
+# The executable accepts the usual google-benchmark command line options, e.g.
+#   --benchmark_out=kernels.json --benchmark_out_format=json
+# to export the results (including the measured memory bandwidth in the context).
+#================================================
+function(add_kernel_benchmark name)
+    if(ENABLE_BENCHMARK)
+        add_executable(${name} ${ARGN})
+        target_link_libraries(${name} ${CHEETAH_LIBRARIES} ${BENCHMARK_LIBRARIES})
+    endif()
+endfunction()